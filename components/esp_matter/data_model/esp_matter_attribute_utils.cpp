@@ -25,14 +25,20 @@
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
 #include <esp_matter_mem.h>
+#include <esp_matter_mpsc_ring.h>
+#include <esp_matter_nvs_write_back.h>
+#include <esp_matter_trace.h>
 
 #include <data_model_provider/esp_matter_data_model_provider.h>
 
 #include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
 #include <app/reporting/reporting.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/attribute-table.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <protocols/interaction_model/Constants.h>
 
 using chip::AttributeId;
@@ -186,6 +192,48 @@ void val_print(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
     }
 }
 
+/* With CONFIG_ESP_MATTER_TRACE the attribute updates are recorded in the binary trace instead of being printed */
+static int64_t begin_update_trace(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                  esp_matter_attr_val_t *val)
+{
+    if (!trace::is_enabled()) {
+        attribute::val_print(endpoint_id, cluster_id, attribute_id, val, false);
+    }
+    return trace::begin();
+}
+
+static void end_update_trace(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                             const esp_matter_attr_val_t *val, esp_err_t err, int64_t start_us)
+{
+    VerifyOrReturn(trace::is_enabled());
+    uint32_t value = 0;
+    switch (val->get_storage_type()) {
+    case ESP_MATTER_VAL_TYPE_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING:
+        value = val->val.a.s;
+        break;
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+        value = val->val.b;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT8:
+    case ESP_MATTER_VAL_TYPE_UINT8:
+        value = val->val.u8;
+        break;
+    case ESP_MATTER_VAL_TYPE_INT16:
+    case ESP_MATTER_VAL_TYPE_UINT16:
+        value = val->val.u16;
+        break;
+    default:
+        // 32 and 64-bit integers and floats, the low 32 bits
+        memcpy(&value, &val->val, sizeof(value));
+        break;
+    }
+    trace::record(trace::EVENT_ATTRIBUTE_UPDATE, endpoint_id, cluster_id, attribute_id, val->type, value, err,
+                  start_us);
+}
+
 static esp_err_t update_or_report(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val, bool call_attribute_callbacks)
 {
     VerifyOrReturnError(val, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "val cannot be NULL"));
@@ -196,12 +244,15 @@ static esp_err_t update_or_report(uint16_t endpoint_id, uint32_t cluster_id, uin
     lock::ScopedChipStackLock lock(portMAX_DELAY);
 
     /* Here, the val_print function gets called on attribute write.*/
-    attribute::val_print(endpoint_id, cluster_id, attribute_id, val, false);
+    int64_t trace_start = begin_update_trace(endpoint_id, cluster_id, attribute_id, val);
 
     esp_err_t err = attribute::set_val(attr, val, call_attribute_callbacks);
+    end_update_trace(endpoint_id, cluster_id, attribute_id, val, err, trace_start);
     if (err == ESP_OK) {
-        data_model::provider::get_instance().Temporary_ReportAttributeChanged(
-            chip::app::AttributePathParams(endpoint_id, cluster_id, attribute_id));
+        if (should_report_change(attr)) {
+            data_model::provider::get_instance().Temporary_ReportAttributeChanged(
+                chip::app::AttributePathParams(endpoint_id, cluster_id, attribute_id));
+        }
     } else if (err == ESP_ERR_NOT_FINISHED) {
         // new value is same as older value, skip reporting to IM engine
         err = ESP_OK;
@@ -222,6 +273,257 @@ esp_err_t report(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_i
     return update_or_report(endpoint_id, cluster_id, attribute_id, val, false /* call_attribute_callbacks */);
 }
 
+namespace batch {
+
+static esp_err_t validate_entry(const entry_t &entry)
+{
+    esp_matter_attr_val_t val = entry.val;
+    VerifyOrReturnError(val.type != ESP_MATTER_VAL_TYPE_INVALID, ESP_ERR_INVALID_ARG);
+    VerifyOrReturnError(val.type != ESP_MATTER_VAL_TYPE_ARRAY, ESP_ERR_NOT_SUPPORTED);
+    attribute_t *attr = get(entry.endpoint_id, entry.cluster_id, entry.attribute_id);
+    VerifyOrReturnError(attr, ESP_ERR_NOT_FOUND);
+    uint16_t flags = get_flags(attr);
+    VerifyOrReturnError(!(flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) || (flags & ATTRIBUTE_FLAG_WRITABLE),
+                        ESP_ERR_NOT_SUPPORTED);
+    return validate_val(attr, &val);
+}
+
+static esp_err_t update_or_report(entry_t *entries, size_t count, bool call_attribute_callbacks)
+{
+    VerifyOrReturnError(entries && count > 0, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "entries cannot be empty"));
+
+    chip::Platform::ScopedMemoryBuffer<data_model::provider::AttributeChange> changes;
+    VerifyOrReturnError(changes.Calloc(count), ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Failed to allocate the changes"));
+
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+
+    // Nothing is applied unless every value can be set
+    for (size_t index = 0; index < count; ++index) {
+        esp_err_t err = validate_entry(entries[index]);
+        VerifyOrReturnError(err == ESP_OK, err,
+                            ESP_LOGE(TAG, "Invalid batch entry %u for path: 0x%x/0x%" PRIx32 "/0x%" PRIX32 " err: %d",
+                                     (unsigned)index, entries[index].endpoint_id, entries[index].cluster_id,
+                                     entries[index].attribute_id, err));
+    }
+
+    size_t changed_count = 0;
+    esp_err_t ret = ESP_OK;
+    write_back::begin_batch();
+    for (size_t index = 0; index < count; ++index) {
+        entry_t &entry = entries[index];
+        int64_t trace_start = begin_update_trace(entry.endpoint_id, entry.cluster_id, entry.attribute_id, &entry.val);
+        attribute_t *attr = get(entry.endpoint_id, entry.cluster_id, entry.attribute_id);
+        esp_err_t err = attribute::set_val(attr, &entry.val, call_attribute_callbacks);
+        end_update_trace(entry.endpoint_id, entry.cluster_id, entry.attribute_id, &entry.val, err, trace_start);
+        if (err == ESP_OK) {
+            // The data version of each changed cluster is increased once, after the loop
+            changes[changed_count++] = {
+                chip::app::ConcreteAttributePath(entry.endpoint_id, entry.cluster_id, entry.attribute_id),
+                should_report_batched_change(attr)
+            };
+        } else if (err != ESP_ERR_NOT_FINISHED) {
+            // Only the application can still reject a value at this point, from its PRE_UPDATE callback
+            ESP_LOGE(TAG, "Failed to set attribute value for path: 0x%x/0x%" PRIx32 "/0x%" PRIX32 " err: %d",
+                     entry.endpoint_id, entry.cluster_id, entry.attribute_id, err);
+            ret = err;
+        }
+    }
+    esp_err_t persist_err = write_back::end_batch();
+
+    data_model::provider::get_instance().ReportAttributesChanged(changes.Get(), changed_count);
+    return ret != ESP_OK ? ret : persist_err;
+}
+
+esp_err_t update(entry_t *entries, size_t count)
+{
+    return update_or_report(entries, count, true /* call_attribute_callbacks */);
+}
+
+esp_err_t report(entry_t *entries, size_t count)
+{
+    return update_or_report(entries, count, false /* call_attribute_callbacks */);
+}
+
+} // namespace batch
+
+namespace async {
+
+namespace {
+using queue_t = mpsc_ring<batch::entry_t, CONFIG_ESP_MATTER_ATTRIBUTE_UPDATE_QUEUE_SIZE>;
+constexpr size_t k_capacity = queue_t::k_capacity;
+
+queue_t s_queue;
+std::atomic<bool> s_drain_scheduled{false};
+std::atomic<uint32_t> s_enqueued{0};
+std::atomic<uint32_t> s_applied{0};
+std::atomic<uint32_t> s_coalesced{0};
+std::atomic<uint32_t> s_dropped{0};
+std::atomic<uint16_t> s_high_watermark{0};
+
+// Only used by drain(), on the Matter thread
+batch::entry_t s_drained[k_capacity];
+bool s_superseded[k_capacity];
+// Open addressing set of the paths of the drained entries, at most half full. A slot holds the index of the entry + 1.
+constexpr size_t k_seen_size = k_capacity * 2;
+uint16_t s_seen[k_seen_size];
+data_model::provider::AttributeChange s_changes[k_capacity];
+} // namespace
+
+static bool has_string_buffer(const esp_matter_attr_val_t &val)
+{
+    esp_matter_val_type_t type = val.get_storage_type();
+    if (type != ESP_MATTER_VAL_TYPE_CHAR_STRING && type != ESP_MATTER_VAL_TYPE_OCTET_STRING &&
+        type != ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING && type != ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING) {
+        return false;
+    }
+    uint16_t null_len = (type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_OCTET_STRING)
+                        ? UINT8_MAX
+                        : UINT16_MAX;
+    return val.val.a.b && val.val.a.s > 0 && val.val.a.s != null_len;
+}
+
+static void release_entry(batch::entry_t &entry)
+{
+    if (has_string_buffer(entry.val)) {
+        esp_matter_mem_free(entry.val.val.a.b);
+    }
+}
+
+static void update_high_watermark(uint16_t depth)
+{
+    uint16_t high_watermark = s_high_watermark.load(std::memory_order_relaxed);
+    while (depth > high_watermark &&
+           !s_high_watermark.compare_exchange_weak(high_watermark, depth, std::memory_order_relaxed)) {
+    }
+}
+
+static bool is_same_path(const batch::entry_t &entry, const batch::entry_t &other)
+{
+    return entry.endpoint_id == other.endpoint_id && entry.cluster_id == other.cluster_id &&
+           entry.attribute_id == other.attribute_id;
+}
+
+static size_t get_seen_slot(const batch::entry_t &entry)
+{
+    uint32_t hash = (entry.attribute_id * 2654435761u) ^ (entry.cluster_id * 40503u) ^ entry.endpoint_id;
+    return (hash ^ (hash >> 16)) & (k_seen_size - 1);
+}
+
+// Marks the entries followed by a later update of the same attribute, in one pass from the newest entry
+static void mark_superseded(size_t count)
+{
+    memset(s_seen, 0, sizeof(s_seen));
+    for (size_t index = count; index-- > 0;) {
+        const batch::entry_t &entry = s_drained[index];
+        size_t slot = get_seen_slot(entry);
+        s_superseded[index] = false;
+        while (s_seen[slot] != 0 && !s_superseded[index]) {
+            s_superseded[index] = is_same_path(s_drained[s_seen[slot] - 1], entry);
+            slot = (slot + 1) & (k_seen_size - 1);
+        }
+        if (!s_superseded[index]) {
+            s_seen[slot] = (uint16_t)(index + 1);
+        }
+    }
+}
+
+static void drain(intptr_t context)
+{
+    // Cleared first, so that an update queued while draining schedules the next drain
+    s_drain_scheduled.store(false);
+
+    size_t count = 0;
+    while (count < k_capacity && s_queue.pop(s_drained[count])) {
+        count++;
+    }
+    VerifyOrReturn(count > 0);
+    mark_superseded(count);
+
+    size_t changed_count = 0;
+    write_back::begin_batch();
+    for (size_t index = 0; index < count; ++index) {
+        batch::entry_t &entry = s_drained[index];
+        if (s_superseded[index]) {
+            s_coalesced++;
+            release_entry(entry);
+            continue;
+        }
+        attribute_t *attr = get(entry.endpoint_id, entry.cluster_id, entry.attribute_id);
+        esp_err_t err = batch::validate_entry(entry);
+        if (err == ESP_OK) {
+            int64_t trace_start = begin_update_trace(entry.endpoint_id, entry.cluster_id, entry.attribute_id,
+                                                     &entry.val);
+            err = attribute::set_val(attr, &entry.val, true /* call_attribute_callbacks */);
+            end_update_trace(entry.endpoint_id, entry.cluster_id, entry.attribute_id, &entry.val, err, trace_start);
+        }
+        if (err == ESP_OK) {
+            s_changes[changed_count++] = {
+                chip::app::ConcreteAttributePath(entry.endpoint_id, entry.cluster_id, entry.attribute_id),
+                should_report_batched_change(attr)
+            };
+            s_applied++;
+        } else if (err == ESP_ERR_NOT_FINISHED) {
+            // new value is same as older value, skip reporting to IM engine
+            s_applied++;
+        } else {
+            ESP_LOGE(TAG, "Failed to apply queued value for path: 0x%x/0x%" PRIx32 "/0x%" PRIX32 " err: %d",
+                     entry.endpoint_id, entry.cluster_id, entry.attribute_id, err);
+            s_dropped++;
+        }
+        release_entry(entry);
+    }
+    write_back::end_batch();
+
+    data_model::provider::get_instance().ReportAttributesChanged(s_changes, changed_count);
+}
+
+} // namespace async
+
+esp_err_t update_async(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val)
+{
+    VerifyOrReturnError(val, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "val cannot be NULL"));
+    VerifyOrReturnError(val->type != ESP_MATTER_VAL_TYPE_INVALID, ESP_ERR_INVALID_ARG);
+    VerifyOrReturnError(val->type != ESP_MATTER_VAL_TYPE_ARRAY, ESP_ERR_NOT_SUPPORTED);
+
+    batch::entry_t entry = { endpoint_id, cluster_id, attribute_id, *val };
+    if (async::has_string_buffer(*val)) {
+        // One more byte keeps a char string null terminated
+        entry.val.val.a.b = (uint8_t *)esp_matter_mem_calloc(1, val->val.a.s + 1);
+        VerifyOrReturnError(entry.val.val.a.b, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Failed to allocate the string copy"));
+        memcpy(entry.val.val.a.b, val->val.a.b, val->val.a.s);
+    }
+
+    if (!async::s_queue.push(entry)) {
+        async::release_entry(entry);
+        async::s_dropped++;
+        return ESP_ERR_NO_MEM;
+    }
+    async::s_enqueued++;
+    async::update_high_watermark(async::s_queue.size());
+
+    if (!async::s_drain_scheduled.exchange(true)) {
+        if (chip::DeviceLayer::PlatformMgr().ScheduleWork(async::drain) != CHIP_NO_ERROR) {
+            // The update stays queued, it is applied by the drain scheduled with the next update
+            async::s_drain_scheduled.store(false);
+            ESP_LOGE(TAG, "Failed to schedule the queued attribute updates");
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t get_async_stats(async_stats_t *stats)
+{
+    VerifyOrReturnError(stats, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "stats cannot be NULL"));
+    stats->capacity = async::k_capacity;
+    stats->depth = async::s_queue.size();
+    stats->high_watermark = async::s_high_watermark.load();
+    stats->enqueued = async::s_enqueued.load();
+    stats->applied = async::s_applied.load();
+    stats->coalesced = async::s_coalesced.load();
+    stats->dropped = async::s_dropped.load();
+    return ESP_OK;
+}
+
 bool val_compare(const esp_matter_attr_val_t *val1, const esp_matter_attr_val_t *val2)
 {
     if (val1 == nullptr || val2 == nullptr) {
@@ -851,6 +851,106 @@ esp_err_t update(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_i
  */
 esp_err_t report(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val);
 
+namespace batch {
+
+/** Attribute update staged in a batch */
+typedef struct {
+    /** Endpoint ID of the attribute */
+    uint16_t endpoint_id;
+    /** Cluster ID of the attribute */
+    uint32_t cluster_id;
+    /** Attribute ID of the attribute */
+    uint32_t attribute_id;
+    /** New value. The buffer of a string value must stay valid until the batch is applied. */
+    esp_matter_attr_val_t val;
+} entry_t;
+
+/** Batch attribute update
+ *
+ * This API updates several attributes together, for example the on/off, level, hue and saturation of a light
+ * changed by the driver at once.
+ * All the values are validated first, nothing is updated if one of them does not match the attribute type, bounds or
+ * maximum length. The values are then applied under one Matter stack lock. The application gets the `PRE_UPDATE` and
+ * `POST_UPDATE` callbacks for each attribute as with `update()`, but the data version of each cluster is increased
+ * once, the changed attributes are marked dirty together and the non-volatile ones are written to NVS with one commit.
+ *
+ * @note If the `PRE_UPDATE` callback rejects a value, that attribute is skipped, the other attributes are still
+ * updated and the error of the callback is returned.
+ *
+ * @param[in] entries Array of the attribute updates.
+ * @param[in] count Number of entries in the array.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t update(entry_t *entries, size_t count);
+
+/** Batch attribute report
+ *
+ * Same as the batch `update()`, but the application doesn't get the `PRE_UPDATE` or `POST_UPDATE` callbacks, as
+ * with `report()`.
+ *
+ * @param[in] entries Array of the attribute updates.
+ * @param[in] count Number of entries in the array.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t report(entry_t *entries, size_t count);
+
+} // namespace batch
+
+/** Asynchronous attribute update
+ *
+ * This API queues the attribute update and returns without waiting for the Matter stack lock, so that sensor tasks,
+ * driver timers and bridge tasks are never stalled by the Matter thread. The queue is drained on the Matter thread,
+ * where the updates are applied as with `update()`, including the `PRE_UPDATE` and `POST_UPDATE` callbacks. Several
+ * updates of the same attribute waiting in the queue are coalesced, only the last value is applied.
+ *
+ * The value is copied, the buffer of a string value can be released when this API returns. The updates that cannot be
+ * applied, because the attribute does not exist or the value is invalid, are logged and counted as dropped.
+ *
+ * @note This API must not be called from an ISR.
+ *
+ * @param[in] endpoint_id Endpoint ID of the attribute.
+ * @param[in] cluster_id Cluster ID of the attribute.
+ * @param[in] attribute_id Attribute ID of the attribute.
+ * @param[in] val Pointer to `esp_matter_attr_val_t`. Appropriate elements should be used as per the value type.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NO_MEM if the queue is full, the update is dropped. An update queued while the Matter thread cannot
+ * be woken up is not rejected, it is applied with the next queued update.
+ * @return error in case of failure.
+ */
+esp_err_t update_async(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val);
+
+/** Asynchronous attribute update queue statistics */
+typedef struct {
+    /** Number of updates the queue can hold */
+    uint16_t capacity;
+    /** Number of updates waiting in the queue */
+    uint16_t depth;
+    /** Highest number of updates seen waiting in the queue */
+    uint16_t high_watermark;
+    /** Number of updates queued */
+    uint32_t enqueued;
+    /** Number of updates applied */
+    uint32_t applied;
+    /** Number of updates replaced by a later update of the same attribute before being applied */
+    uint32_t coalesced;
+    /** Number of updates rejected because the queue was full, or dropped because they could not be applied */
+    uint32_t dropped;
+} async_stats_t;
+
+/** Get the asynchronous attribute update queue statistics
+ *
+ * @param[out] stats Pointer to the statistics.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t get_async_stats(async_stats_t *stats);
+
 /** Attribute value print
  *
  * This API prints the attribute value according to the type.
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <esp_check.h>
@@ -23,20 +24,29 @@
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
 #include <esp_matter_data_model_provider.h>
+#include <esp_matter_arena.h>
 #include <esp_matter_attr_data_buffer.h>
+#include <esp_matter_boot_profile.h>
+#include <esp_matter_cluster_metadata.h>
+#include <esp_matter_latency.h>
 #include <esp_matter_mem.h>
 #include <esp_matter_nvs.h>
+#include <esp_matter_nvs_write_back.h>
+#include <esp_matter_report_policy.h>
 #include <esp_random.h>
 #include <nvs_flash.h>
 #include <singly_linked_list.h>
+#include <sorted_index.h>
 
 #include <access/SubjectDescriptor.h>
+#include <app/AttributeAccessInterfaceRegistry.h>
 #include <app/clusters/identify-server/identify-server.h>
 #include <app/data-model-provider/MetadataTypes.h>
 #include <app/data-model-provider/Provider.h>
 #include <app/server/Server.h>
 #include <app/util/attribute-storage.h>
 #include <app/util/endpoint-config-api.h>
+#include <platform/CHIPDeviceLayer.h>
 #include <credentials/GroupDataProviderImpl.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/core/TLV.h>
@@ -59,29 +69,45 @@ using chip::app::DataModel::EndpointCompositionPattern;
 
 namespace esp_matter {
 
+struct _cluster;
+
 struct _attribute_base_t {
     uint16_t flags; // This struct is for attributes managed internally.
-    esp_matter_val_type_t attribute_val_type;
+    esp_matter_val_type_t attribute_val_type : 8; /* All the value types fit in 8 bits, the spare bytes of the first
+                                                     word are used by parent_cluster instead of padding. */
     uint32_t attribute_id;
     struct _attribute_base_t *next;
+    struct _cluster *parent_cluster; /* Recovers the attribute path in O(1), also for attributes managed internally */
 };
 
+// The parent cluster pointer reuses the padding after attribute_val_type, keep the base at 4 words on 32-bit targets.
+static_assert(sizeof(void *) != 4 || sizeof(_attribute_base_t) == 16, "_attribute_base_t should stay 16 bytes");
+
 struct _attribute_t : public _attribute_base_t {
     esp_matter_val_t attribute_val;
-    esp_matter_attr_bounds_t *bounds;
-    uint16_t endpoint_id;
-    uint32_t cluster_id;
+    const attribute::bounds_t *bounds; /* Constant bounds shared by the attributes, or a heap copy if `allocated` */
+    uint16_t string_capacity; /* Size of the string buffer, the inline buffer after the node or a separate one */
+    bool restore_pending; /* The stored value is not restored yet, see set_background_restore() */
     attribute::callback_t override_callback;
+    attribute::report_policy::state_t *report_policy;
 };
 
+// The string attributes are allocated with this many extra bytes after _attribute_t. The values that fit, the null
+// terminator included, are stored there instead of a separate heap buffer.
+constexpr uint16_t k_inline_string_size = 16;
+
 typedef struct _command {
-    uint32_t command_id;
-    uint16_t flags;
-    command::callback_t callback;
+    const command::descriptor_t *descriptor; /* Id, flags and callback, in flash for the spec-defined commands */
     command::callback_t user_callback;
     struct _command *next;
 } _command_t;
 
+/* Command created with an id, flags and callback given at run time, its descriptor follows the node */
+typedef struct _dynamic_command {
+    _command_t command;
+    command::descriptor_t descriptor;
+} _dynamic_command_t;
+
 typedef struct _event {
     uint32_t event_id;
     struct _event *next;
@@ -103,8 +129,12 @@ typedef struct _cluster {
     chip::DataVersion data_version;
     _attribute_base_t *attribute_list; /* If attribute is managed internally, the actual pointer type is
                                      _internal_attribute_t. When operating attribute_list, do check the flags first! */
+    SortedIndex<uint32_t, _attribute_base_t> attribute_index; /* attribute_id -> attribute in attribute_list */
     _command_t *command_list;
+    SortedIndex<uint32_t, _command_t> accepted_command_index; /* command_id -> accepted command in command_list, the
+                                                                 dispatch table of the invokes */
     _event_t *event_list;
+    cluster::metadata_cache_t *metadata_cache; /* Provider metadata snapshot, dropped when attributes or commands change */
     struct _cluster *next;
 } _cluster_t;
 
@@ -126,14 +156,61 @@ typedef struct _endpoint {
     uint8_t semantic_tag_count;
     chip::app::DataModel::Provider::SemanticTag semantic_tags[ESP_MATTER_MAX_SEMANTIC_TAG_COUNT];
     _cluster_t *cluster_list;
+    SortedIndex<uint32_t, _cluster_t> cluster_index; /* cluster_id -> cluster in cluster_list */
     struct _endpoint *next;
 } _endpoint_t;
 
 typedef struct _node {
     _endpoint_t *endpoint_list;
+    SortedIndex<uint16_t, _endpoint_t> endpoint_index; /* endpoint_id -> endpoint in endpoint_list */
     uint16_t min_unused_endpoint_id;
 } _node_t;
 
+/* Attribute captured by endpoint::capture_template() */
+typedef struct {
+    uint32_t attribute_id;
+    uint16_t flags;
+    uint16_t max_val_size;
+    esp_matter_val_type_t val_type;
+    bool bounds_copied; /* The bounds are the own copy of the template, the heap bounds of the attribute are freed */
+    esp_matter_val_t val; /* The string values point to the bytes stored at the end of the template */
+    const attribute::bounds_t *bounds;
+    attribute::callback_t override_callback;
+} _template_attribute_t;
+
+typedef struct {
+    const command::descriptor_t *descriptor; /* The flash descriptor, or a copy in the template for a dynamic command */
+    command::callback_t user_callback;
+} _template_command_t;
+
+typedef struct {
+    uint32_t cluster_id;
+    uint8_t flags;
+    uint16_t attribute_count;
+    uint16_t command_count;
+    uint16_t event_count;
+    const cluster::function_generic_t *functions;
+    cluster::plugin_server_init_callback_t plugin_server_init_callback;
+    cluster::delegate_init_callback_t delegate_init_callback;
+    cluster::delegate_shutdown_callback_t delegate_shutdown_callback;
+    void *delegate_pointer;
+    cluster::add_bounds_callback_t add_bounds_callback;
+    cluster::initialization_callback_t init_callback;
+    cluster::shutdown_callback_t shutdown_callback;
+    _template_attribute_t *attributes;
+    _template_command_t *commands;
+    uint32_t *event_ids;
+} _template_cluster_t;
+
+/* Allocated as one block: the clusters, attributes, commands, dynamic command descriptors, event ids and string values
+   follow this header */
+typedef struct {
+    uint8_t device_type_count;
+    device_type_t device_types[ESP_MATTER_MAX_DEVICE_TYPE_COUNT];
+    uint16_t cluster_count;
+    _template_cluster_t *clusters;
+} _endpoint_template_t;
+
 namespace {
 // Treat 0xFFFF'FFFF as wildcard cluster
 inline bool is_wildcard_cluster_id(uint32_t cluster_id)
@@ -254,6 +331,7 @@ esp_err_t disable(endpoint_t *endpoint)
 
 void invoke_init_callbacks_internal(endpoint_t *endpoint)
 {
+    boot_profile::scoped_phase phase(boot_profile::PHASE_PLUGIN_INIT);
     cluster_t *cluster = cluster::get_first(endpoint);
     while (cluster) {
         /* Delegate server init callback */
@@ -363,123 +441,188 @@ esp_err_t execute_callback(callback_type_t type, uint16_t endpoint_id, uint32_t
 #else
         void *priv_data = nullptr;
 #endif
+        latency::scoped_timer timer(latency::OPERATION_ATTRIBUTE_CALLBACK, endpoint_id, cluster_id);
         return attribute_callback(type, endpoint_id, cluster_id, attribute_id, val, priv_data);
     }
     return ESP_OK;
 }
 
-/**
- * Check whether the attribute value is in the range of attribute bounds
- *
- * @param[in] val Attribute value.
- * @param[in] bounds Attribute bounds.
- *
- * @return 0 if val is in the range of attribute bounds.
- * @return 1 if val is more than bounds.max
- * @return -1 if val is less than bounds.min
- * @return -2 if val type is wrong
- */
-static int compare_attr_val_with_bounds(esp_matter_attr_val_t val, esp_matter_attr_bounds_t bounds)
-{
-    if (val.is_null()) {
-        return 0;
+template <typename T>
+static const bounds_t *create_typed_bounds(const esp_matter_val_t &min, const esp_matter_val_t &max)
+{
+    typed_bounds_t<T> *bounds = (typed_bounds_t<T> *)esp_matter_mem_calloc(1, sizeof(typed_bounds_t<T>));
+    VerifyOrReturnValue(bounds, nullptr);
+    bounds->base.compare = compare_bounds<T>;
+    bounds->base.get = get_bounds_val<T>;
+    bounds->base.storage_type = bounds_val<T>::k_storage_type;
+    bounds->base.allocated = true;
+    bounds->min = bounds_val<T>::get(min);
+    bounds->max = bounds_val<T>::get(max);
+    return &bounds->base;
+}
+
+static const bounds_t *create_bounds(esp_matter_val_type_t storage_type, const esp_matter_val_t &min,
+                                     const esp_matter_val_t &max)
+{
+    switch (storage_type) {
+    case ESP_MATTER_VAL_TYPE_UINT8:
+        return create_typed_bounds<uint8_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_UINT16:
+        return create_typed_bounds<uint16_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_UINT32:
+        return create_typed_bounds<uint32_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        return create_typed_bounds<uint64_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_INT8:
+        return create_typed_bounds<int8_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_INT16:
+        return create_typed_bounds<int16_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_INT32:
+        return create_typed_bounds<int32_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_INT64:
+        return create_typed_bounds<int64_t>(min, max);
+    case ESP_MATTER_VAL_TYPE_FLOAT:
+        return create_typed_bounds<float>(min, max);
+    default:
+        break;
     }
+    return nullptr;
+}
 
-    switch (val.get_storage_type()) {
-    case ESP_MATTER_VAL_TYPE_UINT8: {
-        if (val.val.u8 < bounds.min.val.u8) {
-            return -1;
-        } else if (val.val.u8 > bounds.max.val.u8) {
-            return 1;
-        }
-        return 0;
-    }
-    case ESP_MATTER_VAL_TYPE_UINT16: {
-        if (val.val.u16 < bounds.min.val.u16) {
-            return -1;
-        } else if (val.val.u16 > bounds.max.val.u16) {
-            return 1;
-        }
-        return 0;
+static void free_bounds(_attribute_t *attribute)
+{
+    if (attribute->bounds && attribute->bounds->allocated) {
+        esp_matter_mem_free((void *)attribute->bounds);
     }
-    case ESP_MATTER_VAL_TYPE_UINT32: {
-        if (val.val.u32 < bounds.min.val.u32) {
-            return -1;
-        } else if (val.val.u32 > bounds.max.val.u32) {
-            return 1;
-        }
-        return 0;
+    attribute->bounds = nullptr;
+}
+
+static bool is_within_bounds(const bounds_t &bounds, const esp_matter_attr_val_t &val)
+{
+    // The type of the value has already been checked against the attribute, a null value is always valid
+    return (val.is_nullable() && val.is_null()) || bounds.compare(val.val, bounds) == 0;
+}
+
+static esp_err_t bound_attribute_val(_attribute_t *attribute)
+{
+    esp_matter_attr_val_t val(attribute->attribute_val_type, attribute->attribute_val);
+    if (val.is_null()) {
+        return ESP_OK;
     }
-    case ESP_MATTER_VAL_TYPE_UINT64: {
-        if (val.val.u64 < bounds.min.val.u64) {
-            return -1;
-        } else if (val.val.u64 > bounds.max.val.u64) {
-            return 1;
-        }
-        return 0;
+    const bounds_t *bounds = attribute->bounds;
+    int compare_result = bounds->compare(attribute->attribute_val, *bounds);
+    if (compare_result != 0) {
+        esp_matter_val_t min, max;
+        bounds->get(*bounds, min, max);
+        attribute->attribute_val = compare_result > 0 ? max : min;
     }
-    case ESP_MATTER_VAL_TYPE_INT8: {
-        if (val.val.i8 < bounds.min.val.i8) {
-            return -1;
-        } else if (val.val.i8 > bounds.max.val.i8) {
-            return 1;
-        }
-        return 0;
+    return ESP_OK;
+}
+
+static bool is_string_type(esp_matter_val_type_t type)
+{
+    return type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
+           type == ESP_MATTER_VAL_TYPE_OCTET_STRING || type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING;
+}
+
+static size_t get_attribute_size(uint16_t flags, esp_matter_val_type_t type)
+{
+    // For attribute managed internally, only the _attribute_base_t part is allocated.
+    if (flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+        return sizeof(_attribute_base_t);
     }
-    case ESP_MATTER_VAL_TYPE_INT16: {
-        if (val.val.i16 < bounds.min.val.i16) {
-            return -1;
-        } else if (val.val.i16 > bounds.max.val.i16) {
-            return 1;
-        }
-        return 0;
+    return sizeof(_attribute_t) + (is_string_type(type) ? k_inline_string_size : 0);
+}
+
+static uint8_t *get_inline_string_buffer(_attribute_t *attribute)
+{
+    return reinterpret_cast<uint8_t *>(attribute + 1);
+}
+
+static void free_string_buffer(_attribute_t *attribute)
+{
+    if (attribute->string_capacity > k_inline_string_size) {
+        esp_matter_mem_free(attribute->attribute_val.a.b);
     }
-    case ESP_MATTER_VAL_TYPE_INT32: {
-        if (val.val.i32 < bounds.min.val.i32) {
-            return -1;
-        } else if (val.val.i32 > bounds.max.val.i32) {
-            return 1;
+    attribute->attribute_val.a.b = nullptr;
+    attribute->string_capacity = k_inline_string_size;
+}
+
+// Stores a non-null string value. The current buffer is reused if the value fits in it, a larger one is allocated
+// only when the value grows beyond its capacity.
+static esp_err_t set_string_val(_attribute_t *attribute, const esp_matter_attr_val_t *val)
+{
+    bool null_reserve = val->type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING;
+    uint16_t required = val->val.a.s + (null_reserve ? 1 : 0);
+    uint8_t *buf = attribute->attribute_val.a.b;
+    if (required > attribute->string_capacity) {
+        buf = (uint8_t *)esp_matter_mem_calloc(1, required);
+        VerifyOrReturnError(buf, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Could not allocate new buffer"));
+        memcpy(buf, val->val.a.b, val->val.a.s);
+        free_string_buffer(attribute);
+        attribute->string_capacity = required;
+    } else {
+        if (attribute->string_capacity <= k_inline_string_size) {
+            buf = get_inline_string_buffer(attribute);
         }
-        return 0;
+        memmove(buf, val->val.a.b, val->val.a.s);
     }
-    case ESP_MATTER_VAL_TYPE_INT64: {
-        if (val.val.i64 < bounds.min.val.i64) {
-            return -1;
-        } else if (val.val.i64 > bounds.max.val.i64) {
-            return 1;
-        }
-        return 0;
+    if (null_reserve) {
+        buf[val->val.a.s] = 0;
     }
-    case ESP_MATTER_VAL_TYPE_FLOAT: {
-        if (val.val.f < bounds.min.val.f) {
-            return -1;
-        } else if (val.val.f > bounds.max.val.f) {
-            return 1;
+    attribute->attribute_val.a.b = buf;
+    attribute->attribute_val.a.s = val->val.a.s;
+    attribute->attribute_val.a.t = val->val.a.t;
+    return ESP_OK;
+}
+
+namespace {
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+uint32_t s_background_restore_clusters[CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT];
+size_t s_background_restore_cluster_count = 0;
+bool s_background_restore_scheduled = false;
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+} // namespace
+
+static bool is_background_restore_cluster(uint32_t cluster_id)
+{
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+    for (size_t index = 0; index < s_background_restore_cluster_count; ++index) {
+        if (s_background_restore_clusters[index] == cluster_id) {
+            return true;
         }
-        return 0;
     }
-    default:
-        ESP_LOGE(TAG, "Failed to compare_attr_val_with_bounds as the attribute value type is wrong");
-        break;
-    }
-    return -2;
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+    return false;
 }
 
-static esp_err_t bound_attribute_val(attribute_t *attribute)
+// Reads the stored value of a non-volatile attribute into its storage, returns true if a value was restored
+static bool restore_val_from_nvs(_attribute_t *attribute)
 {
-    _attribute_t *current_attribute = (_attribute_t *)attribute;
     esp_matter_attr_val_t temp_val;
-    temp_val.type = current_attribute->attribute_val_type;
-    temp_val.val = current_attribute->attribute_val;
-    int compare_result = compare_attr_val_with_bounds(temp_val, *current_attribute->bounds);
-    if (compare_result == 1) {
-        current_attribute->attribute_val = current_attribute->bounds->max.val;
-    } else if (compare_result == -1) {
-        current_attribute->attribute_val = current_attribute->bounds->min.val;
-    } else if (compare_result != 0) {
-        return ESP_ERR_INVALID_ARG;
+    temp_val.type = attribute->attribute_val_type;
+    if (is_string_type(attribute->attribute_val_type)) {
+        temp_val.val.a.max = attribute->attribute_val.a.max;
+        temp_val.val.a.s = 0;
+        temp_val.val.a.t = 0;
+    }
+    const _cluster_t *parent_cluster = attribute->parent_cluster;
+    esp_err_t err =
+        get_val_from_nvs(parent_cluster->endpoint_id, parent_cluster->cluster_id, attribute->attribute_id, temp_val);
+    VerifyOrReturnValue(err == ESP_OK, false);
+    if (is_string_type(attribute->attribute_val_type)) {
+        // Move the restored value into the attribute buffer
+        if (temp_val.val.a.b) {
+            err = set_string_val(attribute, &temp_val);
+            esp_matter_mem_free(temp_val.val.a.b);
+        } else {
+            attribute->attribute_val.a.s = temp_val.val.a.s;
+            attribute->attribute_val.a.t = temp_val.val.a.t;
+        }
+        return err == ESP_OK;
     }
-    return ESP_OK;
+    attribute->attribute_val = temp_val.val;
+    return true;
 }
 
 attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, esp_matter_attr_val_t val,
@@ -494,98 +637,94 @@ attribute_t *create(cluster_t *cluster, uint32_t attribute_id, uint16_t flags, e
                  attribute_id, cluster::get_id(cluster));
         return existing_attribute;
     }
-    _attribute_t *attribute = NULL;
+    /* Create */
+    size_t attribute_size = get_attribute_size(flags, val.type);
+    _attribute_t *attribute = (_attribute_t *)arena::alloc(attribute_size);
+    VerifyOrReturnValue(attribute, NULL, ESP_LOGE(TAG, "Couldn't allocate _attribute_t"));
 
-    if (flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
-        /* Create */
-        attribute = (_attribute_t *)esp_matter_mem_calloc(1, sizeof(_attribute_base_t));
-        if (!attribute) {
-            return nullptr;
-        }
+    /* Index */
+    if (current_cluster->attribute_index.insert(attribute_id, attribute) != ESP_OK) {
+        ESP_LOGE(TAG, "Couldn't index attribute 0x%08" PRIX32, attribute_id);
+        arena::free(attribute, attribute_size);
+        return NULL;
+    }
 
+    if (flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
         /* Set */
         attribute->flags = flags;
         attribute->attribute_val_type = val.type;
         attribute->attribute_id = attribute_id;
+        attribute->parent_cluster = current_cluster;
     } else {
-        attribute = (_attribute_t *)esp_matter_mem_calloc(1, sizeof(_attribute_t));
-        if (!attribute) {
-            return nullptr;
-        }
-
         /* Set */
         attribute->flags = flags;
         attribute->attribute_id = attribute_id;
+        attribute->parent_cluster = current_cluster;
         attribute->override_callback = nullptr;
-        attribute->cluster_id = current_cluster->cluster_id;
-        attribute->endpoint_id = current_cluster->endpoint_id;
         attribute->attribute_val_type = val.type;
-        if (val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
-                val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING || val.type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING) {
+        if (is_string_type(val.type)) {
             attribute->attribute_val.a.max = max_val_size;
+            attribute->string_capacity = k_inline_string_size;
             val.val.a.max = max_val_size;
         }
         bool attribute_updated = false;
-        if (flags & ATTRIBUTE_FLAG_NONVOLATILE) {
+        bool restore_in_background =
+            (flags & ATTRIBUTE_FLAG_NONVOLATILE) && is_background_restore_cluster(current_cluster->cluster_id);
+        if ((flags & ATTRIBUTE_FLAG_NONVOLATILE) && !restore_in_background) {
             // read from the NVS and store in the attribute's storage
-            esp_matter_attr_val_t temp_val;
-            temp_val.type = attribute->attribute_val_type;
-            if (val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
-                    val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING || val.type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING) {
-                temp_val.val.a.max = max_val_size;
-                temp_val.val.a.s = 0;
-                temp_val.val.a.t = 0;
-            }
-            esp_err_t err =
-                get_val_from_nvs(attribute->endpoint_id, attribute->cluster_id, attribute_id, temp_val);
-            if (err == ESP_OK) {
-                attribute->attribute_val = temp_val.val;
-                attribute_updated = true;
-            }
+            boot_profile::scoped_phase phase(boot_profile::PHASE_NVS_RESTORE);
+            attribute_updated = restore_val_from_nvs(attribute);
         }
         if (!attribute_updated) {
+            // The default value of an attribute restored in the background is not stored, it would replace the
+            // stored value before it is restored
+            attribute->flags = restore_in_background ? flags & ~ATTRIBUTE_FLAG_NONVOLATILE : flags;
             set_val_internal((attribute_t *)attribute, &val, false);
+            attribute->flags = flags;
+        }
+        if (restore_in_background) {
+            attribute->restore_pending = true;
+            schedule_background_restore();
         }
     }
 
     /* Add */
     SinglyLinkedList<_attribute_base_t>::append(&current_cluster->attribute_list, attribute);
+    cluster::invalidate_metadata_cache(cluster);
     return (attribute_t *)attribute;
 }
 
-static esp_err_t free_attribute(attribute_t *attribute)
+static esp_err_t free_attribute(attribute_t *attribute, bool erase_nvs)
 {
     VerifyOrReturnError(attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute cannot be NULL"));
     _attribute_t *current_attribute = (_attribute_t *)attribute;
 
     if (current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
         // For attribute managed internally, free as the _attribute_base_t pointer.
-        esp_matter_mem_free((_attribute_base_t *)attribute);
+        arena::free((_attribute_base_t *)attribute, sizeof(_attribute_base_t));
         return ESP_OK;
     }
 
     /* Delete val here, if required */
-    if (current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_CHAR_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING ||
-            current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_ARRAY) {
+    if (is_string_type(current_attribute->attribute_val_type)) {
+        free_string_buffer(current_attribute);
+    } else if (current_attribute->attribute_val_type == ESP_MATTER_VAL_TYPE_ARRAY) {
         /* Free buf */
         esp_matter_mem_free(current_attribute->attribute_val.a.b);
     }
 
-    if (current_attribute->bounds != nullptr) {
-        esp_matter_mem_free(current_attribute->bounds);
-    }
+    free_bounds(current_attribute);
+    report_policy::destroy(current_attribute->report_policy);
 
-    /* Erase the persistent data */
-    if (attribute::get_flags(attribute) & ATTRIBUTE_FLAG_NONVOLATILE) {
-        erase_val_in_nvs(current_attribute->endpoint_id, current_attribute->cluster_id,
-                         current_attribute->attribute_id);
+    /* Erase the persistent data, unless the endpoint is suspended */
+    if (erase_nvs && (attribute::get_flags(attribute) & ATTRIBUTE_FLAG_NONVOLATILE)) {
+        const _cluster_t *parent_cluster = current_attribute->parent_cluster;
+        write_back::discard(parent_cluster->endpoint_id, parent_cluster->cluster_id, current_attribute->attribute_id);
+        erase_val_in_nvs(parent_cluster->endpoint_id, parent_cluster->cluster_id, current_attribute->attribute_id);
     }
 
     /* Free */
-    esp_matter_mem_free(current_attribute);
+    arena::free(current_attribute, get_attribute_size(current_attribute->flags, current_attribute->attribute_val_type));
     return ESP_OK;
 }
 
@@ -602,22 +741,16 @@ esp_err_t destroy(cluster_t *cluster, attribute_t *attribute)
 
     VerifyOrReturnError(*current_attribute, ESP_ERR_NOT_FOUND, ESP_LOGE(TAG, "Attribute not found in the cluster"));
     *current_attribute = target_attribute->next;
-    return free_attribute(attribute);
+    current_cluster->attribute_index.remove(target_attribute->attribute_id);
+    cluster::invalidate_metadata_cache(cluster);
+    return free_attribute(attribute, true);
 }
 
 attribute_t *get(cluster_t *cluster, uint32_t attribute_id)
 {
     VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL."));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
-    _attribute_base_t *current_attribute = current_cluster->attribute_list;
-    while (current_attribute) {
-        if (current_attribute->attribute_id == attribute_id) {
-            break;
-        }
-        current_attribute = current_attribute->next;
-    }
-
-    return (attribute_t *)current_attribute;
+    return (attribute_t *)current_cluster->attribute_index.find(attribute_id);
 }
 
 attribute_t *get(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id)
@@ -650,16 +783,35 @@ uint32_t get_id(attribute_t *attribute)
     return current_attribute->attribute_id;
 }
 
-constexpr uint16_t k_deferred_attribute_persistence_time_ms = CONFIG_ESP_MATTER_DEFERRED_ATTR_PERSISTENCE_TIME_MS;
+constexpr uint32_t k_deferred_attribute_persistence_time_ms = CONFIG_ESP_MATTER_DEFERRED_ATTR_PERSISTENCE_TIME_MS;
 
-static void deferred_attribute_write(chip::System::Layer *layer, void *attribute_ptr)
+esp_err_t validate_val(attribute_t *attribute, esp_matter_attr_val_t *val)
 {
-    _attribute_t *current_attribute = (_attribute_t *)attribute_ptr;
-    ESP_LOGI(TAG, "Store the deferred attribute 0x%" PRIx32 " of cluster 0x%" PRIX32 " on endpoint 0x%" PRIx16,
-             current_attribute->attribute_id, current_attribute->cluster_id, current_attribute->endpoint_id);
-    const esp_matter_attr_val_t new_val(current_attribute->attribute_val_type, current_attribute->attribute_val);
-    store_val_in_nvs(current_attribute->endpoint_id, current_attribute->cluster_id, current_attribute->attribute_id,
-                     new_val);
+    VerifyOrReturnError(attribute && val, ESP_ERR_INVALID_ARG);
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+
+    VerifyOrReturnError(current_attribute->attribute_val_type == val->type, ESP_ERR_INVALID_ARG,
+                        ESP_LOGE(TAG, "Different value type : Expected Type : %u Attempted Type: %u",
+                                 current_attribute->attribute_val_type, val->type));
+    if (current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+        // The bounds and the buffer of these attributes are owned by the cluster implementation
+        return ESP_OK;
+    }
+
+    if ((current_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) && current_attribute->bounds) {
+        VerifyOrReturnError(is_within_bounds(*current_attribute->bounds, *val), ESP_ERR_INVALID_ARG);
+    }
+    if (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
+            val->type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING) {
+        uint16_t null_len =
+            (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING)
+            ? UINT8_MAX
+            : UINT16_MAX;
+        if (val->val.a.s != null_len && val->val.a.s > current_attribute->attribute_val.a.max) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    return ESP_OK;
 }
 
 esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, bool call_callbacks)
@@ -670,19 +822,17 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
     ESP_RETURN_ON_FALSE(!(current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), ESP_ERR_NOT_SUPPORTED, TAG,
                         "Attribute is not managed by esp matter data model");
 
-    // As we know that this is esp-matter managed attribute, we can safely log the path
-    ESP_LOGD(TAG, "setting attribute value for: 0x%x:0x%" PRIx32 ":0x%" PRIx32, current_attribute->endpoint_id,
-             current_attribute->cluster_id, current_attribute->attribute_id);
+    // The path is recovered from the parent cluster
+    uint16_t endpoint_id = current_attribute->parent_cluster->endpoint_id;
+    uint32_t cluster_id = current_attribute->parent_cluster->cluster_id;
+    ESP_LOGD(TAG, "setting attribute value for: 0x%x:0x%" PRIx32 ":0x%" PRIx32, endpoint_id, cluster_id,
+             current_attribute->attribute_id);
 
-    VerifyOrReturnError(current_attribute->attribute_val_type == val->type, ESP_ERR_INVALID_ARG,
-                        ESP_LOGE(TAG, "Different value type : Expected Type : %u Attempted Type: %u",
-                                 current_attribute->attribute_val_type, val->type));
+    esp_err_t err = validate_val(attribute, val);
+    VerifyOrReturnError(err == ESP_OK, err);
+    // The value set now is newer than the one waiting for the background restore
+    current_attribute->restore_pending = false;
 
-    if ((current_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX) && current_attribute->bounds) {
-        if (compare_attr_val_with_bounds(*val, *current_attribute->bounds) != 0) {
-            return ESP_ERR_INVALID_ARG;
-        }
-    }
     esp_matter_attr_val_t temp_val;
     temp_val.type = current_attribute->attribute_val_type;
     temp_val.val = current_attribute->attribute_val;
@@ -692,9 +842,9 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
     }
     /* Callback to application */
     if (call_callbacks) {
-        ESP_RETURN_ON_ERROR(execute_callback(attribute::PRE_UPDATE, current_attribute->endpoint_id,
-                                             current_attribute->cluster_id, current_attribute->attribute_id, val),
-                            TAG, "Failed to execute pre update callback");
+        ESP_RETURN_ON_ERROR(
+            execute_callback(attribute::PRE_UPDATE, endpoint_id, cluster_id, current_attribute->attribute_id, val),
+            TAG, "Failed to execute pre update callback");
     }
     // TODO: call pre attribute change function is the cluster has the flag
     if (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
@@ -703,27 +853,13 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
             (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING)
             ? UINT8_MAX
             : UINT16_MAX;
-        if (val->val.a.s > 0) {
-            uint8_t *new_buf = nullptr;
-            if (val->val.a.s != null_len) {
-                if (val->val.a.s > current_attribute->attribute_val.a.max) {
-                    return ESP_ERR_NO_MEM;
-                }
-                /* Free old buf */
-                esp_matter_mem_free(current_attribute->attribute_val.a.b);
-                current_attribute->attribute_val.a.b = nullptr;
-
-                bool null_reserve =
-                    val->type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING;
-                /* Alloc new buf */
-                new_buf = (uint8_t *)esp_matter_mem_calloc(1, val->val.a.s + (null_reserve ? 1 : 0));
-                VerifyOrReturnError(new_buf, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Could not allocate new buffer"));
-                /* Copy to new buf and assign */
-                memcpy(new_buf, val->val.a.b, val->val.a.s);
-            }
-            current_attribute->attribute_val.a.b = new_buf;
+        if (val->val.a.s == null_len) {
+            free_string_buffer(current_attribute);
             current_attribute->attribute_val.a.s = val->val.a.s;
             current_attribute->attribute_val.a.t = val->val.a.t;
+        } else if (val->val.a.s > 0) {
+            esp_err_t err = set_string_val(current_attribute, val);
+            VerifyOrReturnError(err == ESP_OK, err);
         } else {
             ESP_LOGD(TAG, "Set val called with string with size 0");
         }
@@ -732,34 +868,36 @@ esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, b
     }
     /* Callback to application */
     if (call_callbacks) {
-        execute_callback(attribute::POST_UPDATE, current_attribute->endpoint_id, current_attribute->cluster_id,
-                         current_attribute->attribute_id, val);
+        execute_callback(attribute::POST_UPDATE, endpoint_id, cluster_id, current_attribute->attribute_id, val);
     }
 
     // This ember attribute callback should be called anyway
     // TODO: remove the ember attribute change function
-    cluster_t *cluster = cluster::get(current_attribute->endpoint_id, current_attribute->cluster_id);
+    cluster_t *cluster = (cluster_t *)current_attribute->parent_cluster;
     cluster::function_attribute_change_t attr_change_function =
         (cluster::function_attribute_change_t)cluster::get_function(cluster, CLUSTER_FLAG_ATTRIBUTE_CHANGED_FUNCTION);
 
     if (attr_change_function) {
-        attr_change_function(chip::app::ConcreteAttributePath(
-                                 current_attribute->endpoint_id, current_attribute->cluster_id, current_attribute->attribute_id));
+        attr_change_function(chip::app::ConcreteAttributePath(endpoint_id, cluster_id, current_attribute->attribute_id));
     }
 
     if (current_attribute->flags & ATTRIBUTE_FLAG_NONVOLATILE) {
         if (current_attribute->flags & ATTRIBUTE_FLAG_DEFERRED) {
-            if (!chip::DeviceLayer::SystemLayer().IsTimerActive(deferred_attribute_write, current_attribute)) {
-                auto &system_layer = chip::DeviceLayer::SystemLayer();
-                system_layer.StartTimer(chip::System::Clock::Milliseconds16(k_deferred_attribute_persistence_time_ms),
-                                        deferred_attribute_write, current_attribute);
-            }
+            write_back::enqueue(endpoint_id, cluster_id, current_attribute->attribute_id,
+                                k_deferred_attribute_persistence_time_ms);
+        } else if (write_back::in_batch()) {
+            // Written together with the other attributes of the batch when it ends
+            write_back::enqueue(endpoint_id, cluster_id, current_attribute->attribute_id, 0);
         } else {
+#if CONFIG_ESP_MATTER_NVS_WRITE_BACK_ALL_ATTRIBUTES
+            write_back::enqueue(endpoint_id, cluster_id, current_attribute->attribute_id,
+                                CONFIG_ESP_MATTER_NVS_WRITE_BACK_TIME_MS);
+#else
             esp_matter_attr_val_t temp_val;
             temp_val.type = current_attribute->attribute_val_type;
             temp_val.val = current_attribute->attribute_val;
-            store_val_in_nvs(current_attribute->endpoint_id, current_attribute->cluster_id,
-                             current_attribute->attribute_id, temp_val);
+            store_val_in_nvs(endpoint_id, cluster_id, current_attribute->attribute_id, temp_val);
+#endif // CONFIG_ESP_MATTER_NVS_WRITE_BACK_ALL_ATTRIBUTES
         }
     }
 
@@ -848,37 +986,76 @@ static esp_err_t get_val_from_tlv_data(const uint8_t *tlv_data, uint32_t tlv_len
     return ESP_OK;
 }
 
-// Helper function to find the cluster_id and attribute_id for internally managed attributes
-static esp_err_t find_cluster_and_endpoint_id_for_internally_managed_attribute(const _attribute_base_t *attribute_base,
-                                                                               uint16_t &out_endpoint_id,
-                                                                               uint32_t &out_cluster_id)
+// The value of an esp-matter managed attribute can be copied from the esp-matter storage if no server cluster
+// instance or AttributeAccessInterface registered for the cluster can override it in ReadAttribute.
+static bool can_read_from_storage(uint16_t endpoint_id, uint32_t cluster_id, const _attribute_t *attribute)
+{
+    if (attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+        return false;
+    }
+    chip::app::ConcreteClusterPath cluster_path(endpoint_id, cluster_id);
+    if (esp_matter::data_model::provider::get_instance().registry().Get(cluster_path) != nullptr) {
+        return false;
+    }
+    return chip::app::AttributeAccessInterfaceRegistry::Instance().Get(endpoint_id, cluster_id) == nullptr;
+}
+
+// Copy the attribute value from the esp-matter storage. Like get_val_from_tlv_data(), the string buffers are
+// copied and owned by the caller, primitive values do not need any allocation.
+static esp_err_t get_val_from_storage(const _attribute_t *attribute, esp_matter_attr_val_t *val)
 {
-    VerifyOrReturnError(attribute_base, ESP_ERR_INVALID_ARG);
-    _node_t *node = (_node_t *)node::get();
-    VerifyOrReturnError(node, ESP_ERR_INVALID_STATE);
+    val->type = attribute->attribute_val_type;
+    val->val = attribute->attribute_val;
 
-    // This is a linear search and it's not efficient, but we don't have a better way to do it right now.
-    for (_endpoint_t *endpoint = node->endpoint_list; endpoint != nullptr; endpoint = endpoint->next) {
-        for (_cluster_t *cluster = endpoint->cluster_list; cluster != nullptr; cluster = cluster->next) {
-            for (_attribute_base_t *attr = cluster->attribute_list; attr != nullptr; attr = attr->next) {
-                if (attr == attribute_base) {
-                    out_endpoint_id = endpoint->endpoint_id;
-                    out_cluster_id = cluster::get_id((cluster_t *)cluster);
-                    return ESP_OK;
-                }
-            }
+    bool is_type_string = (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING
+                           || val->type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING);
+    bool is_type_octet_string = (val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING
+                                 || val->type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING);
+    if (!is_type_string && !is_type_octet_string) {
+        return ESP_OK;
+    }
+
+    bool is_short = (val->type == ESP_MATTER_VAL_TYPE_CHAR_STRING || val->type == ESP_MATTER_VAL_TYPE_OCTET_STRING);
+    uint16_t null_len = is_short ? UINT8_MAX : UINT16_MAX;
+    if (attribute->attribute_val.a.b == nullptr && attribute->attribute_val.a.s == null_len) {
+        // nullable string with null value
+        val->val.a.t = null_len;
+        return ESP_OK;
+    }
+
+    uint16_t len = attribute->attribute_val.a.b ? attribute->attribute_val.a.s : 0;
+    val->val.a.s = len;
+    val->val.a.t = len + (is_short ? 1 : 2);
+    val->val.a.b = nullptr;
+    // for empty strings, we need to copy at least null terminator
+    uint32_t bytes_to_copy = (is_type_string ? len + 1 : len);
+    if (bytes_to_copy > 0) {
+        uint8_t *new_buf = (uint8_t *)esp_matter_mem_calloc(sizeof(uint8_t), bytes_to_copy);
+        VerifyOrReturnError(new_buf != nullptr, ESP_ERR_NO_MEM);
+        if (len > 0) {
+            memcpy(new_buf, attribute->attribute_val.a.b, len);
         }
+        val->val.a.b = new_buf; // new buffer is now owned by the caller
     }
-    return ESP_ERR_NOT_FOUND;
+    return ESP_OK;
 }
 
 esp_err_t get_val(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t *val)
 {
     VerifyOrReturnError(val, ESP_ERR_INVALID_ARG);
-    esp_matter_val_type_t val_type = get_val_type(endpoint_id, cluster_id, attribute_id);
+    attribute_t *attribute = get(endpoint_id, cluster_id, attribute_id);
+    esp_matter_val_type_t val_type = get_val_type(attribute);
     VerifyOrReturnError(val_type != ESP_MATTER_VAL_TYPE_INVALID, ESP_ERR_INVALID_ARG);
     VerifyOrReturnError(val_type != ESP_MATTER_VAL_TYPE_ARRAY, ESP_ERR_NOT_SUPPORTED);
 
+    // Fast path: serve the esp-matter managed attributes directly from the storage without the TLV round trip
+    if (can_read_from_storage(endpoint_id, cluster_id, (_attribute_t *)attribute)) {
+        return get_val_from_storage((_attribute_t *)attribute, val);
+    }
+
+    // Slow path: the attribute is managed by connectedhomeip or its read might be overridden by a cluster
+    // implementation, so read it through the data model provider.
+
     chip::Platform::ScopedMemoryBuffer<uint8_t> scoped_buf;
     scoped_buf.Calloc(k_max_tlv_size_to_read_attribute_value);
     if (scoped_buf.IsNull()) {
@@ -918,15 +1095,11 @@ esp_err_t get_val(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_
 static esp_err_t get_path_from_attribute_handle(const _attribute_t *attribute, uint16_t &endpoint_id,
                                                 uint32_t &cluster_id, uint32_t &attribute_id)
 {
+    // The path of all the attributes is recovered from the parent cluster
+    VerifyOrReturnError(attribute->parent_cluster, ESP_ERR_NOT_FOUND);
     attribute_id = attribute->attribute_id;
-    if (attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
-        // for connectedhomeip managed attributes, we need to find the cluster and endpoint id
-        return find_cluster_and_endpoint_id_for_internally_managed_attribute(attribute, endpoint_id, cluster_id);
-    }
-
-    // in case of esp-matter managed attributes, we can directly use the endpoint and cluster id
-    endpoint_id = attribute->endpoint_id;
-    cluster_id = attribute->cluster_id;
+    endpoint_id = attribute->parent_cluster->endpoint_id;
+    cluster_id = attribute->parent_cluster->cluster_id;
     return ESP_OK;
 }
 
@@ -945,6 +1118,43 @@ esp_err_t get_val(attribute_t *attribute, esp_matter_attr_val_t *val)
     return get_val(endpoint_id, cluster_id, attribute_id, val);
 }
 
+static esp_err_t get_stored_string(attribute_t *attribute, bool char_string, chip::ByteSpan &span)
+{
+    VerifyOrReturnError(attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute cannot be NULL"));
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+    esp_matter_val_type_t type = current_attribute->attribute_val_type;
+    bool type_matches = char_string
+                        ? (type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING)
+                        : (type == ESP_MATTER_VAL_TYPE_OCTET_STRING || type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING);
+    VerifyOrReturnError(type_matches, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute type does not match the span"));
+
+    uint16_t endpoint_id = chip::kInvalidEndpointId;
+    uint32_t cluster_id = chip::kInvalidClusterId;
+    uint32_t attribute_id = chip::kInvalidAttributeId;
+    esp_err_t err = get_path_from_attribute_handle(current_attribute, endpoint_id, cluster_id, attribute_id);
+    VerifyOrReturnError(err == ESP_OK, err);
+    VerifyOrReturnError(can_read_from_storage(endpoint_id, cluster_id, current_attribute), ESP_ERR_NOT_SUPPORTED);
+
+    // A null value has no buffer
+    const esp_matter_val_t &stored = current_attribute->attribute_val;
+    span = stored.a.b ? chip::ByteSpan(stored.a.b, stored.a.s) : chip::ByteSpan();
+    return ESP_OK;
+}
+
+esp_err_t get_val_span(attribute_t *attribute, chip::CharSpan &span)
+{
+    chip::ByteSpan bytes;
+    esp_err_t err = get_stored_string(attribute, true, bytes);
+    VerifyOrReturnError(err == ESP_OK, err);
+    span = chip::CharSpan(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+    return ESP_OK;
+}
+
+esp_err_t get_val_span(attribute_t *attribute, chip::ByteSpan &span)
+{
+    return get_stored_string(attribute, false, span);
+}
+
 esp_err_t get_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val)
 {
     VerifyOrReturnError(attribute && val, ESP_ERR_INVALID_ARG);
@@ -952,7 +1162,7 @@ esp_err_t get_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val)
 
     ESP_RETURN_ON_FALSE(!(current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), ESP_ERR_NOT_SUPPORTED, TAG,
                         "Attribute is not managed by esp matter data model");
-    memcpy((void *)&val->type, (void *)&current_attribute->attribute_val_type, sizeof(esp_matter_val_type_t));
+    val->type = current_attribute->attribute_val_type;
     memcpy((void *)&val->val, (void *)&current_attribute->attribute_val, sizeof(esp_matter_val_t));
     return ESP_OK;
 }
@@ -1083,17 +1293,31 @@ esp_err_t add_bounds(attribute_t *attribute, esp_matter_attr_val_t min, esp_matt
                         ESP_ERR_INVALID_ARG,
                         ESP_LOGE(TAG, "Cannot set bounds because of val type mismatch: expected: %d, min: %d, max: %d",
                                  current_attribute->attribute_val_type, min.type, max.type));
-    if (current_attribute->bounds == nullptr) {
-        current_attribute->bounds = (esp_matter_attr_bounds_t *)esp_matter_mem_calloc(1, sizeof(esp_matter_attr_bounds_t));
-        if (current_attribute->bounds == nullptr) {
-            ESP_LOGE(TAG, "Failed to allocate bounds for attribute");
-            return ESP_ERR_NO_MEM;
-        }
-    }
+    const bounds_t *bounds = create_bounds(min.get_storage_type(), min.val, max.val);
+    VerifyOrReturnError(bounds, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Failed to allocate bounds for attribute"));
+    free_bounds(current_attribute);
+    current_attribute->flags |= ATTRIBUTE_FLAG_MIN_MAX;
+    current_attribute->bounds = bounds;
+    return bound_attribute_val(current_attribute);
+}
+
+esp_err_t add_bounds(attribute_t *attribute, const bounds_t *bounds)
+{
+    VerifyOrReturnError(attribute && bounds, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute or bounds cannot be NULL"));
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+
+    ESP_RETURN_ON_FALSE(!(current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), ESP_ERR_NOT_SUPPORTED, TAG,
+                        "Attribute is not managed by esp matter data model");
+
+    // Only the numeric types have bounds, so this also rejects the string/array/boolean type attributes
+    esp_matter_attr_val_t val(current_attribute->attribute_val_type, current_attribute->attribute_val);
+    VerifyOrReturnError(val.get_storage_type() == bounds->storage_type, ESP_ERR_INVALID_ARG,
+                        ESP_LOGE(TAG, "Cannot set bounds because of val type mismatch: expected: %d, bounds: %d",
+                                 val.get_storage_type(), bounds->storage_type));
+    free_bounds(current_attribute);
     current_attribute->flags |= ATTRIBUTE_FLAG_MIN_MAX;
-    current_attribute->bounds->min = min;
-    current_attribute->bounds->max = max;
-    return bound_attribute_val(attribute);
+    current_attribute->bounds = bounds;
+    return bound_attribute_val(current_attribute);
 }
 
 esp_err_t get_bounds(attribute_t *attribute, esp_matter_attr_bounds_t *bounds)
@@ -1111,10 +1335,13 @@ esp_err_t get_bounds(attribute_t *attribute, esp_matter_attr_bounds_t *bounds)
     if (!(current_attribute->flags & ATTRIBUTE_FLAG_MIN_MAX)) {
         ESP_LOGW(TAG,
                  "Endpoint 0x%04" PRIX16 "'s Cluster 0x%08" PRIX32 "'s Attribute 0x%08" PRIX32 " has not set bounds",
-                 current_attribute->endpoint_id, current_attribute->cluster_id, current_attribute->attribute_id);
+                 current_attribute->parent_cluster->endpoint_id, current_attribute->parent_cluster->cluster_id,
+                 current_attribute->attribute_id);
         return ESP_ERR_INVALID_ARG;
     }
-    *bounds = *current_attribute->bounds;
+    bounds->min.type = current_attribute->attribute_val_type;
+    bounds->max.type = current_attribute->attribute_val_type;
+    current_attribute->bounds->get(*current_attribute->bounds, bounds->min.val, bounds->max.val);
     return ESP_OK;
 }
 
@@ -1175,34 +1402,233 @@ esp_err_t set_deferred_persistence(attribute_t *attribute)
     return ESP_OK;
 }
 
+esp_err_t flush_deferred_persistence()
+{
+    esp_matter::lock::ScopedChipStackLock lock(portMAX_DELAY);
+    return write_back::flush();
+}
+
+esp_err_t set_report_policy(attribute_t *attribute, const report_policy_t *policy)
+{
+    VerifyOrReturnError(attribute, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Attribute cannot be NULL"));
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+
+    ESP_RETURN_ON_FALSE(!(current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), ESP_ERR_NOT_SUPPORTED, TAG,
+                        "Attribute is not managed by esp matter data model");
+
+    report_policy::state_t *state = nullptr;
+    if (policy) {
+        const _cluster_t *parent_cluster = current_attribute->parent_cluster;
+        state = report_policy::create(parent_cluster->endpoint_id, parent_cluster->cluster_id,
+                                      current_attribute->attribute_id, *policy);
+        VerifyOrReturnError(state, ESP_ERR_NO_MEM);
+    }
+    report_policy::destroy(current_attribute->report_policy);
+    current_attribute->report_policy = state;
+    return ESP_OK;
+}
+
+esp_err_t set_background_restore(uint32_t cluster_id)
+{
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+    VerifyOrReturnError(!is_background_restore_cluster(cluster_id), ESP_OK);
+    VerifyOrReturnError(s_background_restore_cluster_count < CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT,
+                        ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Too many clusters restored in the background"));
+    s_background_restore_clusters[s_background_restore_cluster_count++] = cluster_id;
+    return ESP_OK;
+#else
+    return ESP_ERR_NO_MEM;
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+}
+
+bool is_restore_pending(attribute_t *attribute)
+{
+    VerifyOrReturnValue(attribute, false);
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+    VerifyOrReturnValue(!(current_attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), false);
+    return current_attribute->restore_pending;
+}
+
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+// Restores the pending attributes of the cluster within the budget, returns false if some are left
+static bool restore_cluster_in_background(_cluster_t *cluster, uint32_t &budget)
+{
+    for (_attribute_base_t *base = cluster->attribute_list; base; base = base->next) {
+        if (base->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+            continue;
+        }
+        _attribute_t *attribute = (_attribute_t *)base;
+        if (!attribute->restore_pending) {
+            continue;
+        }
+        VerifyOrReturnValue(budget > 0, false);
+        budget--;
+        attribute->restore_pending = false;
+        if (restore_val_from_nvs(attribute)) {
+            MatterReportingAttributeChangeCallback(cluster->endpoint_id, cluster->cluster_id, attribute->attribute_id);
+        } else {
+            // Nothing stored yet, store the default value as create() does for the other clusters
+            write_back::enqueue(cluster->endpoint_id, cluster->cluster_id, attribute->attribute_id, 0);
+        }
+    }
+    return true;
+}
+
+static void background_restore_work(intptr_t arg)
+{
+    boot_profile::scoped_phase phase(boot_profile::PHASE_BACKGROUND_RESTORE);
+    s_background_restore_scheduled = false;
+    uint32_t budget = CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_BATCH_SIZE;
+    bool done = true;
+    // The default values of the attributes not found are stored with one commit, after the reads
+    write_back::begin_batch();
+    begin_nvs_restore();
+    for (endpoint_t *endpoint = endpoint::get_first(node::get()); endpoint && done;
+            endpoint = endpoint::get_next(endpoint)) {
+        for (cluster_t *cluster = cluster::get_first(endpoint); cluster && done; cluster = cluster::get_next(cluster)) {
+            if (is_background_restore_cluster(cluster::get_id(cluster))) {
+                done = restore_cluster_in_background((_cluster_t *)cluster, budget);
+            }
+        }
+    }
+    end_nvs_restore();
+    write_back::end_batch();
+    if (!done) {
+        // Give the Matter thread back to the other events before the next batch
+        schedule_background_restore();
+    }
+}
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+
+void schedule_background_restore()
+{
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+    VerifyOrReturn(s_background_restore_cluster_count > 0 && esp_matter::is_started() &&
+                   !s_background_restore_scheduled);
+    if (chip::DeviceLayer::PlatformMgr().ScheduleWork(background_restore_work) == CHIP_NO_ERROR) {
+        s_background_restore_scheduled = true;
+    } else {
+        ESP_LOGE(TAG, "Failed to schedule the background restore");
+    }
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+}
+
+static bool is_report_held_back(_attribute_t *attribute)
+{
+    VerifyOrReturnValue(attribute, false);
+    VerifyOrReturnValue(!(attribute->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY), false);
+    VerifyOrReturnValue(attribute->report_policy, false);
+
+    esp_matter_attr_val_t val;
+    val.type = attribute->attribute_val_type;
+    val.val = attribute->attribute_val;
+    return !report_policy::should_report(attribute->report_policy, val);
+}
+
+bool should_report_change(attribute_t *attribute)
+{
+    _attribute_t *current_attribute = (_attribute_t *)attribute;
+    VerifyOrReturnValue(is_report_held_back(current_attribute), true);
+    // Only the report is held back, the reads and the data version filters of the clients see the new value at once
+    cluster::increase_data_version((cluster_t *)current_attribute->parent_cluster);
+    return false;
+}
+
+bool should_report_batched_change(attribute_t *attribute)
+{
+    return !is_report_held_back((_attribute_t *)attribute);
+}
+
 } // namespace attribute
 
 namespace command {
-command_t *create(cluster_t *cluster, uint32_t command_id, uint8_t flags, callback_t callback)
+static bool is_dynamic(const _command_t *command)
+{
+    return (uintptr_t)command->descriptor == (uintptr_t)command + offsetof(_dynamic_command_t, descriptor);
+}
+
+static void free_command(_command_t *command)
+{
+    arena::free(command, is_dynamic(command) ? sizeof(_dynamic_command_t) : sizeof(_command_t));
+}
+
+static command_t *add(cluster_t *cluster, _command_t *command)
 {
-    /* Find */
-    VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL."));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
+    const descriptor_t *descriptor = command->descriptor;
+
+    /* Index */
+    if ((descriptor->flags & COMMAND_FLAG_ACCEPTED) &&
+        current_cluster->accepted_command_index.insert(descriptor->command_id, command) != ESP_OK) {
+        ESP_LOGE(TAG, "Couldn't index command 0x%08" PRIX32, descriptor->command_id);
+        free_command(command);
+        return NULL;
+    }
+
+    /* Add */
+    SinglyLinkedList<_command_t>::append(&current_cluster->command_list, command);
+    cluster::invalidate_metadata_cache(cluster);
+    return (command_t *)command;
+}
+
+static command_t *get_existing(cluster_t *cluster, uint32_t command_id, uint16_t flags)
+{
     command_t *existing_command = get(cluster, command_id, flags);
     if (existing_command) {
         ESP_LOGW(TAG, "Command 0x%08" PRIX32 " on cluster 0x%08" PRIX32 " already exists. Not creating again.",
                  command_id, cluster::get_id(cluster));
-        return existing_command;
     }
+    return existing_command;
+}
+
+command_t *create(cluster_t *cluster, uint32_t command_id, uint8_t flags, callback_t callback)
+{
+    /* Find */
+    VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL."));
+    command_t *existing_command = get_existing(cluster, command_id, flags);
+    VerifyOrReturnValue(!existing_command, existing_command);
+
+    /* Allocate */
+    _dynamic_command_t *command = (_dynamic_command_t *)arena::alloc(sizeof(_dynamic_command_t));
+    VerifyOrReturnValue(command, NULL, ESP_LOGE(TAG, "Couldn't allocate _command_t"));
+
+    /* Set */
+    command->descriptor.command_id = command_id;
+    command->descriptor.flags = flags;
+    command->descriptor.callback = callback;
+    command->command.descriptor = &command->descriptor;
+    command->command.user_callback = NULL;
+
+    return add(cluster, &command->command);
+}
+
+command_t *create(cluster_t *cluster, const descriptor_t *descriptor)
+{
+    /* Find */
+    VerifyOrReturnValue(cluster && descriptor, NULL, ESP_LOGE(TAG, "Cluster or descriptor cannot be NULL."));
+    command_t *existing_command = get_existing(cluster, descriptor->command_id, descriptor->flags);
+    VerifyOrReturnValue(!existing_command, existing_command);
 
     /* Allocate */
-    _command_t *command = (_command_t *)esp_matter_mem_calloc(1, sizeof(_command_t));
+    _command_t *command = (_command_t *)arena::alloc(sizeof(_command_t));
     VerifyOrReturnValue(command, NULL, ESP_LOGE(TAG, "Couldn't allocate _command_t"));
 
     /* Set */
-    command->command_id = command_id;
-    command->flags = flags;
-    command->callback = callback;
+    command->descriptor = descriptor;
     command->user_callback = NULL;
 
-    /* Add */
-    SinglyLinkedList<_command_t>::append(&current_cluster->command_list, command);
-    return (command_t *)command;
+    return add(cluster, command);
+}
+
+static void unlink(_command_t **head, _command_t *target)
+{
+    _command_t **p = head;
+    while (*p && *p != target) {
+        p = &(*p)->next;
+    }
+    if (*p) {
+        *p = target->next;
+    }
 }
 
 esp_err_t destroy(cluster_t *cluster, command_t *command)
@@ -1210,10 +1636,27 @@ esp_err_t destroy(cluster_t *cluster, command_t *command)
     VerifyOrReturnError(cluster && command, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster or command cannot be NULL"));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
     _command_t *current_command = (_command_t *)command;
-    SinglyLinkedList<_command_t>::remove(&current_cluster->command_list, current_command);
+    uint32_t command_id = current_command->descriptor->command_id;
+    if (current_cluster->accepted_command_index.find(command_id) == current_command) {
+        current_cluster->accepted_command_index.remove(command_id);
+    }
+    unlink(&current_cluster->command_list, current_command);
+    free_command(current_command);
+    cluster::invalidate_metadata_cache(cluster);
     return ESP_OK;
 }
 
+static void delete_list(_command_t **head)
+{
+    _command_t *current = *head;
+    while (current) {
+        _command_t *next = current->next;
+        free_command(current);
+        current = next;
+    }
+    *head = nullptr;
+}
+
 command_t *get(uint16_t endpoint_id, uint32_t cluster_id, uint32_t command_id)
 {
     _cluster_t *current_cluster = (_cluster_t *)cluster::get(endpoint_id, cluster_id);
@@ -1221,7 +1664,7 @@ command_t *get(uint16_t endpoint_id, uint32_t cluster_id, uint32_t command_id)
     _command_t *command = (_command_t *)current_cluster->command_list;
 
     while (command) {
-        if (command->command_id == command_id) {
+        if (command->descriptor->command_id == command_id) {
             break;
         }
         command = command->next;
@@ -1233,9 +1676,13 @@ command_t *get(cluster_t *cluster, uint32_t command_id, uint16_t flags)
 {
     VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL."));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
+    if (flags == COMMAND_FLAG_ACCEPTED) {
+        // Only one accepted command per id can be created, the index holds the one the list walk would find
+        return (command_t *)current_cluster->accepted_command_index.find(command_id);
+    }
     _command_t *current_command = (_command_t *)current_cluster->command_list;
     while (current_command) {
-        if ((current_command->command_id == command_id) && (current_command->flags & flags)) {
+        if ((current_command->descriptor->command_id == command_id) && (current_command->descriptor->flags & flags)) {
             break;
         }
         current_command = current_command->next;
@@ -1261,14 +1708,14 @@ uint32_t get_id(command_t *command)
 {
     VerifyOrReturnValue(command, kInvalidCommandId, ESP_LOGE(TAG, "Command cannot be NULL"));
     _command_t *current_command = (_command_t *)command;
-    return current_command->command_id;
+    return current_command->descriptor->command_id;
 }
 
 callback_t get_callback(command_t *command)
 {
     VerifyOrReturnValue(command, NULL, ESP_LOGE(TAG, "Command cannot be NULL"));
     _command_t *current_command = (_command_t *)command;
-    return current_command->callback;
+    return current_command->descriptor->callback;
 }
 
 callback_t get_user_callback(command_t *command)
@@ -1292,7 +1739,7 @@ uint16_t get_flags(command_t *command)
 {
     VerifyOrReturnValue(command, 0, ESP_LOGE(TAG, "Command cannot be NULL"));
     _command_t *current_command = (_command_t *)command;
-    return current_command->flags;
+    return current_command->descriptor->flags;
 }
 
 } // namespace command
@@ -1312,7 +1759,7 @@ event_t *create(cluster_t *cluster, uint32_t event_id)
     }
 
     /* Allocate */
-    _event_t *event = (_event_t *)esp_matter_mem_calloc(1, sizeof(_event_t));
+    _event_t *event = (_event_t *)arena::alloc(sizeof(_event_t));
     VerifyOrReturnValue(event, NULL, ESP_LOGE(TAG, "Couldn't allocate _event_t"));
 
     /* Set */
@@ -1386,12 +1833,19 @@ cluster_t *create(endpoint_t *endpoint, uint32_t cluster_id, uint8_t flags)
     }
 
     /* Allocate */
-    _cluster_t *cluster = (_cluster_t *)esp_matter_mem_calloc(1, sizeof(_cluster_t));
+    _cluster_t *cluster = (_cluster_t *)arena::alloc(sizeof(_cluster_t));
     if (!cluster) {
         ESP_LOGE(TAG, "Couldn't allocate _cluster_t");
         return NULL;
     }
 
+    /* Index */
+    if (current_endpoint->cluster_index.insert(cluster_id, cluster) != ESP_OK) {
+        ESP_LOGE(TAG, "Couldn't index cluster 0x%08" PRIX32, cluster_id);
+        arena::free(cluster, sizeof(_cluster_t));
+        return NULL;
+    }
+
     /* Set */
     cluster->cluster_id = cluster_id;
     cluster->endpoint_id = current_endpoint->endpoint_id;
@@ -1404,54 +1858,92 @@ cluster_t *create(endpoint_t *endpoint, uint32_t cluster_id, uint8_t flags)
     cluster->plugin_server_init_callback = nullptr;
     cluster->init_callback = nullptr;
     cluster->shutdown_callback = nullptr;
+    cluster->metadata_cache = nullptr;
 
     /* Add */
     SinglyLinkedList<_cluster_t>::append(&current_endpoint->cluster_list, cluster);
     return (cluster_t *)cluster;
 }
 
-esp_err_t destroy(cluster_t *cluster)
+static esp_err_t destroy_cluster(cluster_t *cluster, bool erase_nvs)
 {
     VerifyOrReturnError(cluster, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster cannot be NULL"));
     _cluster_t *current_cluster = (_cluster_t *)cluster;
 
     /* Parse and delete all commands */
-    SinglyLinkedList<_command_t>::delete_list(&current_cluster->command_list);
+    command::delete_list(&current_cluster->command_list);
+    current_cluster->accepted_command_index.clear();
 
     /* Parse and delete all attributes */
     _attribute_base_t *attribute = current_cluster->attribute_list;
     while (attribute) {
         _attribute_base_t *next_attribute = attribute->next;
-        attribute::free_attribute((attribute_t *)attribute);
+        attribute::free_attribute((attribute_t *)attribute, erase_nvs);
         attribute = next_attribute;
     }
+    current_cluster->attribute_list = nullptr;
+    current_cluster->attribute_index.clear();
 
     /* Parse and delete all events */
     SinglyLinkedList<_event_t>::delete_list(&current_cluster->event_list);
+    invalidate_metadata_cache(cluster);
 
     /* Remove from parent endpoint's cluster list and free */
     _endpoint_t *parent_endpoint = (_endpoint_t *)endpoint::get(current_cluster->endpoint_id);
     if (parent_endpoint) {
+        parent_endpoint->cluster_index.remove(current_cluster->cluster_id);
         SinglyLinkedList<_cluster_t>::remove(&parent_endpoint->cluster_list, current_cluster);
     } else {
-        esp_matter_mem_free(current_cluster);
+        arena::free(current_cluster, sizeof(_cluster_t));
     }
     return ESP_OK;
 }
 
+esp_err_t destroy(cluster_t *cluster)
+{
+    return destroy_cluster(cluster, true);
+}
+
+metadata_cache_t *get_metadata_cache(cluster_t *cluster)
+{
+    VerifyOrReturnValue(cluster, NULL, ESP_LOGE(TAG, "Cluster cannot be NULL"));
+    return ((_cluster_t *)cluster)->metadata_cache;
+}
+
+esp_err_t set_metadata_cache(cluster_t *cluster, metadata_cache_t *cache)
+{
+    VerifyOrReturnError(cluster, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Cluster cannot be NULL"));
+    invalidate_metadata_cache(cluster);
+    ((_cluster_t *)cluster)->metadata_cache = cache;
+    return ESP_OK;
+}
+
+static void free_metadata_cache(intptr_t context)
+{
+    esp_matter_mem_free(reinterpret_cast<metadata_cache_t *>(context));
+}
+
+void invalidate_metadata_cache(cluster_t *cluster)
+{
+    VerifyOrReturn(cluster);
+    _cluster_t *current_cluster = (_cluster_t *)cluster;
+    metadata_cache_t *cache = current_cluster->metadata_cache;
+    VerifyOrReturn(cache);
+    current_cluster->metadata_cache = nullptr;
+    // The provider copies the snapshot in the Matter context. Once the stack is started, the snapshot is freed in that
+    // context as well, so a snapshot dropped by another task is never freed while it is being copied.
+    if (esp_matter::is_started() && chip::DeviceLayer::PlatformMgr().ScheduleWork(
+                free_metadata_cache, reinterpret_cast<intptr_t>(cache)) == CHIP_NO_ERROR) {
+        return;
+    }
+    esp_matter_mem_free(cache);
+}
+
 cluster_t *get(endpoint_t *endpoint, uint32_t cluster_id)
 {
     VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
     _endpoint_t *current_endpoint = (_endpoint_t *)endpoint;
-    _cluster_t *current_cluster = (_cluster_t *)current_endpoint->cluster_list;
-
-    while (current_cluster) {
-        if (current_cluster->cluster_id == cluster_id) {
-            break;
-        }
-        current_cluster = current_cluster->next;
-    }
-    return (cluster_t *)current_cluster;
+    return (cluster_t *)current_endpoint->cluster_index.find(cluster_id);
 }
 
 cluster_t *get(uint16_t endpoint_id, uint32_t cluster_id)
@@ -1653,7 +2145,7 @@ endpoint_t *create(node_t *node, uint8_t flags, void *priv_data)
                  CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT));
 
     /* Allocate */
-    _endpoint_t *endpoint = (_endpoint_t *)esp_matter_mem_calloc(1, sizeof(_endpoint_t));
+    _endpoint_t *endpoint = (_endpoint_t *)arena::alloc(sizeof(_endpoint_t));
     VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Couldn't allocate _endpoint_t"));
 
     /* Set */
@@ -1665,6 +2157,14 @@ endpoint_t *create(node_t *node, uint8_t flags, void *priv_data)
     endpoint->composition_pattern = EndpointCompositionPattern::kFullFamily;
     endpoint->semantic_tag_count = 0;
     endpoint->enabled = true;
+
+    /* Index */
+    if (current_node->endpoint_index.insert(endpoint->endpoint_id, endpoint) != ESP_OK) {
+        ESP_LOGE(TAG, "Couldn't index endpoint 0x%04" PRIX16, endpoint->endpoint_id);
+        current_node->min_unused_endpoint_id--;
+        arena::free(endpoint, sizeof(_endpoint_t));
+        return NULL;
+    }
     /* Store */
     if (esp_matter::is_started()) {
         node::store_min_unused_endpoint_id();
@@ -1695,7 +2195,7 @@ endpoint_t *resume(node_t *node, uint8_t flags, uint16_t endpoint_id, void *priv
                         ESP_LOGE(TAG, "The endpoint_id of the resumed endpoint should have been used"));
 
     /* Allocate */
-    _endpoint_t *endpoint = (_endpoint_t *)esp_matter_mem_calloc(1, sizeof(_endpoint_t));
+    _endpoint_t *endpoint = (_endpoint_t *)arena::alloc(sizeof(_endpoint_t));
     VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Couldn't allocate _endpoint_t"));
 
     /* Set */
@@ -1705,6 +2205,13 @@ endpoint_t *resume(node_t *node, uint8_t flags, uint16_t endpoint_id, void *priv
     endpoint->priv_data = priv_data;
     endpoint->composition_pattern = EndpointCompositionPattern::kFullFamily;
 
+    /* Index */
+    if (current_node->endpoint_index.insert(endpoint_id, endpoint) != ESP_OK) {
+        ESP_LOGE(TAG, "Couldn't index endpoint 0x%04" PRIX16, endpoint_id);
+        arena::free(endpoint, sizeof(_endpoint_t));
+        return NULL;
+    }
+
     /* Add */
     if (previous_endpoint == NULL) {
         current_node->endpoint_list = endpoint;
@@ -1715,7 +2222,7 @@ endpoint_t *resume(node_t *node, uint8_t flags, uint16_t endpoint_id, void *priv
     return (endpoint_t *)endpoint;
 }
 
-esp_err_t destroy(node_t *node, endpoint_t *endpoint)
+static esp_err_t destroy_endpoint(node_t *node, endpoint_t *endpoint, bool erase_nvs)
 {
     VerifyOrReturnError((node && endpoint), ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Node or endpoint cannot be NULL"));
     _node_t *current_node = (_node_t *)node;
@@ -1725,8 +2232,10 @@ esp_err_t destroy(node_t *node, endpoint_t *endpoint)
         (_endpoint->flags & ENDPOINT_FLAG_DESTROYABLE), ESP_FAIL,
         ESP_LOGE(TAG, "This endpoint cannot be deleted since the ENDPOINT_FLAG_DESTROYABLE is not set"));
 
-    /* Disable and permanently shut down code-driven cluster callbacks once before cluster metadata is deleted. */
-    shutdown_endpoint_internal(endpoint, chip::app::ClusterShutdownType::kPermanentRemove);
+    /* Disable and shut down code-driven cluster callbacks once before cluster metadata is deleted. The shutdown is
+     * permanent unless the endpoint is suspended, to be resumed later with its persistent data. */
+    shutdown_endpoint_internal(endpoint, erase_nvs ? chip::app::ClusterShutdownType::kPermanentRemove
+                                                   : chip::app::ClusterShutdownType::kClusterShutdown);
 
     /* Find current endpoint */
     _endpoint_t *current_endpoint = current_node->endpoint_list;
@@ -1758,47 +2267,57 @@ esp_err_t destroy(node_t *node, endpoint_t *endpoint)
             }
             cluster = cluster::get_next(cluster);
         }
+        if (!erase_nvs) {
+            /* The queued values are read from the attributes, write them before the attributes are freed */
+            write_back::flush();
+        }
     }
 
     /* Parse and delete all clusters */
     _cluster_t *cluster = current_endpoint->cluster_list;
     while (cluster) {
         _cluster_t *next_cluster = cluster->next;
-        cluster::destroy((cluster_t *)cluster);
+        cluster::destroy_cluster((cluster_t *)cluster, erase_nvs);
         cluster = next_cluster;
         /* Move cluster_list to find the remain cluster */
         current_endpoint->cluster_list = cluster;
     }
 
+    current_endpoint->cluster_index.clear();
+
     /* Remove from list */
     if (previous_endpoint == NULL) {
         current_node->endpoint_list = current_endpoint->next;
     } else {
         previous_endpoint->next = current_endpoint->next;
     }
+    current_node->endpoint_index.remove(current_endpoint->endpoint_id);
 
     /* Free */
     if (current_endpoint->identify != NULL) {
         chip::Platform::Delete(current_endpoint->identify);
         current_endpoint->identify = NULL;
     }
-    esp_matter_mem_free(current_endpoint);
+    arena::free(current_endpoint, sizeof(_endpoint_t));
 
     return ESP_OK;
 }
 
+esp_err_t destroy(node_t *node, endpoint_t *endpoint)
+{
+    return destroy_endpoint(node, endpoint, true);
+}
+
+esp_err_t suspend(node_t *node, endpoint_t *endpoint)
+{
+    return destroy_endpoint(node, endpoint, false);
+}
+
 endpoint_t *get(node_t *node, uint16_t endpoint_id)
 {
     VerifyOrReturnValue(node, NULL, ESP_LOGE(TAG, "Node cannot be NULL"));
     _node_t *current_node = (_node_t *)node;
-    _endpoint_t *current_endpoint = (_endpoint_t *)current_node->endpoint_list;
-    while (current_endpoint) {
-        if (current_endpoint->endpoint_id == endpoint_id) {
-            break;
-        }
-        current_endpoint = current_endpoint->next;
-    }
-    return (endpoint_t *)current_endpoint;
+    return (endpoint_t *)current_node->endpoint_index.find(endpoint_id);
 }
 
 endpoint_t *get(uint16_t endpoint_id)
@@ -1824,13 +2343,8 @@ endpoint_t *get_next(endpoint_t *endpoint)
 uint16_t get_count(node_t *node)
 {
     VerifyOrReturnValue(node, 0, ESP_LOGE(TAG, "Node cannot be NULL"));
-    uint16_t count = 0;
-    endpoint_t *endpoint = get_first(node);
-    while (endpoint) {
-        count++;
-        endpoint = get_next(endpoint);
-    }
-    return count;
+    _node_t *current_node = (_node_t *)node;
+    return current_node->endpoint_index.count;
 }
 
 uint16_t get_id(endpoint_t *endpoint)
@@ -2042,6 +2556,254 @@ esp_err_t set_identify(uint16_t endpoint_id, void *identify)
     return ESP_OK;
 }
 
+static size_t align_template_size(size_t size)
+{
+    return (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+}
+
+// Size of the bytes of a string value, a null string has none
+static uint16_t get_template_string_size(esp_matter_val_type_t type, const esp_matter_val_t &val)
+{
+    if (!attribute::is_string_type(type)) {
+        return 0;
+    }
+    uint16_t null_len =
+        (type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_OCTET_STRING) ? UINT8_MAX : UINT16_MAX;
+    return val.a.s == null_len ? 0 : val.a.s;
+}
+
+static void free_template(_endpoint_template_t *endpoint_template)
+{
+    for (uint16_t i = 0; i < endpoint_template->cluster_count; i++) {
+        const _template_cluster_t &template_cluster = endpoint_template->clusters[i];
+        for (uint16_t j = 0; j < template_cluster.attribute_count; j++) {
+            if (template_cluster.attributes[j].bounds_copied) {
+                esp_matter_mem_free((void *)template_cluster.attributes[j].bounds);
+            }
+        }
+    }
+    esp_matter_mem_free(endpoint_template);
+}
+
+static esp_err_t capture_attribute(_attribute_base_t *base, _template_attribute_t &template_attribute,
+                                   uint8_t *&string_cursor)
+{
+    template_attribute.attribute_id = base->attribute_id;
+    template_attribute.flags = base->flags;
+    template_attribute.val_type = base->attribute_val_type;
+    if (base->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+        return ESP_OK;
+    }
+    _attribute_t *current_attribute = (_attribute_t *)base;
+    template_attribute.val = current_attribute->attribute_val;
+    template_attribute.override_callback = current_attribute->override_callback;
+    if (attribute::is_string_type(base->attribute_val_type)) {
+        template_attribute.max_val_size = current_attribute->attribute_val.a.max;
+        uint16_t string_size = get_template_string_size(base->attribute_val_type, current_attribute->attribute_val);
+        template_attribute.val.a.b = string_size > 0 ? string_cursor : nullptr;
+        if (string_size > 0) {
+            memcpy(string_cursor, current_attribute->attribute_val.a.b, string_size);
+            string_cursor += string_size;
+        }
+    }
+
+    const attribute::bounds_t *bounds = current_attribute->bounds;
+    if (!bounds || !bounds->allocated) {
+        // The constant bounds are shared as they are
+        template_attribute.bounds = bounds;
+        return ESP_OK;
+    }
+    // The heap bounds are freed with the attribute, the template keeps its own copy
+    esp_matter_val_t min, max;
+    bounds->get(*bounds, min, max);
+    attribute::bounds_t *copy = (attribute::bounds_t *)attribute::create_bounds(bounds->storage_type, min, max);
+    VerifyOrReturnError(copy, ESP_ERR_NO_MEM, ESP_LOGE(TAG, "Couldn't copy the bounds of the template"));
+    copy->allocated = false;
+    template_attribute.bounds = copy;
+    template_attribute.bounds_copied = true;
+    return ESP_OK;
+}
+
+endpoint_template_t *capture_template(endpoint_t *endpoint)
+{
+    VerifyOrReturnValue(endpoint, NULL, ESP_LOGE(TAG, "Endpoint cannot be NULL"));
+    _endpoint_t *current_endpoint = (_endpoint_t *)endpoint;
+
+    /* Size */
+    size_t cluster_count = 0, attribute_count = 0, command_count = 0, dynamic_command_count = 0, event_count = 0;
+    size_t string_size = 0;
+    for (_cluster_t *cluster = current_endpoint->cluster_list; cluster; cluster = cluster->next) {
+        cluster_count++;
+        for (_attribute_base_t *base = cluster->attribute_list; base; base = base->next) {
+            attribute_count++;
+            if (base->flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY) {
+                continue;
+            }
+            // The array buffer belongs to the attribute and create() would take it over
+            VerifyOrReturnValue(base->attribute_val_type != ESP_MATTER_VAL_TYPE_ARRAY, NULL,
+                                ESP_LOGE(TAG, "Attribute 0x%08" PRIX32 " of array type cannot be in a template",
+                                         base->attribute_id));
+            string_size += get_template_string_size(base->attribute_val_type, ((_attribute_t *)base)->attribute_val);
+        }
+        for (_command_t *command = cluster->command_list; command; command = command->next) {
+            command_count++;
+            dynamic_command_count += command::is_dynamic(command) ? 1 : 0;
+        }
+        for (_event_t *event = cluster->event_list; event; event = event->next) {
+            event_count++;
+        }
+    }
+
+    /* Allocate */
+    size_t clusters_offset = align_template_size(sizeof(_endpoint_template_t));
+    size_t attributes_offset = clusters_offset + align_template_size(cluster_count * sizeof(_template_cluster_t));
+    size_t commands_offset = attributes_offset + align_template_size(attribute_count * sizeof(_template_attribute_t));
+    size_t descriptors_offset = commands_offset + align_template_size(command_count * sizeof(_template_command_t));
+    size_t events_offset =
+        descriptors_offset + align_template_size(dynamic_command_count * sizeof(command::descriptor_t));
+    size_t strings_offset = events_offset + event_count * sizeof(uint32_t);
+    uint8_t *block = (uint8_t *)esp_matter_mem_calloc(1, strings_offset + string_size);
+    VerifyOrReturnValue(block, NULL, ESP_LOGE(TAG, "Couldn't allocate the endpoint template"));
+
+    /* Set */
+    _endpoint_template_t *endpoint_template = (_endpoint_template_t *)block;
+    endpoint_template->device_type_count = current_endpoint->device_type_count;
+    memcpy(endpoint_template->device_types, current_endpoint->device_types, sizeof(current_endpoint->device_types));
+    endpoint_template->clusters = (_template_cluster_t *)(block + clusters_offset);
+    _template_attribute_t *attribute_cursor = (_template_attribute_t *)(block + attributes_offset);
+    _template_command_t *command_cursor = (_template_command_t *)(block + commands_offset);
+    command::descriptor_t *descriptor_cursor = (command::descriptor_t *)(block + descriptors_offset);
+    uint32_t *event_cursor = (uint32_t *)(block + events_offset);
+    uint8_t *string_cursor = block + strings_offset;
+
+    for (_cluster_t *cluster = current_endpoint->cluster_list; cluster; cluster = cluster->next) {
+        _template_cluster_t &template_cluster = endpoint_template->clusters[endpoint_template->cluster_count++];
+        template_cluster.cluster_id = cluster->cluster_id;
+        template_cluster.flags = cluster->flags;
+        template_cluster.functions = cluster->functions;
+        template_cluster.plugin_server_init_callback = cluster->plugin_server_init_callback;
+        template_cluster.delegate_init_callback = cluster->delegate_init_callback;
+        template_cluster.delegate_shutdown_callback = cluster->delegate_shutdown_callback;
+        template_cluster.delegate_pointer = cluster->delegate_pointer;
+        template_cluster.add_bounds_callback = cluster->add_bounds_callback;
+        template_cluster.init_callback = cluster->init_callback;
+        template_cluster.shutdown_callback = cluster->shutdown_callback;
+
+        template_cluster.attributes = attribute_cursor;
+        for (_attribute_base_t *base = cluster->attribute_list; base; base = base->next) {
+            if (capture_attribute(base, *attribute_cursor, string_cursor) != ESP_OK) {
+                free_template(endpoint_template);
+                return NULL;
+            }
+            attribute_cursor++;
+            template_cluster.attribute_count++;
+        }
+
+        template_cluster.commands = command_cursor;
+        for (_command_t *command = cluster->command_list; command; command = command->next) {
+            command_cursor->descriptor = command->descriptor;
+            if (command::is_dynamic(command)) {
+                *descriptor_cursor = *command->descriptor;
+                command_cursor->descriptor = descriptor_cursor++;
+            }
+            command_cursor->user_callback = command->user_callback;
+            command_cursor++;
+            template_cluster.command_count++;
+        }
+
+        template_cluster.event_ids = event_cursor;
+        for (_event_t *event = cluster->event_list; event; event = event->next) {
+            *event_cursor++ = event->event_id;
+            template_cluster.event_count++;
+        }
+    }
+    return (endpoint_template_t *)endpoint_template;
+}
+
+static esp_err_t apply_cluster_template(endpoint_t *endpoint, const _template_cluster_t &template_cluster)
+{
+    _cluster_t *cluster = (_cluster_t *)cluster::create(endpoint, template_cluster.cluster_id, template_cluster.flags);
+    VerifyOrReturnError(cluster, ESP_ERR_NO_MEM);
+    cluster->functions = template_cluster.functions;
+    cluster->plugin_server_init_callback = template_cluster.plugin_server_init_callback;
+    cluster->delegate_init_callback = template_cluster.delegate_init_callback;
+    cluster->delegate_shutdown_callback = template_cluster.delegate_shutdown_callback;
+    cluster->delegate_pointer = template_cluster.delegate_pointer;
+    cluster->add_bounds_callback = template_cluster.add_bounds_callback;
+    cluster->init_callback = template_cluster.init_callback;
+    cluster->shutdown_callback = template_cluster.shutdown_callback;
+
+    for (uint16_t i = 0; i < template_cluster.attribute_count; i++) {
+        const _template_attribute_t &template_attribute = template_cluster.attributes[i];
+        esp_matter_attr_val_t val(template_attribute.val_type, template_attribute.val);
+        // The bounds are added after the value is restored, to bring a stored value back within them
+        uint16_t flags = template_attribute.flags;
+        if (template_attribute.bounds) {
+            flags &= ~ATTRIBUTE_FLAG_MIN_MAX;
+        }
+        attribute_t *attribute = attribute::create((cluster_t *)cluster, template_attribute.attribute_id, flags, val,
+                                                   template_attribute.max_val_size);
+        VerifyOrReturnError(attribute, ESP_ERR_NO_MEM);
+        if (template_attribute.bounds) {
+            ESP_RETURN_ON_ERROR(attribute::add_bounds(attribute, template_attribute.bounds), TAG,
+                                "Failed to add the bounds of attribute 0x%08" PRIX32, template_attribute.attribute_id);
+        }
+        if (!(flags & ATTRIBUTE_FLAG_MANAGED_INTERNALLY)) {
+            ((_attribute_t *)attribute)->override_callback = template_attribute.override_callback;
+        }
+    }
+
+    for (uint16_t i = 0; i < template_cluster.command_count; i++) {
+        const _template_command_t &template_command = template_cluster.commands[i];
+        _command_t *command = (_command_t *)command::create((cluster_t *)cluster, template_command.descriptor);
+        VerifyOrReturnError(command, ESP_ERR_NO_MEM);
+        command->user_callback = template_command.user_callback;
+    }
+
+    for (uint16_t i = 0; i < template_cluster.event_count; i++) {
+        VerifyOrReturnError(event::create((cluster_t *)cluster, template_cluster.event_ids[i]), ESP_ERR_NO_MEM);
+    }
+    return ESP_OK;
+}
+
+esp_err_t apply_template(endpoint_t *endpoint, const endpoint_template_t *endpoint_template)
+{
+    VerifyOrReturnError(endpoint && endpoint_template, ESP_ERR_INVALID_ARG,
+                        ESP_LOGE(TAG, "Endpoint or endpoint template cannot be NULL"));
+    _endpoint_t *current_endpoint = (_endpoint_t *)endpoint;
+    const _endpoint_template_t *current_template = (const _endpoint_template_t *)endpoint_template;
+
+    for (uint16_t i = 0; i < current_template->cluster_count; i++) {
+        const _template_cluster_t &template_cluster = current_template->clusters[i];
+        if (cluster::get(endpoint, template_cluster.cluster_id)) {
+            // The clusters the endpoint already has are kept as they are
+            continue;
+        }
+        ESP_RETURN_ON_ERROR(apply_cluster_template(endpoint, template_cluster), TAG,
+                            "Failed to create cluster 0x%08" PRIX32 " from the template", template_cluster.cluster_id);
+    }
+
+    for (uint8_t i = 0; i < current_template->device_type_count; i++) {
+        const device_type_t &device_type = current_template->device_types[i];
+        bool found = false;
+        for (uint8_t j = 0; j < current_endpoint->device_type_count && !found; j++) {
+            found = current_endpoint->device_types[j].id == device_type.id;
+        }
+        if (!found) {
+            ESP_RETURN_ON_ERROR(add_device_type(endpoint, device_type.id, device_type.version), TAG,
+                                "Failed to add the device types of the template");
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t destroy_template(endpoint_template_t *endpoint_template)
+{
+    VerifyOrReturnError(endpoint_template, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Endpoint template cannot be NULL"));
+    free_template((_endpoint_template_t *)endpoint_template);
+    return ESP_OK;
+}
+
 } // namespace endpoint
 
 namespace node {
@@ -2058,7 +2820,9 @@ esp_err_t destroy_raw()
 {
     VerifyOrReturnError(node, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "NULL node cannot be destroyed"));
     _node_t *current_node = (_node_t *)node;
+    current_node->endpoint_index.clear();
     esp_matter_mem_free(current_node);
+    attribute::end_nvs_restore();
     node = NULL;
     return ESP_OK;
 }
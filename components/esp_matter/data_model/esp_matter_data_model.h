@@ -21,6 +21,7 @@
 #include "app/util/af-types.h"
 #include "lib/core/DataModelTypes.h"
 #include "lib/core/TLVReader.h"
+#include "lib/support/Span.h"
 #include "protocols/interaction_model/StatusCode.h"
 
 #define ESP_MATTER_NVS_PART_NAME CONFIG_ESP_MATTER_NVS_PART_NAME
@@ -45,6 +46,8 @@ typedef handle_t attribute_t;
 typedef handle_t command_t;
 /** Event handle */
 typedef handle_t event_t;
+/** Endpoint template handle */
+typedef handle_t endpoint_template_t;
 
 /** Endpoint flags */
 typedef enum endpoint_flags {
@@ -217,6 +220,20 @@ endpoint_t *resume(node_t *node, uint8_t flags, uint16_t endpoint_id, void *priv
  */
 esp_err_t destroy(node_t *node, endpoint_t *endpoint);
 
+/** Suspend endpoint
+ *
+ * This will destroy the endpoint as `destroy()` does, but keeps the nonvolatile attribute values in NVS, so that the
+ * endpoint can be resumed later with `resume()` and its attributes restored. The clusters are shut down as for
+ * `disable()`, not permanently removed.
+ *
+ * @param[in] node Node handle.
+ * @param[in] endpoint Endpoint handle.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t suspend(node_t *node, endpoint_t *endpoint);
+
 /** Get endpoint
  *
  * Get the endpoint present on the node.
@@ -486,6 +503,52 @@ esp_err_t disable(endpoint_t *endpoint);
  */
 bool is_enabled(endpoint_t *endpoint);
 
+/** Capture endpoint template
+ *
+ * Take an immutable snapshot of the clusters of the endpoint: their flags, function lists, callbacks and delegate,
+ * their attributes with the flags, bounds, override callbacks and current values, their commands and events, and the
+ * device types of the endpoint. The endpoints built from the template with `apply_template()` share its command
+ * descriptors and bounds and only allocate their own clusters, attributes and values.
+ *
+ * Capture the endpoint right after its clusters are created: the current attribute values become the values of the
+ * endpoints built from the template. The report policies and the attributes of array type are not captured.
+ *
+ * @note The endpoints built from the template keep pointing to its descriptors and bounds, free it with
+ * `destroy_template()` only once they are all destroyed.
+ *
+ * @param[in] endpoint Endpoint handle.
+ *
+ * @return Endpoint template handle on success.
+ * @return NULL in case of failure.
+ */
+endpoint_template_t *capture_template(endpoint_t *endpoint);
+
+/** Apply endpoint template
+ *
+ * Add the clusters and device types of the template which the endpoint does not have yet. The clusters are created
+ * with the captured attributes, commands and events, and the nonvolatile attributes are restored from the storage of
+ * this endpoint like `attribute::create()` does. Nothing is called back for the clusters, the caller runs the same
+ * initialization as after creating them one by one.
+ *
+ * @param[in] endpoint Endpoint handle.
+ * @param[in] endpoint_template Endpoint template handle from `capture_template()`.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t apply_template(endpoint_t *endpoint, const endpoint_template_t *endpoint_template);
+
+/** Destroy endpoint template
+ *
+ * Free the template captured by `capture_template()`. The endpoints built from the template must be destroyed first.
+ *
+ * @param[in] endpoint_template Endpoint template handle from `capture_template()`.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t destroy_template(endpoint_template_t *endpoint_template);
+
 } /* endpoint */
 
 namespace cluster {
@@ -1004,6 +1067,35 @@ esp_err_t get_val(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_
  */
 esp_err_t get_val(attribute_t *attribute, esp_matter_attr_val_t *val);
 
+/** Get a string attribute value without copying it
+ *
+ * Unlike get_val(), the value is not copied to a buffer owned by the caller, the span points to the value in the
+ * esp-matter storage. It is only valid until the attribute is set again or destroyed, so this API should be called
+ * with the Matter stack lock held and the span should not be kept.
+ * A null value or an empty string gives an empty span.
+ *
+ * @param[in] attribute Attribute handle of a char string or long char string attribute.
+ * @param[out] span Span of the value, without the null terminator.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_SUPPORTED if the value is not held by the esp-matter storage, use get_val() instead.
+ * @return error in case of failure.
+ */
+esp_err_t get_val_span(attribute_t *attribute, chip::CharSpan &span);
+
+/** Get an octet string attribute value without copying it
+ *
+ * Same as get_val_span() for char strings.
+ *
+ * @param[in] attribute Attribute handle of an octet string or long octet string attribute.
+ * @param[out] span Span of the value.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NOT_SUPPORTED if the value is not held by the esp-matter storage, use get_val() instead.
+ * @return error in case of failure.
+ */
+esp_err_t get_val_span(attribute_t *attribute, chip::ByteSpan &span);
+
 /** Get the attribute value type for the given attribute handle.
  *
  * @param[in] attribute Attribute handle.
@@ -1024,9 +1116,76 @@ esp_matter_val_type_t get_val_type(attribute_t *attribute);
  */
 esp_matter_val_type_t get_val_type(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id);
 
+/** Attribute bounds
+ *
+ * The comparison is specialized for the storage type of the attribute value and selected once, when the bounds are
+ * added, instead of switching on the value type on every write. The values follow in `typed_bounds_t`.
+ */
+typedef struct bounds {
+    /** Compare a value, which is not null, with the bounds. Returns 0 if it is within them, 1 if it is above the
+     *  maximum and -1 if it is below the minimum. */
+    int (*compare)(const esp_matter_val_t &val, const struct bounds &bounds);
+    /** Get the minimum and maximum values */
+    void (*get)(const struct bounds &bounds, esp_matter_val_t &min, esp_matter_val_t &max);
+    /** Storage type of the values, see `esp_matter_attr_val_t::get_storage_type()` */
+    esp_matter_val_type_t storage_type;
+    /** The bounds were allocated by `add_bounds(attribute, min, max)` and are freed with the attribute */
+    bool allocated;
+} bounds_t;
+
+/** Attribute bounds of the numeric type T */
+template <typename T>
+struct typed_bounds_t {
+    bounds_t base;
+    T min;
+    T max;
+};
+
+/** Storage type and value member of the numeric types which can have bounds */
+template <typename T>
+struct bounds_val;
+
+#define ESP_MATTER_BOUNDS_VAL(T, STORAGE_TYPE, MEMBER)                                                                 \
+    template <>                                                                                                        \
+    struct bounds_val<T> {                                                                                             \
+        static constexpr esp_matter_val_type_t k_storage_type = STORAGE_TYPE;                                          \
+        static T get(const esp_matter_val_t &val) { return val.MEMBER; }                                               \
+        static void set(esp_matter_val_t &val, T value) { val.MEMBER = value; }                                        \
+    };
+ESP_MATTER_BOUNDS_VAL(uint8_t, ESP_MATTER_VAL_TYPE_UINT8, u8)
+ESP_MATTER_BOUNDS_VAL(uint16_t, ESP_MATTER_VAL_TYPE_UINT16, u16)
+ESP_MATTER_BOUNDS_VAL(uint32_t, ESP_MATTER_VAL_TYPE_UINT32, u32)
+ESP_MATTER_BOUNDS_VAL(uint64_t, ESP_MATTER_VAL_TYPE_UINT64, u64)
+ESP_MATTER_BOUNDS_VAL(int8_t, ESP_MATTER_VAL_TYPE_INT8, i8)
+ESP_MATTER_BOUNDS_VAL(int16_t, ESP_MATTER_VAL_TYPE_INT16, i16)
+ESP_MATTER_BOUNDS_VAL(int32_t, ESP_MATTER_VAL_TYPE_INT32, i32)
+ESP_MATTER_BOUNDS_VAL(int64_t, ESP_MATTER_VAL_TYPE_INT64, i64)
+ESP_MATTER_BOUNDS_VAL(float, ESP_MATTER_VAL_TYPE_FLOAT, f)
+#undef ESP_MATTER_BOUNDS_VAL
+
+template <typename T>
+int compare_bounds(const esp_matter_val_t &val, const bounds_t &bounds)
+{
+    const typed_bounds_t<T> &typed_bounds = reinterpret_cast<const typed_bounds_t<T> &>(bounds);
+    T value = bounds_val<T>::get(val);
+    if (value < typed_bounds.min) {
+        return -1;
+    }
+    return value > typed_bounds.max ? 1 : 0;
+}
+
+template <typename T>
+void get_bounds_val(const bounds_t &bounds, esp_matter_val_t &min, esp_matter_val_t &max)
+{
+    const typed_bounds_t<T> &typed_bounds = reinterpret_cast<const typed_bounds_t<T> &>(bounds);
+    bounds_val<T>::set(min, typed_bounds.min);
+    bounds_val<T>::set(max, typed_bounds.max);
+}
+
 /** Add attribute bounds
  *
  * Add bounds to the attribute (has `ATTRIBUTE_FLAG_EXTERNAL_STORAGE` flag). Bounds cannot be added to string/array type attributes.
+ * The bounds are copied to the heap, use `add_bounds<T, min, max>()` for constant bounds.
  *
  * @param[in] attribute Attribute handle.
  * @param[in] min Minimum allowed value.
@@ -1037,6 +1196,42 @@ esp_matter_val_type_t get_val_type(uint16_t endpoint_id, uint32_t cluster_id, ui
  */
 esp_err_t add_bounds(attribute_t *attribute, esp_matter_attr_val_t min, esp_matter_attr_val_t max);
 
+/** Add attribute bounds which are not copied
+ *
+ * Add bounds to the attribute (has `ATTRIBUTE_FLAG_EXTERNAL_STORAGE` flag), the storage type of the bounds must be the
+ * one of the attribute value. The attribute keeps a pointer to the bounds, they must outlive it.
+ *
+ * @param[in] attribute Attribute handle.
+ * @param[in] bounds Bounds, usually constant ones shared by several attributes.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t add_bounds(attribute_t *attribute, const bounds_t *bounds);
+
+/** Add constant attribute bounds
+ *
+ * The bounds are kept in a constant table in flash, shared by all the attributes with the same type and range,
+ * instead of a heap copy per attribute.
+ *
+ * @tparam T Storage type of the attribute value, for example `uint8_t` for an `enum8` or a nullable `uint8` attribute.
+ * @tparam min Minimum allowed value.
+ * @tparam max Maximum allowed value.
+ *
+ * @param[in] attribute Attribute handle.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+template <typename T, T min, T max>
+esp_err_t add_bounds(attribute_t *attribute)
+{
+    static_assert(!(max < min), "The minimum must not be greater than the maximum");
+    static constexpr typed_bounds_t<T> k_bounds = {
+        {compare_bounds<T>, get_bounds_val<T>, bounds_val<T>::k_storage_type, false}, min, max};
+    return add_bounds(attribute, &k_bounds.base);
+}
+
 /** Get attribute bounds
  *
  * Get the bounds which have been added to the attribute (has `ATTRIBUTE_FLAG_EXTERNAL_STORAGE` flag).
@@ -1102,6 +1297,79 @@ callback_t get_override_callback(attribute_t *attribute);
  */
 esp_err_t set_deferred_persistence(attribute_t *attribute);
 
+/** Flush deferred attribute persistence
+ *
+ * The deferred non-volatile attribute changes (and all the non-volatile attribute changes with
+ * CONFIG_ESP_MATTER_NVS_WRITE_BACK_ALL_ATTRIBUTES) are queued and written to flash together with a single NVS commit.
+ * This writes the queued values now, it could be called before a shutdown or a restart so that no change is lost.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t flush_deferred_persistence();
+
+/** Attribute report policy
+ *
+ * Decides which changes made with `update()`, `report()`, their batch variants and `update_async()` are reported to
+ * the subscribers. A change that is not reported is still stored and still increases the data version of the cluster,
+ * it is read back by the next read or report of the cluster.
+ */
+typedef struct {
+    /** Minimum absolute difference from the last reported value, 0 to disable */
+    float absolute_delta;
+    /** Minimum difference from the last reported value, as a fraction of it (0.05 for 5%), 0 to disable */
+    float relative_delta;
+    /** Minimum time between two reports in milliseconds, 0 to disable. A change within this interval is reported when
+     it expires, with the latest value. */
+    uint32_t min_interval_ms;
+    /** Number of samples of the exponentially weighted moving average compared with the thresholds, 0 or 1 to compare
+     the raw value */
+    uint8_t ewma_window;
+} report_policy_t;
+
+/** Set attribute report policy
+ *
+ * Set the report policy for the attribute (has `ATTRIBUTE_FLAG_EXTERNAL_STORAGE` flag), for example to only report
+ * the measured value of a noisy sensor when it changed by some amount and at most once per interval. The thresholds
+ * and the moving average only apply to numeric attributes, a change to or from null is always significant. Without
+ * threshold any change is significant.
+ *
+ * @note The attribute writes from Matter clients are always reported. This API must be called before
+ * `esp_matter::start()` or with the Matter stack lock held.
+ *
+ * @param[in] attribute Attribute handle.
+ * @param[in] policy Pointer to the report policy, NULL to report all the changes again.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t set_report_policy(attribute_t *attribute, const report_policy_t *policy);
+
+/** Restore the non-volatile attributes of a cluster in the background
+ *
+ * The non-volatile attributes of the clusters with this ID, created after this call, start with their default value
+ * instead of reading NVS. Their stored values are restored on the Matter thread once `esp_matter::start()` has been
+ * called, a few attributes at a time (CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_BATCH_SIZE), and reported to the
+ * subscribers. It shortens the boot for the clusters whose values are not needed by the init callbacks, like
+ * diagnostics or user labels. A value set before the restore is kept.
+ *
+ * @note This API must be called before the clusters are created, usually before `node::create()`.
+ *
+ * @param[in] cluster_id Cluster ID.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_NO_MEM if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT clusters are already registered.
+ */
+esp_err_t set_background_restore(uint32_t cluster_id);
+
+/** Check whether the value of an attribute is still waiting for its background restore
+ *
+ * @param[in] attribute Attribute handle.
+ *
+ * @return true if the attribute still has its default value and its stored value is not restored yet.
+ */
+bool is_restore_pending(attribute_t *attribute);
+
 } /* attribute */
 
 namespace command {
@@ -1139,6 +1407,52 @@ typedef esp_err_t (*callback_t)(const ConcreteCommandPath &command_path, TLVRead
  */
 command_t *create(cluster_t *cluster, uint32_t command_id, uint8_t flags, callback_t callback);
 
+/** Constant description of a command
+ *
+ * The commands created from a descriptor keep a pointer to it instead of a copy, so the descriptors of the
+ * spec-defined commands stay in flash and are shared by all the endpoints.
+ */
+typedef struct descriptor {
+    /** Command ID */
+    uint32_t command_id;
+    /** Bitmap of `command_flags_t` */
+    uint16_t flags;
+    /** Command callback */
+    callback_t callback;
+} descriptor_t;
+
+/** Create command from a descriptor
+ *
+ * Same as `create(cluster, command_id, flags, callback)`, the command keeps a pointer to the descriptor.
+ *
+ * @param[in] cluster Cluster handle.
+ * @param[in] descriptor Command descriptor, it must outlive the command.
+ *
+ * @return Command handle on success.
+ * @return NULL in case of failure.
+ */
+command_t *create(cluster_t *cluster, const descriptor_t *descriptor);
+
+/** Create command from a constant descriptor
+ *
+ * The descriptor is kept in flash, shared by all the clusters which create this command.
+ *
+ * @tparam command_id Command ID for the command.
+ * @tparam flags Bitmap of `command_flags_t`.
+ * @tparam callback Command callback.
+ *
+ * @param[in] cluster Cluster handle.
+ *
+ * @return Command handle on success.
+ * @return NULL in case of failure.
+ */
+template <uint32_t command_id, uint16_t flags, callback_t callback = nullptr>
+command_t *create(cluster_t *cluster)
+{
+    static constexpr descriptor_t k_descriptor = {command_id, flags, callback};
+    return create(cluster, &k_descriptor);
+}
+
 /** Get command
  *
  * Get opaque command handle for concrete command path
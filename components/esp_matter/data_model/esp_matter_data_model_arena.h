@@ -0,0 +1,60 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace arena {
+
+/** Data model node allocation statistics
+ *
+ * The endpoints, clusters, attributes, commands and events of the data model are counted here. They are carved from
+ * slabs when `CONFIG_ESP_MATTER_DATA_MODEL_ARENA` is enabled and allocated one by one from the heap otherwise, so the
+ * statistics of both builds can be compared.
+ */
+typedef struct {
+    /** Number of nodes in use */
+    uint32_t node_count;
+    /** Bytes requested by the nodes in use */
+    uint32_t node_bytes;
+    /** Number of slabs allocated, always 0 without the arena */
+    uint32_t slab_count;
+    /** Bytes of all the slabs, always 0 without the arena */
+    uint32_t slab_bytes;
+    /** Bytes of the slabs not carved yet */
+    uint32_t unused_bytes;
+    /** Bytes of the freed nodes waiting in the free lists for a node of the same size */
+    uint32_t free_list_bytes;
+    /** Number of nodes too large for a slab, allocated from the heap */
+    uint32_t heap_node_count;
+} stats_t;
+
+/** Get the data model node allocation statistics
+ *
+ * @param[out] stats Pointer to the statistics.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure.
+ */
+esp_err_t get_stats(stats_t *stats);
+
+/** Print the data model node allocation statistics */
+void print_stats();
+
+} // namespace arena
+} // namespace esp_matter
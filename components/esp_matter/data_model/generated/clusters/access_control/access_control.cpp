@@ -104,21 +104,21 @@ attribute_t *create_extension(cluster_t *cluster, uint8_t *value, uint16_t lengt
 attribute_t *create_subjects_per_access_control_entry(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SubjectsPerAccessControlEntry::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(4)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 4, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_targets_per_access_control_entry(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, TargetsPerAccessControlEntry::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(3)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 3, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_access_control_entries_per_fabric(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, AccessControlEntriesPerFabric::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(4)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 4, 65534>(attribute);
     return attribute;
 }
 
@@ -147,7 +147,7 @@ command_t *create_review_fabric_restrictions(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(managed_device), NULL);
-    return esp_matter::command::create(cluster, ReviewFabricRestrictions::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ReviewFabricRestrictions::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 #endif // CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
 
@@ -155,7 +155,7 @@ command_t *create_review_fabric_restrictions_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(managed_device), NULL);
-    return esp_matter::command::create(cluster, ReviewFabricRestrictionsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ReviewFabricRestrictionsResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -82,22 +82,22 @@ namespace account_login {
 namespace command {
 command_t *create_get_setup_pin(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetSetupPIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_get_setup_pin);
+    return esp_matter::command::create<GetSetupPIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_get_setup_pin>(cluster);
 }
 
 command_t *create_get_setup_pin_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetSetupPINResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetSetupPINResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_login(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Login::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_login);
+    return esp_matter::command::create<Login::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_login>(cluster);
 }
 
 command_t *create_logout(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Logout::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_logout);
+    return esp_matter::command::create<Logout::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_logout>(cluster);
 }
 
 } /* command */
@@ -64,62 +64,62 @@ attribute_t *create_setup_url(cluster_t *cluster, char *value, uint16_t length)
 namespace command {
 command_t *create_instant_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, InstantAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<InstantAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_instant_action_with_transition(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, InstantActionWithTransition::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<InstantActionWithTransition::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StartAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StartAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StartActionWithDuration::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StartActionWithDuration::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stop_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StopAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StopAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_pause_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PauseAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PauseAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_pause_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PauseActionWithDuration::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PauseActionWithDuration::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_resume_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ResumeAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ResumeAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnableAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnableAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_disable_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DisableAction::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DisableAction::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_disable_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DisableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DisableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -100,7 +100,7 @@ attribute_t *create_condition(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(condition), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, Condition::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -109,14 +109,14 @@ attribute_t *create_degradation_direction(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(condition), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, DegradationDirection::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(1), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 1>(attribute);
     return attribute;
 }
 
 attribute_t *create_change_indication(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ChangeIndication::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -128,7 +128,7 @@ attribute_t *create_in_place_indicator(cluster_t *cluster, bool value)
 attribute_t *create_last_changed_time(cluster_t *cluster, nullable<uint32_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, LastChangedTime::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -143,7 +143,7 @@ attribute_t *create_replacement_product_list(cluster_t *cluster, uint8_t *value,
 namespace command {
 command_t *create_reset_condition(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ResetCondition::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ResetCondition::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -65,21 +65,21 @@ namespace attribute {
 attribute_t *create_window_status(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, WindowStatus::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
 attribute_t *create_admin_fabric_index(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, AdminFabricIndex::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_admin_vendor_id(cluster_t *cluster, nullable<uint16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, AdminVendorId::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint16_t>(0)), esp_matter_attr_val(nullable<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -87,19 +87,19 @@ attribute_t *create_admin_vendor_id(cluster_t *cluster, nullable<uint16_t> value
 namespace command {
 command_t *create_open_commissioning_window(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OpenCommissioningWindow::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OpenCommissioningWindow::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_open_basic_commissioning_window(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(basic), NULL);
-    return esp_matter::command::create(cluster, OpenBasicCommissioningWindow::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OpenBasicCommissioningWindow::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_revoke_commissioning(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RevokeCommissioning::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RevokeCommissioning::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
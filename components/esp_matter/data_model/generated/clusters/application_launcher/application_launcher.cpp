@@ -112,22 +112,22 @@ attribute_t *create_current_app(cluster_t *cluster, uint8_t *value, uint16_t len
 namespace command {
 command_t *create_launch_app(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LaunchApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_app);
+    return esp_matter::command::create<LaunchApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_app>(cluster);
 }
 
 command_t *create_stop_app(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StopApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop_app);
+    return esp_matter::command::create<StopApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop_app>(cluster);
 }
 
 command_t *create_hide_app(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, HideApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_hide_app);
+    return esp_matter::command::create<HideApp::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_hide_app>(cluster);
 }
 
 command_t *create_launcher_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LauncherResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<LauncherResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
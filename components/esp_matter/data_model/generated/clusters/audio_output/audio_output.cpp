@@ -99,14 +99,14 @@ attribute_t *create_current_output(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_select_output(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SelectOutput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_select_output);
+    return esp_matter::command::create<SelectOutput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_select_output>(cluster);
 }
 
 command_t *create_rename_output(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(name_updates), NULL);
-    return esp_matter::command::create(cluster, RenameOutput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rename_output);
+    return esp_matter::command::create<RenameOutput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rename_output>(cluster);
 }
 
 } /* command */
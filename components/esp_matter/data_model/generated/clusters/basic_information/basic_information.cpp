@@ -46,7 +46,7 @@ namespace attribute {
 attribute_t *create_data_model_revision(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, DataModelRevision::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -59,7 +59,7 @@ attribute_t *create_vendor_name(cluster_t *cluster, char *value, uint16_t length
 attribute_t *create_vendor_id(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, VendorID::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -72,7 +72,7 @@ attribute_t *create_product_name(cluster_t *cluster, char *value, uint16_t lengt
 attribute_t *create_product_id(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ProductID::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -90,7 +90,7 @@ attribute_t *create_location(cluster_t *cluster, char *value, uint16_t length)
 attribute_t *create_hardware_version(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, HardwareVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -102,7 +102,7 @@ attribute_t *create_hardware_version_string(cluster_t *cluster, char *value, uin
 attribute_t *create_software_version(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SoftwareVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -169,14 +169,14 @@ attribute_t *create_product_appearance(cluster_t *cluster, uint8_t *value, uint1
 attribute_t *create_specification_version(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SpecificationVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_max_paths_per_invoke(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxPathsPerInvoke::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(1)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 1, 65534>(attribute);
     return attribute;
 }
 
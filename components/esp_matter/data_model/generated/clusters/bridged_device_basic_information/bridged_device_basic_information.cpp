@@ -72,7 +72,7 @@ attribute_t *create_vendor_name(cluster_t *cluster, char *value, uint16_t length
 attribute_t *create_vendor_id(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, VendorID::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -85,7 +85,7 @@ attribute_t *create_product_name(cluster_t *cluster, char *value, uint16_t lengt
 attribute_t *create_product_id(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ProductID::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -98,7 +98,7 @@ attribute_t *create_node_label(cluster_t *cluster, char *value, uint16_t length)
 attribute_t *create_hardware_version(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, HardwareVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -110,7 +110,7 @@ attribute_t *create_hardware_version_string(cluster_t *cluster, char *value, uin
 attribute_t *create_software_version(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SoftwareVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -170,7 +170,7 @@ command_t *create_keep_active(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(bridged_icd_support), NULL);
-    return esp_matter::command::create(cluster, KeepActive::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<KeepActive::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
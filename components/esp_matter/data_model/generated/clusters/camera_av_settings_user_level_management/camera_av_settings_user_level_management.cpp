@@ -163,7 +163,7 @@ attribute_t *create_max_presets(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_presets), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxPresets::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -186,7 +186,7 @@ attribute_t *create_zoom_max(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_zoom), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ZoomMax::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(2)), esp_matter_attr_val(static_cast<uint8_t>(100)));
+    esp_matter::attribute::add_bounds<uint8_t, 2, 100>(attribute);
     return attribute;
 }
 
@@ -195,7 +195,7 @@ attribute_t *create_tilt_min(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_tilt), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TiltMin::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-180)), esp_matter_attr_val(static_cast<int16_t>(0)));
+    esp_matter::attribute::add_bounds<int16_t, -180, 0>(attribute);
     return attribute;
 }
 
@@ -204,7 +204,7 @@ attribute_t *create_tilt_max(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_tilt), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TiltMax::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(1)), esp_matter_attr_val(static_cast<int16_t>(180)));
+    esp_matter::attribute::add_bounds<int16_t, 1, 180>(attribute);
     return attribute;
 }
 
@@ -213,7 +213,7 @@ attribute_t *create_pan_min(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_pan), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, PanMin::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-180)), esp_matter_attr_val(static_cast<int16_t>(0)));
+    esp_matter::attribute::add_bounds<int16_t, -180, 0>(attribute);
     return attribute;
 }
 
@@ -222,7 +222,7 @@ attribute_t *create_pan_max(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_pan), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, PanMax::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(1)), esp_matter_attr_val(static_cast<int16_t>(180)));
+    esp_matter::attribute::add_bounds<int16_t, 1, 180>(attribute);
     return attribute;
 }
 
@@ -231,7 +231,7 @@ attribute_t *create_movement_state(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(mechanical_pan)) || (has_feature(mechanical_tilt)) || (has_feature(mechanical_zoom))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MovementState::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(1), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 1>(attribute);
     return attribute;
 }
 
@@ -241,47 +241,47 @@ command_t *create_mptz_set_position(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(mechanical_pan)) || (has_feature(mechanical_tilt)) || (has_feature(mechanical_zoom))), NULL);
-    return esp_matter::command::create(cluster, MPTZSetPosition::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MPTZSetPosition::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_relative_move(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(mechanical_pan)) || (has_feature(mechanical_tilt)) || (has_feature(mechanical_zoom))), NULL);
-    return esp_matter::command::create(cluster, MPTZRelativeMove::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MPTZRelativeMove::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_move_to_preset(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_presets), NULL);
-    return esp_matter::command::create(cluster, MPTZMoveToPreset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MPTZMoveToPreset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_save_preset(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_presets), NULL);
-    return esp_matter::command::create(cluster, MPTZSavePreset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MPTZSavePreset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_remove_preset(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(mechanical_presets), NULL);
-    return esp_matter::command::create(cluster, MPTZRemovePreset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MPTZRemovePreset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dptz_set_viewport(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(digital_ptz), NULL);
-    return esp_matter::command::create(cluster, DPTZSetViewport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DPTZSetViewport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dptz_relative_move(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DPTZRelativeMove::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DPTZRelativeMove::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -286,7 +286,7 @@ attribute_t *create_max_concurrent_encoders(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(video)) || (has_feature(snapshot))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxConcurrentEncoders::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -295,7 +295,7 @@ attribute_t *create_max_encoded_pixel_rate(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(video)) || (has_feature(snapshot))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxEncodedPixelRate::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -330,7 +330,7 @@ attribute_t *create_rate_distortion_trade_off_points(cluster_t *cluster, uint8_t
 attribute_t *create_max_content_buffer_size(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxContentBufferSize::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -353,7 +353,7 @@ attribute_t *create_two_way_talk_support(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(speaker), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TwoWayTalkSupport::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -367,7 +367,7 @@ attribute_t *create_snapshot_capabilities(cluster_t *cluster, uint8_t *value, ui
 attribute_t *create_max_network_bandwidth(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxNetworkBandwidth::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -376,7 +376,7 @@ attribute_t *create_current_frame_rate(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(video), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentFrameRate::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -442,14 +442,14 @@ attribute_t *create_night_vision(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(night_vision), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, NightVision::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
 attribute_t *create_night_vision_illum(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, NightVisionIllum::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -472,7 +472,7 @@ attribute_t *create_speaker_volume_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(speaker), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SpeakerVolumeLevel::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -481,7 +481,7 @@ attribute_t *create_speaker_max_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(speaker), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SpeakerMaxLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -490,7 +490,7 @@ attribute_t *create_speaker_min_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(speaker), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SpeakerMinLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -506,7 +506,7 @@ attribute_t *create_microphone_volume_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MicrophoneVolumeLevel::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -515,7 +515,7 @@ attribute_t *create_microphone_max_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MicrophoneMaxLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -524,7 +524,7 @@ attribute_t *create_microphone_min_level(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MicrophoneMinLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -536,7 +536,7 @@ attribute_t *create_microphone_agc_enabled(cluster_t *cluster, bool value)
 attribute_t *create_image_rotation(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ImageRotation::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(359)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 359>(attribute);
     return attribute;
 }
 
@@ -580,96 +580,96 @@ command_t *create_audio_stream_allocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
-    return esp_matter::command::create(cluster, AudioStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AudioStreamAllocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_audio_stream_allocate_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
-    return esp_matter::command::create(cluster, AudioStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AudioStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_audio_stream_deallocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio), NULL);
-    return esp_matter::command::create(cluster, AudioStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AudioStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_allocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(video), NULL);
-    return esp_matter::command::create(cluster, VideoStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<VideoStreamAllocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_allocate_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(video), NULL);
-    return esp_matter::command::create(cluster, VideoStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<VideoStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_video_stream_modify(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(video)) && (((has_feature(watermark)) || (has_feature(on_screen_display))))), NULL);
-    return esp_matter::command::create(cluster, VideoStreamModify::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<VideoStreamModify::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_deallocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(video), NULL);
-    return esp_matter::command::create(cluster, VideoStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<VideoStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_allocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(snapshot), NULL);
-    return esp_matter::command::create(cluster, SnapshotStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SnapshotStreamAllocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_allocate_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(snapshot), NULL);
-    return esp_matter::command::create(cluster, SnapshotStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SnapshotStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_snapshot_stream_modify(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(snapshot)) && (((has_feature(watermark)) || (has_feature(on_screen_display))))), NULL);
-    return esp_matter::command::create(cluster, SnapshotStreamModify::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SnapshotStreamModify::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_deallocate(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(snapshot), NULL);
-    return esp_matter::command::create(cluster, SnapshotStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SnapshotStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_stream_priorities(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetStreamPriorities::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetStreamPriorities::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_capture_snapshot(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(snapshot), NULL);
-    return esp_matter::command::create(cluster, CaptureSnapshot::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CaptureSnapshot::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_capture_snapshot_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(snapshot), NULL);
-    return esp_matter::command::create(cluster, CaptureSnapshotResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CaptureSnapshotResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -210,52 +210,52 @@ command_t *create_change_channel(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(channel_list)) || (has_feature(lineup_info))), NULL);
-    return esp_matter::command::create(cluster, ChangeChannel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_change_channel);
+    return esp_matter::command::create<ChangeChannel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_change_channel>(cluster);
 }
 
 command_t *create_change_channel_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(channel_list)) || (has_feature(lineup_info))), NULL);
-    return esp_matter::command::create(cluster, ChangeChannelResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ChangeChannelResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_change_channel_by_number(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ChangeChannelByNumber::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_change_channel_by_number);
+    return esp_matter::command::create<ChangeChannelByNumber::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_change_channel_by_number>(cluster);
 }
 
 command_t *create_skip_channel(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SkipChannel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_channel);
+    return esp_matter::command::create<SkipChannel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_channel>(cluster);
 }
 
 command_t *create_get_program_guide(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(electronic_guide), NULL);
-    return esp_matter::command::create(cluster, GetProgramGuide::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_get_program_guide);
+    return esp_matter::command::create<GetProgramGuide::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_get_program_guide>(cluster);
 }
 
 command_t *create_program_guide_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(electronic_guide), NULL);
-    return esp_matter::command::create(cluster, ProgramGuideResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ProgramGuideResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_record_program(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(record_program)) && (has_feature(electronic_guide))), NULL);
-    return esp_matter::command::create(cluster, RecordProgram::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_record_program);
+    return esp_matter::command::create<RecordProgram::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_record_program>(cluster);
 }
 
 command_t *create_cancel_record_program(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(record_program)) && (has_feature(electronic_guide))), NULL);
-    return esp_matter::command::create(cluster, CancelRecordProgram::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_cancel_record_program);
+    return esp_matter::command::create<CancelRecordProgram::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_cancel_record_program>(cluster);
 }
 
 } /* command */
@@ -53,7 +53,7 @@ attribute_t *create_installed_chime_sounds(cluster_t *cluster, uint8_t *value, u
 attribute_t *create_selected_chime(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SelectedChime::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -66,7 +66,7 @@ attribute_t *create_enabled(cluster_t *cluster, bool value)
 namespace command {
 command_t *create_play_chime_sound(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PlayChimeSound::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PlayChimeSound::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -274,14 +274,14 @@ attribute_t *create_latch_control_modes(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_set_target(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetTarget::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTarget::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_step(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(positioning), NULL);
-    return esp_matter::command::create(cluster, Step::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Step::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -47,7 +47,7 @@ namespace attribute {
 attribute_t *create_supported_device_categories(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SupportedDeviceCategories::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(4294967295), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967295>(attribute);
     return attribute;
 }
 
@@ -55,17 +55,17 @@ attribute_t *create_supported_device_categories(cluster_t *cluster, uint32_t val
 namespace command {
 command_t *create_request_commissioning_approval(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RequestCommissioningApproval::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RequestCommissioningApproval::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_commission_node(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissionNode::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommissionNode::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_reverse_open_commissioning_window(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ReverseOpenCommissioningWindow::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ReverseOpenCommissioningWindow::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -89,24 +89,24 @@ attribute_t *create_price_forecast(cluster_t *cluster, uint8_t *value, uint16_t
 namespace command {
 command_t *create_get_detailed_price_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetDetailedPriceRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetDetailedPriceRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_detailed_price_response(cluster_t *cluster)
 {
     VerifyOrReturnValue(has_command(GetDetailedPriceRequest, COMMAND_FLAG_ACCEPTED), NULL);
-    return esp_matter::command::create(cluster, GetDetailedPriceResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetDetailedPriceResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_detailed_forecast_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetDetailedForecastRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetDetailedForecastRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_detailed_forecast_response(cluster_t *cluster)
 {
     VerifyOrReturnValue(has_command(GetDetailedForecastRequest, COMMAND_FLAG_ACCEPTED), NULL);
-    return esp_matter::command::create(cluster, GetDetailedForecastResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetDetailedForecastResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -242,22 +242,22 @@ attribute_t *create_default_randomization_type(cluster_t *cluster, nullable<uint
 namespace command {
 command_t *create_get_tariff_component(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetTariffComponent::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetTariffComponent::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_tariff_component_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetTariffComponentResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetTariffComponentResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_day_entry(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetDayEntry::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetDayEntry::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_day_entry_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetDayEntryResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetDayEntryResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
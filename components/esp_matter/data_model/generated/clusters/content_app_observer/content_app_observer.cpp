@@ -57,12 +57,12 @@ namespace content_app_observer {
 namespace command {
 command_t *create_content_app_message(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ContentAppMessage::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_content_app_message);
+    return esp_matter::command::create<ContentAppMessage::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_content_app_message>(cluster);
 }
 
 command_t *create_content_app_message_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ContentAppMessageResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ContentAppMessageResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -414,7 +414,7 @@ attribute_t *create_screen_daily_time(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(screen_time), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ScreenDailyTime::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(86400)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 86400>(attribute);
     return attribute;
 }
 
@@ -423,7 +423,7 @@ attribute_t *create_remaining_screen_time(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(screen_time), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, RemainingScreenTime::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(86400)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 86400>(attribute);
     return attribute;
 }
 
@@ -461,115 +461,115 @@ command_t *create_update_pin(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pin_management), NULL);
-    return esp_matter::command::create(cluster, UpdatePIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_update_pin);
+    return esp_matter::command::create<UpdatePIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_update_pin>(cluster);
 }
 
 command_t *create_reset_pin(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pin_management), NULL);
-    return esp_matter::command::create(cluster, ResetPIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_reset_pin);
+    return esp_matter::command::create<ResetPIN::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_reset_pin>(cluster);
 }
 
 command_t *create_reset_pin_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pin_management), NULL);
-    return esp_matter::command::create(cluster, ResetPINResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ResetPINResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_enable(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Enable::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_enable);
+    return esp_matter::command::create<Enable::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_enable>(cluster);
 }
 
 command_t *create_disable(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Disable::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_disable);
+    return esp_matter::command::create<Disable::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_disable>(cluster);
 }
 
 command_t *create_add_bonus_time(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(screen_time), NULL);
-    return esp_matter::command::create(cluster, AddBonusTime::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_bonus_time);
+    return esp_matter::command::create<AddBonusTime::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_bonus_time>(cluster);
 }
 
 command_t *create_set_screen_daily_time(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(screen_time), NULL);
-    return esp_matter::command::create(cluster, SetScreenDailyTime::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_screen_daily_time);
+    return esp_matter::command::create<SetScreenDailyTime::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_screen_daily_time>(cluster);
 }
 
 command_t *create_block_unrated_content(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_unrated), NULL);
-    return esp_matter::command::create(cluster, BlockUnratedContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_block_unrated_content);
+    return esp_matter::command::create<BlockUnratedContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_block_unrated_content>(cluster);
 }
 
 command_t *create_unblock_unrated_content(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_unrated), NULL);
-    return esp_matter::command::create(cluster, UnblockUnratedContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_unblock_unrated_content);
+    return esp_matter::command::create<UnblockUnratedContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_unblock_unrated_content>(cluster);
 }
 
 command_t *create_set_on_demand_rating_threshold(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(on_demand_content_rating), NULL);
-    return esp_matter::command::create(cluster, SetOnDemandRatingThreshold::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_on_demand_rating_threshold);
+    return esp_matter::command::create<SetOnDemandRatingThreshold::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_on_demand_rating_threshold>(cluster);
 }
 
 command_t *create_set_scheduled_content_rating_threshold(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(scheduled_content_rating), NULL);
-    return esp_matter::command::create(cluster, SetScheduledContentRatingThreshold::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_scheduled_content_rating_threshold);
+    return esp_matter::command::create<SetScheduledContentRatingThreshold::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_scheduled_content_rating_threshold>(cluster);
 }
 
 command_t *create_add_block_channels(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_channels), NULL);
-    return esp_matter::command::create(cluster, AddBlockChannels::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_block_channels);
+    return esp_matter::command::create<AddBlockChannels::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_block_channels>(cluster);
 }
 
 command_t *create_remove_block_channels(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_channels), NULL);
-    return esp_matter::command::create(cluster, RemoveBlockChannels::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_channels);
+    return esp_matter::command::create<RemoveBlockChannels::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_channels>(cluster);
 }
 
 command_t *create_add_block_applications(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_applications), NULL);
-    return esp_matter::command::create(cluster, AddBlockApplications::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_block_applications);
+    return esp_matter::command::create<AddBlockApplications::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_add_block_applications>(cluster);
 }
 
 command_t *create_remove_block_applications(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_applications), NULL);
-    return esp_matter::command::create(cluster, RemoveBlockApplications::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_applications);
+    return esp_matter::command::create<RemoveBlockApplications::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_applications>(cluster);
 }
 
 command_t *create_set_block_content_time_window(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_content_time_window), NULL);
-    return esp_matter::command::create(cluster, SetBlockContentTimeWindow::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_block_content_time_window);
+    return esp_matter::command::create<SetBlockContentTimeWindow::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_set_block_content_time_window>(cluster);
 }
 
 command_t *create_remove_block_content_time_window(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(block_content_time_window), NULL);
-    return esp_matter::command::create(cluster, RemoveBlockContentTimeWindow::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_content_time_window);
+    return esp_matter::command::create<RemoveBlockContentTimeWindow::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_remove_block_content_time_window>(cluster);
 }
 
 } /* command */
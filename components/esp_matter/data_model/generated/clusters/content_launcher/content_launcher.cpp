@@ -161,7 +161,7 @@ attribute_t *create_supported_streaming_protocols(cluster_t *cluster, uint8_t va
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(url_playback), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SupportedStreamingProtocols::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint8_t>(3), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 3>(attribute);
     return attribute;
 }
 
@@ -171,21 +171,21 @@ command_t *create_launch_content(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(content_search), NULL);
-    return esp_matter::command::create(cluster, LaunchContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_content);
+    return esp_matter::command::create<LaunchContent::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_content>(cluster);
 }
 
 command_t *create_launch_url(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(url_playback), NULL);
-    return esp_matter::command::create(cluster, LaunchURL::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_url);
+    return esp_matter::command::create<LaunchURL::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_launch_url>(cluster);
 }
 
 command_t *create_launcher_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(content_search)) || (has_feature(url_playback))), NULL);
-    return esp_matter::command::create(cluster, LauncherResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<LauncherResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -185,7 +185,7 @@ namespace attribute {
 attribute_t *create_esa_type(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ESAType::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(14), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 14>(attribute);
     return attribute;
 }
 
@@ -197,21 +197,21 @@ attribute_t *create_esa_can_generate(cluster_t *cluster, bool value)
 attribute_t *create_esa_state(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ESAState::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(4), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 4>(attribute);
     return attribute;
 }
 
 attribute_t *create_abs_min_power(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, AbsMinPower::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(-2147483648)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, -2147483648, 2147483646>(attribute);
     return attribute;
 }
 
 attribute_t *create_abs_max_power(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, AbsMaxPower::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(-2147483648)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, -2147483648, 2147483646>(attribute);
     return attribute;
 }
 
@@ -234,7 +234,7 @@ attribute_t *create_opt_out_state(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(power_adjustment)) || (has_feature(start_time_adjustment)) || (has_feature(pausable)) || (has_feature(forecast_adjustment)) || (has_feature(constraint_based_adjustment))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, OptOutState::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(3), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 3>(attribute);
     return attribute;
 }
 
@@ -244,56 +244,56 @@ command_t *create_power_adjust_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(power_adjustment), NULL);
-    return esp_matter::command::create(cluster, PowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_power_adjust_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(power_adjustment), NULL);
-    return esp_matter::command::create(cluster, CancelPowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CancelPowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_time_adjust_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(start_time_adjustment), NULL);
-    return esp_matter::command::create(cluster, StartTimeAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StartTimeAdjustRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_pause_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pausable), NULL);
-    return esp_matter::command::create(cluster, PauseRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PauseRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_resume_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pausable), NULL);
-    return esp_matter::command::create(cluster, ResumeRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ResumeRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_modify_forecast_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(forecast_adjustment), NULL);
-    return esp_matter::command::create(cluster, ModifyForecastRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ModifyForecastRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_request_constraint_based_forecast(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(constraint_based_adjustment), NULL);
-    return esp_matter::command::create(cluster, RequestConstraintBasedForecast::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RequestConstraintBasedForecast::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(start_time_adjustment)) || (has_feature(forecast_adjustment)) || (has_feature(constraint_based_adjustment))), NULL);
-    return esp_matter::command::create(cluster, CancelRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CancelRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
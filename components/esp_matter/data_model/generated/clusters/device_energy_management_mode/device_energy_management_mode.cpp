@@ -53,7 +53,7 @@ attribute_t *create_supported_modes(cluster_t *cluster, uint8_t *value, uint16_t
 attribute_t *create_current_mode(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentMode::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -61,12 +61,12 @@ attribute_t *create_current_mode(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_change_to_mode(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ChangeToMode::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ChangeToMode::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_change_to_mode_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -47,12 +47,12 @@ namespace diagnostic_logs {
 namespace command {
 command_t *create_retrieve_logs_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RetrieveLogsRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RetrieveLogsRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_retrieve_logs_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RetrieveLogsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<RetrieveLogsResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
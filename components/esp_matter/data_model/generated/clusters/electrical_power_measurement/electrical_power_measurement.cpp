@@ -134,14 +134,14 @@ namespace attribute {
 attribute_t *create_power_mode(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, PowerMode::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
 attribute_t *create_number_of_measurement_types(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, NumberOfMeasurementTypes::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(32)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 32>(attribute);
     return attribute;
 }
 
@@ -158,77 +158,77 @@ attribute_t *create_ranges(cluster_t *cluster, uint8_t *value, uint16_t length,
 attribute_t *create_voltage(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Voltage::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_active_current(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ActiveCurrent::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_reactive_current(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ReactiveCurrent::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_apparent_current(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ApparentCurrent::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_active_power(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ActivePower::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_reactive_power(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ReactivePower::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_apparent_power(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ApparentPower::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_rms_voltage(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RMSVoltage::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_rms_current(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RMSCurrent::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_rms_power(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RMSPower::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
 attribute_t *create_frequency(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Frequency::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(0)), esp_matter_attr_val(nullable<int64_t>(1000000)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 1000000>(attribute);
     return attribute;
 }
 
@@ -249,14 +249,14 @@ attribute_t *create_harmonic_phases(cluster_t *cluster, uint8_t *value, uint16_t
 attribute_t *create_power_factor(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, PowerFactor::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-10000)), esp_matter_attr_val(nullable<int64_t>(10000)));
+    esp_matter::attribute::add_bounds<int64_t, -10000, 10000>(attribute);
     return attribute;
 }
 
 attribute_t *create_neutral_current(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, NeutralCurrent::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(-4611686018427387904)), esp_matter_attr_val(nullable<int64_t>(4611686018427387904)));
+    esp_matter::attribute::add_bounds<int64_t, -4611686018427387904, 4611686018427387904>(attribute);
     return attribute;
 }
 
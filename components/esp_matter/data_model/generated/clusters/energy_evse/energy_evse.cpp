@@ -145,28 +145,28 @@ namespace attribute {
 attribute_t *create_state(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, State::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(nullable<uint8_t>(6), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 6>(attribute);
     return attribute;
 }
 
 attribute_t *create_supply_state(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SupplyState::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(5), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 5>(attribute);
     return attribute;
 }
 
 attribute_t *create_fault_state(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, FaultState::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(16), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 16>(attribute);
     return attribute;
 }
 
 attribute_t *create_charging_enabled_until(cluster_t *cluster, nullable<uint32_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ChargingEnabledUntil::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -175,28 +175,28 @@ attribute_t *create_discharging_enabled_until(cluster_t *cluster, nullable<uint3
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(v_2_x), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, DischargingEnabledUntil::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_circuit_capacity(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CircuitCapacity::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(0)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
 attribute_t *create_minimum_charge_current(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinimumChargeCurrent::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(0)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
 attribute_t *create_maximum_charge_current(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaximumChargeCurrent::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(0)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
@@ -205,21 +205,21 @@ attribute_t *create_maximum_discharge_current(cluster_t *cluster, int64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(v_2_x), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaximumDischargeCurrent::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(0)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
 attribute_t *create_user_maximum_charge_current(cluster_t *cluster, int64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, UserMaximumChargeCurrent::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int64_t>(-2147483648)), esp_matter_attr_val(static_cast<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, -2147483648, 2147483646>(attribute);
     return attribute;
 }
 
 attribute_t *create_randomization_delay_window(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RandomizationDelayWindow::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(86400)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 86400>(attribute);
     return attribute;
 }
 
@@ -228,7 +228,7 @@ attribute_t *create_next_charge_start_time(cluster_t *cluster, nullable<uint32_t
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, NextChargeStartTime::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -237,7 +237,7 @@ attribute_t *create_next_charge_target_time(cluster_t *cluster, nullable<uint32_
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, NextChargeTargetTime::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -246,7 +246,7 @@ attribute_t *create_next_charge_required_energy(cluster_t *cluster, nullable<int
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, NextChargeRequiredEnergy::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(0)), esp_matter_attr_val(nullable<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
@@ -255,14 +255,14 @@ attribute_t *create_next_charge_target_soc(cluster_t *cluster, nullable<uint8_t>
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, NextChargeTargetSoC::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_approximate_ev_efficiency(cluster_t *cluster, nullable<uint16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ApproximateEVEfficiency::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint16_t>(0)), esp_matter_attr_val(nullable<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -271,7 +271,7 @@ attribute_t *create_state_of_charge(cluster_t *cluster, nullable<uint8_t> value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(so_c_reporting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, StateOfCharge::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -280,7 +280,7 @@ attribute_t *create_battery_capacity(cluster_t *cluster, nullable<int64_t> value
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(so_c_reporting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, BatteryCapacity::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(0)), esp_matter_attr_val(nullable<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
@@ -295,21 +295,21 @@ attribute_t *create_vehicle_id(cluster_t *cluster, char *value, uint16_t length)
 attribute_t *create_session_id(cluster_t *cluster, nullable<uint32_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SessionID::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_session_duration(cluster_t *cluster, nullable<uint32_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SessionDuration::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_session_energy_charged(cluster_t *cluster, nullable<int64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SessionEnergyCharged::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(0)), esp_matter_attr_val(nullable<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
@@ -318,7 +318,7 @@ attribute_t *create_session_energy_discharged(cluster_t *cluster, nullable<int64
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(v_2_x), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SessionEnergyDischarged::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int64_t>(0)), esp_matter_attr_val(nullable<int64_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int64_t, 0, 2147483646>(attribute);
     return attribute;
 }
 
@@ -328,50 +328,50 @@ command_t *create_get_targets_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
-    return esp_matter::command::create(cluster, GetTargetsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetTargetsResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_disable(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Disable::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Disable::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_charging(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnableCharging::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnableCharging::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_discharging(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(v_2_x), NULL);
-    return esp_matter::command::create(cluster, EnableDischarging::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnableDischarging::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_diagnostics(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StartDiagnostics::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StartDiagnostics::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_targets(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
-    return esp_matter::command::create(cluster, SetTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_targets(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
-    return esp_matter::command::create(cluster, GetTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_clear_targets(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(charging_preferences), NULL);
-    return esp_matter::command::create(cluster, ClearTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClearTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
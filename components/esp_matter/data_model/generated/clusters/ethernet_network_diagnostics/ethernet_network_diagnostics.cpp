@@ -88,7 +88,7 @@ namespace attribute {
 attribute_t *create_phy_rate(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, PHYRate::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(nullable<uint8_t>(9), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 9>(attribute);
     return attribute;
 }
 
@@ -102,7 +102,7 @@ attribute_t *create_packet_rx_count(cluster_t *cluster, uint64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(packet_counts), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, PacketRxCount::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -111,7 +111,7 @@ attribute_t *create_packet_tx_count(cluster_t *cluster, uint64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(packet_counts), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, PacketTxCount::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -120,7 +120,7 @@ attribute_t *create_tx_err_count(cluster_t *cluster, uint64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(error_counts), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TxErrCount::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -129,7 +129,7 @@ attribute_t *create_collision_count(cluster_t *cluster, uint64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(error_counts), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, CollisionCount::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -138,7 +138,7 @@ attribute_t *create_overrun_count(cluster_t *cluster, uint64_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(error_counts), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, OverrunCount::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -150,7 +150,7 @@ attribute_t *create_carrier_detect(cluster_t *cluster, nullable<bool> value)
 attribute_t *create_time_since_reset(cluster_t *cluster, uint64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, TimeSinceReset::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -160,7 +160,7 @@ command_t *create_reset_counts(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(packet_counts)) || (has_feature(error_counts))), NULL);
-    return esp_matter::command::create(cluster, ResetCounts::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ResetCounts::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -72,7 +72,7 @@ namespace attribute {
 attribute_t *create_breadcrumb(cluster_t *cluster, uint64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Breadcrumb::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -84,14 +84,14 @@ attribute_t *create_basic_commissioning_info(cluster_t *cluster, uint8_t *value,
 attribute_t *create_regulatory_config(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RegulatoryConfig::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
 attribute_t *create_location_capability(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, LocationCapability::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -105,7 +105,7 @@ attribute_t *create_tc_accepted_version(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(terms_and_conditions), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TCAcceptedVersion::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -114,7 +114,7 @@ attribute_t *create_tc_min_required_version(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(terms_and_conditions), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TCMinRequiredVersion::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -137,7 +137,7 @@ attribute_t *create_tc_update_deadline(cluster_t *cluster, nullable<uint32_t> va
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(terms_and_conditions), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TCUpdateDeadline::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint32_t>(0)), esp_matter_attr_val(nullable<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -145,46 +145,46 @@ attribute_t *create_tc_update_deadline(cluster_t *cluster, nullable<uint32_t> va
 namespace command {
 command_t *create_arm_fail_safe(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ArmFailSafe::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ArmFailSafe::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_arm_fail_safe_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ArmFailSafeResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ArmFailSafeResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_regulatory_config(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetRegulatoryConfig::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetRegulatoryConfig::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_regulatory_config_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetRegulatoryConfigResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SetRegulatoryConfigResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_commissioning_complete(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissioningComplete::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommissioningComplete::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_commissioning_complete_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissioningCompleteResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommissioningCompleteResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_tc_acknowledgements(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(terms_and_conditions), NULL);
-    return esp_matter::command::create(cluster, SetTCAcknowledgements::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTCAcknowledgements::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_tc_acknowledgements_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(terms_and_conditions), NULL);
-    return esp_matter::command::create(cluster, SetTCAcknowledgementsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SetTCAcknowledgementsResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -71,28 +71,28 @@ attribute_t *create_network_interfaces(cluster_t *cluster, uint8_t *value, uint1
 attribute_t *create_reboot_count(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, RebootCount::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_up_time(cluster_t *cluster, uint64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, UpTime::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_total_operational_hours(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, TotalOperationalHours::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_boot_reason(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, BootReason::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(6), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 6>(attribute);
     return attribute;
 }
 
@@ -125,31 +125,31 @@ attribute_t *create_device_load_status(cluster_t *cluster, uint8_t *value, uint1
 namespace command {
 command_t *create_test_event_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TestEventTrigger::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TestEventTrigger::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_time_snapshot(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSnapshot::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TimeSnapshot::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_time_snapshot_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSnapshotResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TimeSnapshotResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_payload_test_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(data_model_test), NULL);
-    return esp_matter::command::create(cluster, PayloadTestRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PayloadTestRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_payload_test_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(data_model_test), NULL);
-    return esp_matter::command::create(cluster, PayloadTestResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<PayloadTestResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
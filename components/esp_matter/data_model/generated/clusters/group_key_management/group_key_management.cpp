@@ -75,14 +75,14 @@ attribute_t *create_group_table(cluster_t *cluster, uint8_t *value, uint16_t len
 attribute_t *create_max_groups_per_fabric(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxGroupsPerFabric::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_max_group_keys_per_fabric(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxGroupKeysPerFabric::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(1)), esp_matter_attr_val(static_cast<uint16_t>(65535)));
+    esp_matter::attribute::add_bounds<uint16_t, 1, 65535>(attribute);
     return attribute;
 }
 
@@ -97,32 +97,32 @@ attribute_t *create_groupcast_adoption(cluster_t *cluster, uint8_t *value, uint1
 namespace command {
 command_t *create_key_set_write(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetWrite::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<KeySetWrite::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetRead::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<KeySetRead::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetReadResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<KeySetReadResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_key_set_remove(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetRemove::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<KeySetRemove::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read_all_indices(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetReadAllIndices::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<KeySetReadAllIndices::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read_all_indices_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeySetReadAllIndicesResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<KeySetReadAllIndicesResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
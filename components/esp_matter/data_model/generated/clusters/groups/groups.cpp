@@ -64,7 +64,7 @@ namespace attribute {
 attribute_t *create_name_support(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, NameSupport::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint8_t>(1), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 1>(attribute);
     return attribute;
 }
 
@@ -72,52 +72,52 @@ attribute_t *create_name_support(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_add_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AddGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_view_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ViewGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ViewGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_view_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ViewGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ViewGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_group_membership(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetGroupMembership::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetGroupMembership::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_group_membership_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetGroupMembershipResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetGroupMembershipResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<RemoveGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_all_groups(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveAllGroups::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveAllGroups::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_group_if_identifying(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddGroupIfIdentifying::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddGroupIfIdentifying::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -125,21 +125,21 @@ namespace attribute {
 attribute_t *create_idle_mode_duration(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, IdleModeDuration::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(1)), esp_matter_attr_val(static_cast<uint32_t>(64800)));
+    esp_matter::attribute::add_bounds<uint32_t, 1, 64800>(attribute);
     return attribute;
 }
 
 attribute_t *create_active_mode_duration(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ActiveModeDuration::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_active_mode_threshold(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ActiveModeThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -155,7 +155,7 @@ attribute_t *create_icd_counter(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ICDCounter::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -164,7 +164,7 @@ attribute_t *create_clients_supported_per_fabric(cluster_t *cluster, uint16_t va
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ClientsSupportedPerFabric::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(1)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 1, 65534>(attribute);
     return attribute;
 }
 
@@ -173,7 +173,7 @@ attribute_t *create_user_active_mode_trigger_hint(cluster_t *cluster, uint32_t v
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(user_active_mode_trigger), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, UserActiveModeTriggerHint::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(131071), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 131071>(attribute);
     return attribute;
 }
 
@@ -188,7 +188,7 @@ attribute_t *create_operating_mode(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(long_idle_time_support), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, OperatingMode::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(1), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 1>(attribute);
     return attribute;
 }
 
@@ -197,7 +197,7 @@ attribute_t *create_maximum_check_in_backoff(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaximumCheckInBackoff::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(64800)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 64800>(attribute);
     return attribute;
 }
 
@@ -207,31 +207,31 @@ command_t *create_register_client(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
-    return esp_matter::command::create(cluster, RegisterClient::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RegisterClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_register_client_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
-    return esp_matter::command::create(cluster, RegisterClientResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<RegisterClientResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_unregister_client(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(check_in_protocol_support), NULL);
-    return esp_matter::command::create(cluster, UnregisterClient::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<UnregisterClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stay_active_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StayActiveRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StayActiveRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stay_active_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StayActiveResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<StayActiveResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
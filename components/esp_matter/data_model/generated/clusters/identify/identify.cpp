@@ -46,14 +46,14 @@ namespace attribute {
 attribute_t *create_identify_time(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, IdentifyTime::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_identify_type(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, IdentifyType::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(5), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 5>(attribute);
     return attribute;
 }
 
@@ -61,12 +61,12 @@ attribute_t *create_identify_type(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_identify(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Identify::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Identify::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_trigger_effect(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TriggerEffect::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TriggerEffect::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
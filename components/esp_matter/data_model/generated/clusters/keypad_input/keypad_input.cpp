@@ -105,12 +105,12 @@ esp_err_t add(cluster_t *cluster)
 namespace command {
 command_t *create_send_key(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SendKey::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_send_key);
+    return esp_matter::command::create<SendKey::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_send_key>(cluster);
 }
 
 command_t *create_send_key_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SendKeyResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SendKeyResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -169,7 +169,7 @@ namespace attribute {
 attribute_t *create_current_level(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentLevel::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -178,63 +178,63 @@ attribute_t *create_remaining_time(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, RemainingTime::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_min_level(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_max_level(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_options(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Options::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint8_t>(3), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 3>(attribute);
     return attribute;
 }
 
 attribute_t *create_on_off_transition_time(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, OnOffTransitionTime::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_on_level(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, OnLevel::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_on_transition_time(cluster_t *cluster, nullable<uint16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, OnTransitionTime::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint16_t>(0)), esp_matter_attr_val(nullable<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_off_transition_time(cluster_t *cluster, nullable<uint16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, OffTransitionTime::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint16_t>(0)), esp_matter_attr_val(nullable<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
 attribute_t *create_default_move_rate(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, DefaultMoveRate::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(1)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 1, 254>(attribute);
     return attribute;
 }
 
@@ -243,7 +243,7 @@ attribute_t *create_start_up_current_level(cluster_t *cluster, nullable<uint8_t>
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, StartUpCurrentLevel::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0)), esp_matter_attr_val(nullable<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -251,42 +251,42 @@ attribute_t *create_start_up_current_level(cluster_t *cluster, nullable<uint8_t>
 namespace command {
 command_t *create_move_to_level(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, MoveToLevel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_level);
+    return esp_matter::command::create<MoveToLevel::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_level>(cluster);
 }
 
 command_t *create_move(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Move::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move);
+    return esp_matter::command::create<Move::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move>(cluster);
 }
 
 command_t *create_step(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Step::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_step);
+    return esp_matter::command::create<Step::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_step>(cluster);
 }
 
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Stop::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop);
+    return esp_matter::command::create<Stop::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop>(cluster);
 }
 
 command_t *create_move_to_level_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, MoveToLevelWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_level_with_on_off);
+    return esp_matter::command::create<MoveToLevelWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_level_with_on_off>(cluster);
 }
 
 command_t *create_move_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, MoveWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_with_on_off);
+    return esp_matter::command::create<MoveWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_with_on_off>(cluster);
 }
 
 command_t *create_step_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StepWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_step_with_on_off);
+    return esp_matter::command::create<StepWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_step_with_on_off>(cluster);
 }
 
 command_t *create_stop_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StopWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop_with_on_off);
+    return esp_matter::command::create<StopWithOnOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop_with_on_off>(cluster);
 }
 
 } /* command */
@@ -57,7 +57,7 @@ namespace low_power {
 namespace command {
 command_t *create_sleep(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Sleep::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_sleep);
+    return esp_matter::command::create<Sleep::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_sleep>(cluster);
 }
 
 } /* command */
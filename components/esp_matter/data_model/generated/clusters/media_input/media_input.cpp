@@ -121,24 +121,24 @@ attribute_t *create_current_input(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_select_input(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SelectInput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_select_input);
+    return esp_matter::command::create<SelectInput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_select_input>(cluster);
 }
 
 command_t *create_show_input_status(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ShowInputStatus::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_show_input_status);
+    return esp_matter::command::create<ShowInputStatus::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_show_input_status>(cluster);
 }
 
 command_t *create_hide_input_status(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, HideInputStatus::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_hide_input_status);
+    return esp_matter::command::create<HideInputStatus::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_hide_input_status>(cluster);
 }
 
 command_t *create_rename_input(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(name_updates), NULL);
-    return esp_matter::command::create(cluster, RenameInput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rename_input);
+    return esp_matter::command::create<RenameInput::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rename_input>(cluster);
 }
 
 } /* command */
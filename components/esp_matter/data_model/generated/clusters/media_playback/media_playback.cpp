@@ -371,89 +371,89 @@ attribute_t *create_available_text_tracks(cluster_t *cluster, uint8_t *value, ui
 namespace command {
 command_t *create_play(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Play::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_play);
+    return esp_matter::command::create<Play::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_play>(cluster);
 }
 
 command_t *create_pause(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Pause::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_pause);
+    return esp_matter::command::create<Pause::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_pause>(cluster);
 }
 
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Stop::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop);
+    return esp_matter::command::create<Stop::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_stop>(cluster);
 }
 
 command_t *create_start_over(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StartOver::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_start_over);
+    return esp_matter::command::create<StartOver::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_start_over>(cluster);
 }
 
 command_t *create_previous(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Previous::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_previous);
+    return esp_matter::command::create<Previous::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_previous>(cluster);
 }
 
 command_t *create_next(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Next::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_next);
+    return esp_matter::command::create<Next::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_next>(cluster);
 }
 
 command_t *create_rewind(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(variable_speed), NULL);
-    return esp_matter::command::create(cluster, Rewind::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rewind);
+    return esp_matter::command::create<Rewind::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_rewind>(cluster);
 }
 
 command_t *create_fast_forward(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(variable_speed), NULL);
-    return esp_matter::command::create(cluster, FastForward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_fast_forward);
+    return esp_matter::command::create<FastForward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_fast_forward>(cluster);
 }
 
 command_t *create_skip_forward(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SkipForward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_forward);
+    return esp_matter::command::create<SkipForward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_forward>(cluster);
 }
 
 command_t *create_skip_backward(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SkipBackward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_backward);
+    return esp_matter::command::create<SkipBackward::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_skip_backward>(cluster);
 }
 
 command_t *create_playback_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PlaybackResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<PlaybackResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_seek(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(advanced_seek), NULL);
-    return esp_matter::command::create(cluster, Seek::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_seek);
+    return esp_matter::command::create<Seek::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_seek>(cluster);
 }
 
 command_t *create_activate_audio_track(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(audio_tracks), NULL);
-    return esp_matter::command::create(cluster, ActivateAudioTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_activate_audio_track);
+    return esp_matter::command::create<ActivateAudioTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_activate_audio_track>(cluster);
 }
 
 command_t *create_activate_text_track(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(text_tracks), NULL);
-    return esp_matter::command::create(cluster, ActivateTextTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_activate_text_track);
+    return esp_matter::command::create<ActivateTextTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_activate_text_track>(cluster);
 }
 
 command_t *create_deactivate_text_track(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(text_tracks), NULL);
-    return esp_matter::command::create(cluster, DeactivateTextTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_deactivate_text_track);
+    return esp_matter::command::create<DeactivateTextTrack::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_deactivate_text_track>(cluster);
 }
 
 } /* command */
@@ -149,12 +149,12 @@ attribute_t *create_active_message_i_ds(cluster_t *cluster, uint8_t *value, uint
 namespace command {
 command_t *create_present_messages_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PresentMessagesRequest::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_present_messages_request);
+    return esp_matter::command::create<PresentMessagesRequest::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_present_messages_request>(cluster);
 }
 
 command_t *create_cancel_messages_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CancelMessagesRequest::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_cancel_messages_request);
+    return esp_matter::command::create<CancelMessagesRequest::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_cancel_messages_request>(cluster);
 }
 
 } /* command */
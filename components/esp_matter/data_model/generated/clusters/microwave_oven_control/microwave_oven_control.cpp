@@ -130,12 +130,12 @@ attribute_t *create_watt_rating(cluster_t *cluster, uint16_t value)
 namespace command {
 command_t *create_set_cooking_parameters(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetCookingParameters::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetCookingParameters::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_more_time(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddMoreTime::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddMoreTime::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -90,12 +90,12 @@ attribute_t *create_on_mode(cluster_t *cluster, nullable<uint8_t> value)
 namespace command {
 command_t *create_change_to_mode(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ChangeToMode::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ChangeToMode::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_change_to_mode_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
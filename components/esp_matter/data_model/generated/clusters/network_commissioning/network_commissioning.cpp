@@ -119,7 +119,7 @@ namespace attribute {
 attribute_t *create_max_networks(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxNetworks::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(1)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 1, 254>(attribute);
     return attribute;
 }
 
@@ -133,7 +133,7 @@ attribute_t *create_scan_max_time_seconds(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ScanMaxTimeSeconds::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -142,7 +142,7 @@ attribute_t *create_connect_max_time_seconds(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ConnectMaxTimeSeconds::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -154,7 +154,7 @@ attribute_t *create_interface_enabled(cluster_t *cluster, bool value)
 attribute_t *create_last_networking_status(cluster_t *cluster, nullable<uint8_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, LastNetworkingStatus::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(nullable<uint8_t>(12), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 12>(attribute);
     return attribute;
 }
 
@@ -166,7 +166,7 @@ attribute_t *create_last_network_id(cluster_t *cluster, uint8_t *value, uint16_t
 attribute_t *create_last_connect_error_value(cluster_t *cluster, nullable<int32_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, LastConnectErrorValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int32_t>(-2147483648)), esp_matter_attr_val(nullable<int32_t>(2147483646)));
+    esp_matter::attribute::add_bounds<int32_t, -2147483648, 2147483646>(attribute);
     return attribute;
 }
 
@@ -182,7 +182,7 @@ attribute_t *create_supported_thread_features(cluster_t *cluster, uint16_t value
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(thread_network_interface), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SupportedThreadFeatures::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint16_t>(65535), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65535>(attribute);
     return attribute;
 }
 
@@ -191,7 +191,7 @@ attribute_t *create_thread_version(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(thread_network_interface), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ThreadVersion::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -201,63 +201,63 @@ command_t *create_scan_networks(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, ScanNetworks::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScanNetworks::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_scan_networks_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, ScanNetworksResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScanNetworksResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_add_or_update_wi_fi_network(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(wi_fi_network_interface), NULL);
-    return esp_matter::command::create(cluster, AddOrUpdateWiFiNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddOrUpdateWiFiNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_or_update_thread_network(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(thread_network_interface), NULL);
-    return esp_matter::command::create(cluster, AddOrUpdateThreadNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddOrUpdateThreadNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_network(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, RemoveNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_network_config_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, NetworkConfigResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NetworkConfigResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_connect_network(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, ConnectNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ConnectNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_connect_network_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, ConnectNetworkResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ConnectNetworkResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_reorder_network(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(wi_fi_network_interface)) || (has_feature(thread_network_interface))), NULL);
-    return esp_matter::command::create(cluster, ReorderNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ReorderNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -55,7 +55,7 @@ attribute_t *create_clients(cluster_t *cluster, uint8_t *value, uint16_t length,
 attribute_t *create_client_table_size(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ClientTableSize::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(500)), esp_matter_attr_val(static_cast<uint16_t>(2047)));
+    esp_matter::attribute::add_bounds<uint16_t, 500, 2047>(attribute);
     return attribute;
 }
 
@@ -63,42 +63,42 @@ attribute_t *create_client_table_size(cluster_t *cluster, uint16_t value)
 namespace command {
 command_t *create_add_client(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddClient::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_client_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddClientResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AddClientResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_client(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveClient::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_query_identity(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, QueryIdentity::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<QueryIdentity::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_query_identity_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, QueryIdentityResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<QueryIdentityResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_import_admin_secret(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ImportAdminSecret::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ImportAdminSecret::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_export_admin_secret(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ExportAdminSecret::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ExportAdminSecret::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_export_admin_secret_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ExportAdminSecretResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ExportAdminSecretResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -195,7 +195,7 @@ attribute_t *create_on_time(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, OnTime::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -204,7 +204,7 @@ attribute_t *create_off_wait_time(cluster_t *cluster, uint16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, OffWaitTime::Id, ATTRIBUTE_FLAG_WRITABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -213,7 +213,7 @@ attribute_t *create_start_up_on_off(cluster_t *cluster, nullable<uint8_t> value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, StartUpOnOff::Id, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(nullable<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -221,42 +221,42 @@ attribute_t *create_start_up_on_off(cluster_t *cluster, nullable<uint8_t> value)
 namespace command {
 command_t *create_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Off::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_off);
+    return esp_matter::command::create<Off::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_off>(cluster);
 }
 
 command_t *create_on(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(!(has_feature(off_only)), NULL);
-    return esp_matter::command::create(cluster, On::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on);
+    return esp_matter::command::create<On::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on>(cluster);
 }
 
 command_t *create_toggle(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(!(has_feature(off_only)), NULL);
-    return esp_matter::command::create(cluster, Toggle::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_toggle);
+    return esp_matter::command::create<Toggle::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_toggle>(cluster);
 }
 
 command_t *create_off_with_effect(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
-    return esp_matter::command::create(cluster, OffWithEffect::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_off_with_effect);
+    return esp_matter::command::create<OffWithEffect::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_off_with_effect>(cluster);
 }
 
 command_t *create_on_with_recall_global_scene(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
-    return esp_matter::command::create(cluster, OnWithRecallGlobalScene::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on_with_recall_global_scene);
+    return esp_matter::command::create<OnWithRecallGlobalScene::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on_with_recall_global_scene>(cluster);
 }
 
 command_t *create_on_with_timed_off(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(lighting), NULL);
-    return esp_matter::command::create(cluster, OnWithTimedOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on_with_timed_off);
+    return esp_matter::command::create<OnWithTimedOff::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_on_with_timed_off>(cluster);
 }
 
 } /* command */
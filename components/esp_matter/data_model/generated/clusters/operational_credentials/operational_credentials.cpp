@@ -56,14 +56,14 @@ attribute_t *create_fabrics(cluster_t *cluster, uint8_t *value, uint16_t length,
 attribute_t *create_supported_fabrics(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SupportedFabrics::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(5)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 5, 254>(attribute);
     return attribute;
 }
 
 attribute_t *create_commissioned_fabrics(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CommissionedFabrics::Id, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -75,7 +75,7 @@ attribute_t *create_trusted_root_certificates(cluster_t *cluster, uint8_t *value
 attribute_t *create_current_fabric_index(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentFabricIndex::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 254>(attribute);
     return attribute;
 }
 
@@ -83,77 +83,77 @@ attribute_t *create_current_fabric_index(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_attestation_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AttestationRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AttestationRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_attestation_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AttestationResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AttestationResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_certificate_chain_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CertificateChainRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CertificateChainRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_certificate_chain_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CertificateChainResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CertificateChainResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_csr_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CSRRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CSRRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_csr_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CSRResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CSRResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_add_noc(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddNOC::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddNOC::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_update_noc(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, UpdateNOC::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<UpdateNOC::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_noc_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NOCResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NOCResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_update_fabric_label(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, UpdateFabricLabel::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<UpdateFabricLabel::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_fabric(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveFabric::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveFabric::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_trusted_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddTrustedRootCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddTrustedRootCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_vid_verification_statement(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetVIDVerificationStatement::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetVIDVerificationStatement::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_sign_vid_verification_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SignVIDVerificationRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SignVIDVerificationRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_sign_vid_verification_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SignVIDVerificationResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SignVIDVerificationResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
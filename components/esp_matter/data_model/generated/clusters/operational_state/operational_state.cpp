@@ -78,28 +78,28 @@ attribute_t *create_operational_error(cluster_t *cluster, uint8_t *value, uint16
 namespace command {
 command_t *create_pause(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Pause::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Pause::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Stop::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Stop::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Start::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Start::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_resume(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Resume::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Resume::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_operational_command_response(cluster_t *cluster)
 {
     VerifyOrReturnValue(((has_command(Pause, COMMAND_FLAG_ACCEPTED)) || (has_command(Stop, COMMAND_FLAG_ACCEPTED)) || (has_command(Start, COMMAND_FLAG_ACCEPTED)) || (has_command(Resume, COMMAND_FLAG_ACCEPTED))), NULL);
-    return esp_matter::command::create(cluster, OperationalCommandResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCommandResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -47,27 +47,27 @@ namespace ota_software_update_provider {
 namespace command {
 command_t *create_query_image(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, QueryImage::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<QueryImage::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_query_image_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, QueryImageResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<QueryImageResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_apply_update_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ApplyUpdateRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ApplyUpdateRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_apply_update_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ApplyUpdateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ApplyUpdateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_notify_update_applied(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NotifyUpdateApplied::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NotifyUpdateApplied::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
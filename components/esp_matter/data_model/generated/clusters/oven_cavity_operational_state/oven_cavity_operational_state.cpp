@@ -78,17 +78,17 @@ attribute_t *create_operational_error(cluster_t *cluster, uint8_t *value, uint16
 namespace command {
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Stop::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<Stop::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 command_t *create_start(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Start::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<Start::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 command_t *create_operational_command_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCommandResponse::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<OperationalCommandResponse::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 } /* command */
@@ -189,7 +189,7 @@ attribute_t *create_peak_measured_value_window(cluster_t *cluster, uint32_t valu
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(peak_measurement), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, PeakMeasuredValueWindow::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(604800)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 604800>(attribute);
     return attribute;
 }
 
@@ -205,7 +205,7 @@ attribute_t *create_average_measured_value_window(cluster_t *cluster, uint32_t v
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(average_measurement), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, AverageMeasuredValueWindow::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0)), esp_matter_attr_val(static_cast<uint32_t>(604800)));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 604800>(attribute);
     return attribute;
 }
 
@@ -219,14 +219,14 @@ attribute_t *create_measurement_unit(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(numeric_measurement), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MeasurementUnit::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(7), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 7>(attribute);
     return attribute;
 }
 
 attribute_t *create_measurement_medium(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MeasurementMedium::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -235,7 +235,7 @@ attribute_t *create_level_value(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(level_indication), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, LevelValue::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(4), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 4>(attribute);
     return attribute;
 }
 
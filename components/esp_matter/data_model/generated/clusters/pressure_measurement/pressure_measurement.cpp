@@ -68,28 +68,28 @@ namespace attribute {
 attribute_t *create_measured_value(cluster_t *cluster, nullable<int16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MeasuredValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
 attribute_t *create_min_measured_value(cluster_t *cluster, nullable<int16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinMeasuredValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
 attribute_t *create_max_measured_value(cluster_t *cluster, nullable<int16_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxMeasuredValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32767)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32767>(attribute);
     return attribute;
 }
 
 attribute_t *create_tolerance(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Tolerance::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(2048)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 2048>(attribute);
     return attribute;
 }
 
@@ -98,7 +98,7 @@ attribute_t *create_scaled_value(cluster_t *cluster, nullable<int16_t> value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(extended), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, ScaledValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -107,7 +107,7 @@ attribute_t *create_min_scaled_value(cluster_t *cluster, nullable<int16_t> value
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(extended), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinScaledValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -116,14 +116,14 @@ attribute_t *create_max_scaled_value(cluster_t *cluster, nullable<int16_t> value
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(extended), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxScaledValue::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<int16_t>(-32768)), esp_matter_attr_val(nullable<int16_t>(32767)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32767>(attribute);
     return attribute;
 }
 
 attribute_t *create_scaled_tolerance(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, ScaledTolerance::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(2048)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 2048>(attribute);
     return attribute;
 }
 
@@ -132,7 +132,7 @@ attribute_t *create_scale(cluster_t *cluster, int8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(extended), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, Scale::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int8_t>(-127)), esp_matter_attr_val(static_cast<int8_t>(126)));
+    esp_matter::attribute::add_bounds<int8_t, -127, 126>(attribute);
     return attribute;
 }
 
@@ -77,42 +77,42 @@ attribute_t *create_current_connections(cluster_t *cluster, uint8_t *value, uint
 namespace command {
 command_t *create_allocate_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AllocatePushTransport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AllocatePushTransport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_allocate_push_transport_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AllocatePushTransportResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AllocatePushTransportResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_deallocate_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeallocatePushTransport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeallocatePushTransport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_modify_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ModifyPushTransport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ModifyPushTransport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_transport_status(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetTransportStatus::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTransportStatus::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_manually_trigger_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ManuallyTriggerTransport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ManuallyTriggerTransport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindTransport::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<FindTransport::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_transport_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindTransportResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<FindTransportResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
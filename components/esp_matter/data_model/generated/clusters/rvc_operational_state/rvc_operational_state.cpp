@@ -78,22 +78,22 @@ attribute_t *create_operational_error(cluster_t *cluster, uint8_t *value, uint16
 namespace command {
 command_t *create_pause(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Pause::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<Pause::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 command_t *create_resume(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Resume::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<Resume::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 command_t *create_operational_command_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCommandResponse::Id, COMMAND_FLAG_NONE, NULL);
+    return esp_matter::command::create<OperationalCommandResponse::Id, COMMAND_FLAG_NONE>(cluster);
 }
 
 command_t *create_go_home(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GoHome::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GoHome::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
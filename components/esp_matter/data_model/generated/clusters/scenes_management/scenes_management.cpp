@@ -64,7 +64,7 @@ namespace attribute {
 attribute_t *create_scene_table_size(cluster_t *cluster, uint16_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, SceneTableSize::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint16_t>(0)), esp_matter_attr_val(static_cast<uint16_t>(65534)));
+    esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(attribute);
     return attribute;
 }
 
@@ -77,78 +77,78 @@ attribute_t *create_fabric_scene_info(cluster_t *cluster, uint8_t *value, uint16
 namespace command {
 command_t *create_add_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AddSceneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_view_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ViewScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ViewScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_view_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ViewSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ViewSceneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<RemoveSceneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_all_scenes(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveAllScenes::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveAllScenes::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_all_scenes_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveAllScenesResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<RemoveAllScenesResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_store_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StoreScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<StoreScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_store_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, StoreSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<StoreSceneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_recall_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RecallScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RecallScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_scene_membership(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetSceneMembership::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetSceneMembership::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_scene_membership_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetSceneMembershipResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GetSceneMembershipResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_copy_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CopyScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CopyScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_copy_scene_response(cluster_t *cluster)
 {
     VerifyOrReturnValue(has_command(CopyScene, COMMAND_FLAG_ACCEPTED), NULL);
-    return esp_matter::command::create(cluster, CopySceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CopySceneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
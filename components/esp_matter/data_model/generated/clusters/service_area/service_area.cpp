@@ -132,23 +132,23 @@ attribute_t *create_progress(cluster_t *cluster, uint8_t *value, uint16_t length
 namespace command {
 command_t *create_select_areas(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SelectAreas::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SelectAreas::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_select_areas_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SelectAreasResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SelectAreasResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_skip_area(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SkipArea::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SkipArea::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_skip_area_response(cluster_t *cluster)
 {
     VerifyOrReturnValue(has_command(SkipArea, COMMAND_FLAG_ACCEPTED), NULL);
-    return esp_matter::command::create(cluster, SkipAreaResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SkipAreaResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
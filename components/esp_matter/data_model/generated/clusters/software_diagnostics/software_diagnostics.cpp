@@ -72,14 +72,14 @@ attribute_t *create_thread_metrics(cluster_t *cluster, uint8_t *value, uint16_t
 attribute_t *create_current_heap_free(cluster_t *cluster, uint64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentHeapFree::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_current_heap_used(cluster_t *cluster, uint64_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentHeapUsed::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -88,7 +88,7 @@ attribute_t *create_current_heap_high_watermark(cluster_t *cluster, uint64_t val
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(watermarks), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, CurrentHeapHighWatermark::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint64_t>(0)), esp_matter_attr_val(static_cast<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -98,7 +98,7 @@ command_t *create_reset_watermarks(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(watermarks), NULL);
-    return esp_matter::command::create(cluster, ResetWatermarks::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ResetWatermarks::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -69,12 +69,12 @@ attribute_t *create_current_target(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_navigate_target(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NavigateTarget::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_navigate_target);
+    return esp_matter::command::create<NavigateTarget::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_navigate_target>(cluster);
 }
 
 command_t *create_navigate_target_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NavigateTargetResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NavigateTargetResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
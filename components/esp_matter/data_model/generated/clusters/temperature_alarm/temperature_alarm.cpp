@@ -250,7 +250,7 @@ namespace attribute {
 attribute_t *create_mask(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Mask::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(4294967295), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967295>(attribute);
     return attribute;
 }
 
@@ -259,21 +259,21 @@ attribute_t *create_latch(cluster_t *cluster, uint32_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(reset), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, Latch::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(4294967295), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967295>(attribute);
     return attribute;
 }
 
 attribute_t *create_state(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, State::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(4294967295), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967295>(attribute);
     return attribute;
 }
 
 attribute_t *create_supported(cluster_t *cluster, uint32_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Supported::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_bitmap));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint32_t>(0), esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(static_cast<uint32_t>(4294967295), esp_matter_attr_val::uint_sub_type::k_bitmap));
+    esp_matter::attribute::add_bounds<uint32_t, 0, 4294967295>(attribute);
     return attribute;
 }
 
@@ -282,7 +282,7 @@ attribute_t *create_critical_over_temperature_threshold(cluster_t *cluster, int1
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(over_temperature), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, CriticalOverTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -291,7 +291,7 @@ attribute_t *create_major_over_temperature_threshold(cluster_t *cluster, int16_t
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(over_temperature)) && (has_feature(major_threshold))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MajorOverTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -300,7 +300,7 @@ attribute_t *create_minor_over_temperature_threshold(cluster_t *cluster, int16_t
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(over_temperature)) && (has_feature(minor_threshold))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinorOverTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -309,7 +309,7 @@ attribute_t *create_minor_under_temperature_threshold(cluster_t *cluster, int16_
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(under_temperature)) && (has_feature(minor_threshold))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinorUnderTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -318,7 +318,7 @@ attribute_t *create_major_under_temperature_threshold(cluster_t *cluster, int16_
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(under_temperature)) && (has_feature(major_threshold))), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MajorUnderTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -327,7 +327,7 @@ attribute_t *create_critical_under_temperature_threshold(cluster_t *cluster, int
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(under_temperature), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, CriticalUnderTemperatureThreshold::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -337,19 +337,19 @@ command_t *create_reset(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(reset), NULL);
-    return esp_matter::command::create(cluster, Reset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Reset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_modify_enabled_alarms(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ModifyEnabledAlarms::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ModifyEnabledAlarms::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_temperature_alarm_thresholds(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(over_critical_adjustable)) || (has_feature(over_major_adjustable)) || (has_feature(over_minor_adjustable)) || (has_feature(under_minor_adjustable)) || (has_feature(under_major_adjustable)) || (has_feature(under_critical_adjustable))), NULL);
-    return esp_matter::command::create(cluster, SetTemperatureAlarmThresholds::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTemperatureAlarmThresholds::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -109,7 +109,7 @@ attribute_t *create_temperature_setpoint(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(temperature_number), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TemperatureSetpoint::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -118,7 +118,7 @@ attribute_t *create_min_temperature(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(temperature_number), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MinTemperature::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -127,7 +127,7 @@ attribute_t *create_max_temperature(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(temperature_number), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxTemperature::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(-32768)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, -32768, 32766>(attribute);
     return attribute;
 }
 
@@ -136,7 +136,7 @@ attribute_t *create_step(cluster_t *cluster, int16_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(temperature_step), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, Step::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<int16_t>(1)), esp_matter_attr_val(static_cast<int16_t>(32766)));
+    esp_matter::attribute::add_bounds<int16_t, 1, 32766>(attribute);
     return attribute;
 }
 
@@ -145,7 +145,7 @@ attribute_t *create_selected_temperature_level(cluster_t *cluster, uint8_t value
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(temperature_level), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, SelectedTemperatureLevel::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0)), esp_matter_attr_val(static_cast<uint8_t>(31)));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 31>(attribute);
     return attribute;
 }
 
@@ -160,7 +160,7 @@ attribute_t *create_supported_temperature_levels(cluster_t *cluster, uint8_t *va
 namespace command {
 command_t *create_set_temperature(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetTemperature::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTemperature::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -97,29 +97,29 @@ attribute_t *create_pending_dataset_timestamp(cluster_t *cluster, nullable<uint6
 namespace command {
 command_t *create_get_active_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetActiveDatasetRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetActiveDatasetRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_pending_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetPendingDatasetRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetPendingDatasetRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dataset_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DatasetResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<DatasetResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_active_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetActiveDatasetRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetActiveDatasetRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_pending_dataset_request(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(pan_change), NULL);
-    return esp_matter::command::create(cluster, SetPendingDatasetRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetPendingDatasetRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -61,22 +61,22 @@ attribute_t *create_thread_network_table_size(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_add_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AddNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<AddNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveNetwork::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveNetwork::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_operational_dataset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GetOperationalDataset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GetOperationalDataset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_operational_dataset_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalDatasetResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalDatasetResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -133,21 +133,21 @@ namespace attribute {
 attribute_t *create_utc_time(cluster_t *cluster, nullable<uint64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, UTCTime::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint64_t>(0)), esp_matter_attr_val(nullable<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
 attribute_t *create_granularity(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, Granularity::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(4), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 4>(attribute);
     return attribute;
 }
 
 attribute_t *create_time_source(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, TimeSource::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(16), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 16>(attribute);
     return attribute;
 }
 
@@ -185,7 +185,7 @@ attribute_t *create_local_time(cluster_t *cluster, nullable<uint64_t> value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, LocalTime::Id, ATTRIBUTE_FLAG_NULLABLE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint64_t>(0)), esp_matter_attr_val(nullable<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -194,7 +194,7 @@ attribute_t *create_time_zone_database(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TimeZoneDatabase::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value, esp_matter_attr_val::uint_sub_type::k_enum));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(0), esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(static_cast<uint8_t>(2), esp_matter_attr_val::uint_sub_type::k_enum));
+    esp_matter::attribute::add_bounds<uint8_t, 0, 2>(attribute);
     return attribute;
 }
 
@@ -210,7 +210,7 @@ attribute_t *create_time_zone_list_max_size(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, TimeZoneListMaxSize::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(1)), esp_matter_attr_val(static_cast<uint8_t>(2)));
+    esp_matter::attribute::add_bounds<uint8_t, 1, 2>(attribute);
     return attribute;
 }
 
@@ -219,7 +219,7 @@ attribute_t *create_dst_offset_list_max_size(cluster_t *cluster, uint8_t value)
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
     attribute_t *attribute = esp_matter::attribute::create(cluster, DSTOffsetListMaxSize::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(1)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 1, 254>(attribute);
     return attribute;
 }
 
@@ -234,42 +234,42 @@ attribute_t *create_supports_dns_resolve(cluster_t *cluster, bool value)
 namespace command {
 command_t *create_set_utc_time(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SetUTCTime::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetUTCTime::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_trusted_time_source(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_sync_client), NULL);
-    return esp_matter::command::create(cluster, SetTrustedTimeSource::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTrustedTimeSource::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_time_zone(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
-    return esp_matter::command::create(cluster, SetTimeZone::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetTimeZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_time_zone_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
-    return esp_matter::command::create(cluster, SetTimeZoneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SetTimeZoneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_dst_offset(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(time_zone), NULL);
-    return esp_matter::command::create(cluster, SetDSTOffset::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetDSTOffset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_default_ntp(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(ntp_client), NULL);
-    return esp_matter::command::create(cluster, SetDefaultNTP::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SetDefaultNTP::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
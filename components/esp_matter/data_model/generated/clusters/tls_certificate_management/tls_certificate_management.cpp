@@ -46,7 +46,7 @@ namespace attribute {
 attribute_t *create_max_root_certificates(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxRootCertificates::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(5)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 5, 254>(attribute);
     return attribute;
 }
 
@@ -58,7 +58,7 @@ attribute_t *create_provisioned_root_certificates(cluster_t *cluster, uint8_t *v
 attribute_t *create_max_client_certificates(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxClientCertificates::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(2)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 2, 254>(attribute);
     return attribute;
 }
 
@@ -71,77 +71,77 @@ attribute_t *create_provisioned_client_certificates(cluster_t *cluster, uint8_t
 namespace command {
 command_t *create_provision_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvisionRootCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvisionRootCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provision_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvisionRootCertificateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ProvisionRootCertificateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_find_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindRootCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<FindRootCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindRootCertificateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<FindRootCertificateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_lookup_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LookupRootCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<LookupRootCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_lookup_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LookupRootCertificateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<LookupRootCertificateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveRootCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveRootCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_client_csr(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClientCSR::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClientCSR::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_client_csr_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClientCSRResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ClientCSRResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provision_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvisionClientCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvisionClientCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindClientCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<FindClientCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_client_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindClientCertificateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<FindClientCertificateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_lookup_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LookupClientCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<LookupClientCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_lookup_client_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LookupClientCertificateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<LookupClientCertificateResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveClientCertificate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveClientCertificate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -46,7 +46,7 @@ namespace attribute {
 attribute_t *create_max_provisioned(cluster_t *cluster, uint8_t value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, MaxProvisioned::Id, ATTRIBUTE_FLAG_NONE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(static_cast<uint8_t>(5)), esp_matter_attr_val(static_cast<uint8_t>(254)));
+    esp_matter::attribute::add_bounds<uint8_t, 5, 254>(attribute);
     return attribute;
 }
 
@@ -59,27 +59,27 @@ attribute_t *create_provisioned_endpoints(cluster_t *cluster, uint8_t *value, ui
 namespace command {
 command_t *create_provision_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvisionEndpoint::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvisionEndpoint::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provision_endpoint_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvisionEndpointResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ProvisionEndpointResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_find_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindEndpoint::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<FindEndpoint::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_endpoint_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FindEndpointResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<FindEndpointResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveEndpoint::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveEndpoint::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -120,12 +120,12 @@ attribute_t *create_boost_state(cluster_t *cluster, uint8_t value)
 namespace command {
 command_t *create_boost(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Boost::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Boost::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_boost(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CancelBoost::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CancelBoost::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -52,37 +52,37 @@ attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_
 namespace command {
 command_t *create_solicit_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SolicitOffer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SolicitOffer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_solicit_offer_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SolicitOfferResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<SolicitOfferResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provide_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvideOffer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvideOffer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provide_offer_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvideOfferResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ProvideOfferResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provide_answer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvideAnswer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvideAnswer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provide_ice_candidates(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ProvideICECandidates::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ProvideICECandidates::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_end_session(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EndSession::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EndSession::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -52,22 +52,22 @@ attribute_t *create_current_sessions(cluster_t *cluster, uint8_t *value, uint16_
 namespace command {
 command_t *create_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Offer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Offer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_answer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Answer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Answer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_ice_candidates(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ICECandidates::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ICECandidates::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_end(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, End::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<End::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -51,7 +51,7 @@ attribute_t *create_ssid(cluster_t *cluster, uint8_t *value, uint16_t length)
 attribute_t *create_passphrase_surrogate(cluster_t *cluster, nullable<uint64_t> value)
 {
     attribute_t *attribute = esp_matter::attribute::create(cluster, PassphraseSurrogate::Id, ATTRIBUTE_FLAG_NULLABLE | ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_attr_val(value));
-    esp_matter::attribute::add_bounds(attribute, esp_matter_attr_val(nullable<uint64_t>(0)), esp_matter_attr_val(nullable<uint64_t>(4294967294)));
+    esp_matter::attribute::add_bounds<uint64_t, 0, 4294967294>(attribute);
     return attribute;
 }
 
@@ -59,12 +59,12 @@ attribute_t *create_passphrase_surrogate(cluster_t *cluster, nullable<uint64_t>
 namespace command {
 command_t *create_network_passphrase_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkPassphraseRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkPassphraseRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_network_passphrase_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkPassphraseResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NetworkPassphraseResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
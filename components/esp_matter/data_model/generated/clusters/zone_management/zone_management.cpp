@@ -172,38 +172,38 @@ command_t *create_create_two_d_cartesian_zone(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(two_dimensional_cartesian_zone)) && (has_feature(user_defined))), NULL);
-    return esp_matter::command::create(cluster, CreateTwoDCartesianZone::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CreateTwoDCartesianZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_create_two_d_cartesian_zone_response(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(two_dimensional_cartesian_zone)) && (has_feature(user_defined))), NULL);
-    return esp_matter::command::create(cluster, CreateTwoDCartesianZoneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CreateTwoDCartesianZoneResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_update_two_d_cartesian_zone(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(((has_feature(two_dimensional_cartesian_zone)) && (has_feature(user_defined))), NULL);
-    return esp_matter::command::create(cluster, UpdateTwoDCartesianZone::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<UpdateTwoDCartesianZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_zone(cluster_t *cluster)
 {
     uint32_t feature_map = get_feature_map_value(cluster);
     VerifyOrReturnValue(has_feature(user_defined), NULL);
-    return esp_matter::command::create(cluster, RemoveZone::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_create_or_update_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CreateOrUpdateTrigger::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CreateOrUpdateTrigger::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, RemoveTrigger::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<RemoveTrigger::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
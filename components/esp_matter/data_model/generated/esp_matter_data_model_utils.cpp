@@ -13,8 +13,11 @@
 // limitations under the License.
 
 #include <esp_matter_attribute_utils.h>
+#include <esp_matter_boot_profile.h>
 #include <esp_matter_core.h>
 #include <esp_matter_data_model_utils.h>
+#include <esp_matter_nvs.h>
+#include <esp_matter_trace.h>
 
 static const char *TAG = "data_model";
 
@@ -54,10 +57,15 @@ namespace node {
 node_t *create(config_t *config, attribute::callback_t attribute_callback,
                identification::callback_t identification_callback, void* priv_data)
 {
+    boot_profile::begin(boot_profile::PHASE_NODE_BUILD);
     node_t *node = create_raw();
     /* Initialize esp-matter nvs partition */
     VerifyOrReturnValue(esp_matter_nvs_init() == ESP_OK, NULL, ESP_LOGE(TAG, "Failed to init esp-matter nvs partition"));
     VerifyOrReturnValue(node != nullptr, NULL, ESP_LOGE(TAG, "Could not create node"));
+    /* The attributes of the node are restored with one NVS handle until esp_matter::start() */
+    if (attribute::begin_nvs_restore() != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to open the attributes in NVS, they are restored one by one");
+    }
     endpoint_t *endpoint = esp_matter::endpoint::root_node::create(node, &(config->root_node), ENDPOINT_FLAG_NONE, priv_data);
     if (endpoint == nullptr) {
         destroy_raw();
@@ -133,7 +141,11 @@ void dispatch_single_cluster_command(const ConcreteCommandPath &command_path, TL
     uint16_t endpoint_id = command_path.mEndpointId;
     uint32_t cluster_id = command_path.mClusterId;
     uint32_t command_id = command_path.mCommandId;
-    ESP_LOGI(TAG, "Received command 0x%08" PRIX32 " for endpoint 0x%04" PRIX16 "'s cluster 0x%08" PRIX32 "", command_id, endpoint_id, cluster_id);
+    /* With CONFIG_ESP_MATTER_TRACE the commands are recorded in the binary trace instead of being printed */
+    int64_t trace_start = trace::begin();
+    if (!trace::is_enabled()) {
+        ESP_LOGI(TAG, "Received command 0x%08" PRIX32 " for endpoint 0x%04" PRIX16 "'s cluster 0x%08" PRIX32 "", command_id, endpoint_id, cluster_id);
+    }
 
     cluster_t *cluster = cluster::get(endpoint_id, cluster_id);
     VerifyOrReturn(cluster);
@@ -151,6 +163,7 @@ void dispatch_single_cluster_command(const ConcreteCommandPath &command_path, TL
         if ((err == ESP_OK) && callback) {
             err = callback(command_path, tlv_data, opaque_ptr);
         }
+        trace::record(trace::EVENT_COMMAND, endpoint_id, cluster_id, command_id, 0, 0, err, trace_start);
         int flags = get_flags(command);
         if (flags & COMMAND_FLAG_CUSTOM) {
             chip::app::CommandHandler *command_obj = (chip::app::CommandHandler *)opaque_ptr;
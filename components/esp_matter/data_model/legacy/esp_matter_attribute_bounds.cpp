@@ -43,8 +43,7 @@ void add_bounds_cb(cluster_t *cluster)
         switch (esp_matter::attribute::get_id(current_attribute)) {
 
         case ScenesManagement::Attributes::SceneTableSize::Id: {
-            uint16_t min = 16, max = UINT16_MAX;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint16_t, 16, UINT16_MAX>(current_attribute);
             break;
         }
         default:
@@ -66,8 +65,7 @@ void add_bounds_cb(cluster_t *cluster)
         switch (esp_matter::attribute::get_id(current_attribute)) {
 
         case OnOff::Attributes::StartUpOnOff::Id: {
-            nullable<uint8_t> min = 0, max = 2;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 2>(current_attribute);
             break;
         }
         default:
@@ -105,8 +103,7 @@ void add_bounds_cb(cluster_t *cluster)
             break;
         }
         case LevelControl::Attributes::MinLevel::Id: {
-            uint8_t min = 1, max = 254;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 1, 254>(current_attribute);
             break;
         }
         case LevelControl::Attributes::MaxLevel::Id: {
@@ -170,8 +167,7 @@ void add_bounds_cb(cluster_t *cluster)
             break;
         }
         case LevelControl::Attributes::Options::Id: {
-            uint8_t min = 0, max = 3;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_bitmap));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 3>(current_attribute);
             break;
         }
         default:
@@ -195,13 +191,11 @@ void add_bounds_cb(cluster_t *cluster)
 
         case ColorControl::Attributes::CurrentHue::Id:
         case ColorControl::Attributes::CurrentSaturation::Id: {
-            uint8_t min = 0, max = 254;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 254>(current_attribute);
             break;
         }
         case ColorControl::Attributes::RemainingTime::Id: {
-            uint16_t min = 0, max = 65534;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint16_t, 0, 65534>(current_attribute);
             break;
         }
         case ColorControl::Attributes::CurrentX::Id:
@@ -229,49 +223,42 @@ void add_bounds_cb(cluster_t *cluster)
         case ColorControl::Attributes::ColorPointBY::Id:
         case ColorControl::Attributes::ColorTempPhysicalMinMireds::Id:
         case ColorControl::Attributes::ColorTempPhysicalMaxMireds::Id: {
-            uint16_t min = 0, max = 65279;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint16_t, 0, 65279>(current_attribute);
             break;
         }
         case ColorControl::Attributes::DriftCompensation::Id: {
-            uint8_t min = 0, max = 4;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 4>(current_attribute);
             break;
         }
         case ColorControl::Attributes::ColorMode::Id: {
-            uint8_t min = 0, max = 2;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 2>(current_attribute);
             break;
         }
         case ColorControl::Attributes::Options::Id: {
-            uint8_t min = 0, max = 1;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_bitmap));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 1>(current_attribute);
             break;
         }
         case ColorControl::Attributes::NumberOfPrimaries::Id: {
-            nullable<uint8_t> min = 0, max = 6;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 6>(current_attribute);
             break;
         }
         case ColorControl::Attributes::EnhancedColorMode::Id: {
-            uint8_t min = 0, max = 3;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 3>(current_attribute);
             break;
         }
         case ColorControl::Attributes::ColorLoopActive::Id:
         case ColorControl::Attributes::ColorLoopDirection::Id: {
+            // Kept as copied bounds, their exact type check leaves the enum ColorLoopDirection without bounds
             uint8_t min = 0, max = 1;
             esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
             break;
         }
         case ColorControl::Attributes::ColorCapabilities::Id: {
-            uint16_t min = 0, max = 31;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_bitmap), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_bitmap));
+            esp_matter::attribute::add_bounds<uint16_t, 0, 31>(current_attribute);
             break;
         }
         case ColorControl::Attributes::StartUpColorTemperatureMireds::Id: {
-            nullable<uint16_t> min = 0, max = 65279;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint16_t, 0, 65279>(current_attribute);
             break;
         }
         case ColorControl::Attributes::CoupleColorTempToLevelMinMireds::Id: {
@@ -309,28 +296,23 @@ void add_bounds_cb(cluster_t *cluster)
         switch (esp_matter::attribute::get_id(current_attribute)) {
 
         case FanControl::Attributes::FanMode::Id: {
-            uint8_t min = 0, max = 6;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 6>(current_attribute);
             break;
         }
         case FanControl::Attributes::FanModeSequence::Id: {
-            uint8_t min = 0, max = 5;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 5>(current_attribute);
             break;
         }
         case FanControl::Attributes::PercentSetting::Id: {
-            nullable<uint8_t> min = 0, max = 100;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 100>(current_attribute);
             break;
         }
         case FanControl::Attributes::PercentCurrent::Id: {
-            uint8_t min = 0, max = 100;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 100>(current_attribute);
             break;
         }
         case FanControl::Attributes::SpeedMax::Id: {
-            uint8_t min = 1, max = 100;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 1, 100>(current_attribute);
             break;
         }
         case FanControl::Attributes::SpeedSetting::Id: {
@@ -354,8 +336,7 @@ void add_bounds_cb(cluster_t *cluster)
             break;
         }
         case FanControl::Attributes::AirflowDirection::Id: {
-            uint8_t min = 0, max = 1;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 1>(current_attribute);
             break;
         }
         default:
@@ -379,8 +360,7 @@ void add_bounds_cb(cluster_t *cluster)
 
         case Thermostat::Attributes::PICoolingDemand::Id:
         case Thermostat::Attributes::PIHeatingDemand::Id: {
-            uint8_t min = 0, max = 100;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 100>(current_attribute);
             break;
         }
         case Thermostat::Attributes::OccupiedCoolingSetpoint::Id:
@@ -476,45 +456,37 @@ void add_bounds_cb(cluster_t *cluster)
             break;
         }
         case Thermostat::Attributes::MinSetpointDeadBand::Id: {
-            int8_t min = 0, max = 127;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<int8_t, 0, 127>(current_attribute);
             break;
         }
         case Thermostat::Attributes::ControlSequenceOfOperation::Id: {
-            uint8_t min = 0, max = 5;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 5>(current_attribute);
             break;
         }
         case Thermostat::Attributes::SystemMode::Id: {
-            uint8_t min = 0, max = 9;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 9>(current_attribute);
             break;
         }
         case Thermostat::Attributes::ThermostatRunningMode::Id:
         case Thermostat::Attributes::ACType::Id: {
             // TODO: The valid values for ThermostatRunningMode are: 0, 3, 4. But there is no way to set the bounds for it.
-            uint8_t min = 0, max = 4;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 4>(current_attribute);
             break;
         }
         case Thermostat::Attributes::StartOfWeek::Id: {
-            uint8_t min = 0, max = 6;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 6>(current_attribute);
             break;
         }
         case Thermostat::Attributes::TemperatureSetpointHold::Id: {
-            uint8_t min = 0, max = 1;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 1>(current_attribute);
             break;
         }
         case Thermostat::Attributes::TemperatureSetpointHoldDuration::Id: {
-            nullable<uint16_t> min = 0, max = 1440;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint16_t, 0, 1440>(current_attribute);
             break;
         }
         case Thermostat::Attributes::SetpointChangeSource::Id: {
-            uint8_t min = 0, max = 2;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 2>(current_attribute);
             break;
         }
         case Thermostat::Attributes::OccupiedSetback::Id: {
@@ -589,13 +561,11 @@ void add_bounds_cb(cluster_t *cluster)
         }
         case Thermostat::Attributes::ACRefrigerantType::Id:
         case Thermostat::Attributes::ACCompressorType::Id: {
-            uint8_t min = 0, max = 3;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 3>(current_attribute);
             break;
         }
         case Thermostat::Attributes::ACLouverPosition::Id: {
-            uint8_t min = 1, max = 5;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 1, 5>(current_attribute);
             break;
         }
         default:
@@ -618,18 +588,15 @@ void add_bounds_cb(cluster_t *cluster)
         switch (esp_matter::attribute::get_id(current_attribute)) {
 
         case ThermostatUserInterfaceConfiguration::Attributes::TemperatureDisplayMode::Id: {
-            uint8_t min = 0, max = 1;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 1>(current_attribute);
             break;
         }
         case ThermostatUserInterfaceConfiguration::Attributes::KeypadLockout::Id: {
-            uint8_t min = 0, max = 5;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 5>(current_attribute);
             break;
         }
         case ThermostatUserInterfaceConfiguration::Attributes::ScheduleProgrammingVisibility::Id: {
-            uint8_t min = 0, max = 1;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min, esp_matter_attr_val::uint_sub_type::k_enum), esp_matter_attr_val(max, esp_matter_attr_val::uint_sub_type::k_enum));
+            esp_matter::attribute::add_bounds<uint8_t, 0, 1>(current_attribute);
             break;
         }
         default:
@@ -651,28 +618,23 @@ void add_bounds_cb(cluster_t *cluster)
     while (current_attribute) {
         switch (esp_matter::attribute::get_id(current_attribute)) {
         case CameraAvSettingsUserLevelManagement::Attributes::ZoomMax::Id: {
-            uint8_t min = 2, max = 100;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<uint8_t, 2, 100>(current_attribute);
             break;
         }
         case CameraAvSettingsUserLevelManagement::Attributes::TiltMin::Id: {
-            int16_t min = -180, max = 179;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<int16_t, -180, 179>(current_attribute);
             break;
         }
         case CameraAvSettingsUserLevelManagement::Attributes::TiltMax::Id: {
-            int16_t min = -179, max = 180;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<int16_t, -179, 180>(current_attribute);
             break;
         }
         case CameraAvSettingsUserLevelManagement::Attributes::PanMin::Id: {
-            int16_t min = -180, max = 179;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<int16_t, -180, 179>(current_attribute);
             break;
         }
         case CameraAvSettingsUserLevelManagement::Attributes::PanMax::Id: {
-            int16_t min = -179, max = 180;
-            esp_matter::attribute::add_bounds(current_attribute, esp_matter_attr_val(min), esp_matter_attr_val(max));
+            esp_matter::attribute::add_bounds<int16_t, -179, 180>(current_attribute);
             break;
         }
         default:
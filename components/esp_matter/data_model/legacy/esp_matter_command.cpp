@@ -16,6 +16,7 @@
 #include <esp_matter.h>
 #include <esp_matter_command_impl.h>
 #include <esp_matter_core.h>
+#include <esp_matter_trace.h>
 
 #include <app-common/zap-generated/callback.h>
 #include <app/InteractionModelEngine.h>
@@ -36,7 +37,11 @@ void dispatch_single_cluster_command(const ConcreteCommandPath &command_path, TL
     uint16_t endpoint_id = command_path.mEndpointId;
     uint32_t cluster_id = command_path.mClusterId;
     uint32_t command_id = command_path.mCommandId;
-    ESP_LOGI(TAG, "Received command 0x%08" PRIX32 " for endpoint 0x%04" PRIX16 "'s cluster 0x%08" PRIX32 "", command_id, endpoint_id, cluster_id);
+    /* With CONFIG_ESP_MATTER_TRACE the commands are recorded in the binary trace instead of being printed */
+    int64_t trace_start = trace::begin();
+    if (!trace::is_enabled()) {
+        ESP_LOGI(TAG, "Received command 0x%08" PRIX32 " for endpoint 0x%04" PRIX16 "'s cluster 0x%08" PRIX32 "", command_id, endpoint_id, cluster_id);
+    }
 
     cluster_t *cluster = cluster::get(endpoint_id, cluster_id);
     VerifyOrReturn(cluster);
@@ -54,6 +59,7 @@ void dispatch_single_cluster_command(const ConcreteCommandPath &command_path, TL
         if ((err == ESP_OK) && callback) {
             err = callback(command_path, tlv_data, opaque_ptr);
         }
+        trace::record(trace::EVENT_COMMAND, endpoint_id, cluster_id, command_id, 0, 0, err, trace_start);
         int flags = get_flags(command);
         if (flags & COMMAND_FLAG_CUSTOM) {
             chip::app::CommandHandler *command_obj = (chip::app::CommandHandler *)opaque_ptr;
@@ -977,74 +983,74 @@ namespace actions {
 namespace command {
 command_t *create_instant_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::InstantAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_instance_action);
+    return esp_matter::command::create<Actions::Commands::InstantAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_instance_action>(cluster);
 }
 
 command_t *create_instant_action_with_transition(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::InstantActionWithTransition::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_instance_action_with_transition);
+    return esp_matter::command::create<Actions::Commands::InstantActionWithTransition::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_instance_action_with_transition>(cluster);
 }
 
 command_t *create_start_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::StartAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_start_action);
+    return esp_matter::command::create<Actions::Commands::StartAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_start_action>(cluster);
 }
 
 command_t *create_start_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::StartActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_start_action_with_duration);
+    return esp_matter::command::create<Actions::Commands::StartActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_start_action_with_duration>(cluster);
 }
 
 command_t *create_stop_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::StopAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_stop_action);
+    return esp_matter::command::create<Actions::Commands::StopAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_stop_action>(cluster);
 }
 
 command_t *create_pause_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::PauseAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_pause_action);
+    return esp_matter::command::create<Actions::Commands::PauseAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_pause_action>(cluster);
 }
 
 command_t *create_pause_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::PauseActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_pause_action_with_duration);
+    return esp_matter::command::create<Actions::Commands::PauseActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_pause_action_with_duration>(cluster);
 }
 
 command_t *create_resume_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::ResumeAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_resume_action);
+    return esp_matter::command::create<Actions::Commands::ResumeAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_resume_action>(cluster);
 }
 
 command_t *create_enable_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::EnableAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_enable_action);
+    return esp_matter::command::create<Actions::Commands::EnableAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enable_action>(cluster);
 }
 
 command_t *create_enable_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::EnableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_enable_action_with_duration);
+    return esp_matter::command::create<Actions::Commands::EnableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enable_action_with_duration>(cluster);
 }
 
 command_t *create_disable_action(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::DisableAction::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_disable_action);
+    return esp_matter::command::create<Actions::Commands::DisableAction::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_disable_action>(cluster);
 }
 
 command_t *create_disable_action_with_duration(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Actions::Commands::DisableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_disable_action_with_duration);
+    return esp_matter::command::create<Actions::Commands::DisableActionWithDuration::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_disable_action_with_duration>(cluster);
 }
 
 } /* command */
@@ -1065,7 +1071,8 @@ command_t *create_review_fabric_restrictions(cluster_t *cluster)
 
 command_t *create_review_fabric_restrictions_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AccessControl::Commands::ReviewFabricRestrictionsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<AccessControl::Commands::ReviewFabricRestrictionsResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1088,7 +1095,8 @@ namespace command {
 
 command_t *create_reset_counts(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadNetworkDiagnostics::Commands::ResetCounts::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadNetworkDiagnostics::Commands::ResetCounts::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1099,7 +1107,8 @@ namespace command {
 
 command_t *create_reset_counts(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WiFiNetworkDiagnostics::Commands::ResetCounts::Id, COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<WiFiNetworkDiagnostics::Commands::ResetCounts::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1110,8 +1119,8 @@ namespace command {
 
 command_t *create_reset_counts(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EthernetNetworkDiagnostics::Commands::ResetCounts::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<EthernetNetworkDiagnostics::Commands::ResetCounts::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1122,14 +1131,14 @@ namespace command {
 
 command_t *create_retrieve_logs_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DiagnosticLogs::Commands::RetrieveLogsRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<DiagnosticLogs::Commands::RetrieveLogsRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_retrieve_logs_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DiagnosticLogs::Commands::RetrieveLogsResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<DiagnosticLogs::Commands::RetrieveLogsResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1140,26 +1149,29 @@ namespace command {
 
 command_t *create_test_event_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralDiagnostics::Commands::TestEventTrigger::Id, COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<GeneralDiagnostics::Commands::TestEventTrigger::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_time_snap_shot(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralDiagnostics::Commands::TimeSnapshot::Id, COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<GeneralDiagnostics::Commands::TimeSnapshot::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_time_snap_shot_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralDiagnostics::Commands::TimeSnapshotResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<GeneralDiagnostics::Commands::TimeSnapshotResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 command_t *create_payload_test_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralDiagnostics::Commands::PayloadTestRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GeneralDiagnostics::Commands::PayloadTestRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 command_t *create_payload_test_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralDiagnostics::Commands::PayloadTestResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GeneralDiagnostics::Commands::PayloadTestResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1170,8 +1182,8 @@ namespace command {
 
 command_t *create_reset_watermarks(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SoftwareDiagnostics::Commands::ResetWatermarks::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<SoftwareDiagnostics::Commands::ResetWatermarks::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1181,37 +1193,32 @@ namespace groupcast {
 namespace command {
 command_t *create_join_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::JoinGroup::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<Groupcast::Commands::JoinGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_leave_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::LeaveGroup::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<Groupcast::Commands::LeaveGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_leave_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::LeaveGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<Groupcast::Commands::LeaveGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_update_group_key(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::UpdateGroupKey::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<Groupcast::Commands::UpdateGroupKey::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_configure_auxiliary_acl(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::ConfigureAuxiliaryACL::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<Groupcast::Commands::ConfigureAuxiliaryACL::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_groupcast_testing(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groupcast::Commands::GroupcastTesting::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<Groupcast::Commands::GroupcastTesting::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 } /* command */
 } /* groupcast */
@@ -1220,38 +1227,35 @@ namespace command {
 
 command_t *create_key_set_write(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetWrite::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetWrite::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetRead::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetRead::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_remove(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetRemove::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetRemove::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read_all_indices(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetReadAllIndices::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetReadAllIndices::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_key_set_read_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetReadResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetReadResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_key_set_read_all_indices_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GroupKeyManagement::Commands::KeySetReadAllIndicesResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GroupKeyManagement::Commands::KeySetReadAllIndicesResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1262,50 +1266,49 @@ namespace command {
 
 command_t *create_arm_fail_safe(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::ArmFailSafe::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<GeneralCommissioning::Commands::ArmFailSafe::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_regulatory_config(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::SetRegulatoryConfig::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<GeneralCommissioning::Commands::SetRegulatoryConfig::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_commissioning_complete(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::CommissioningComplete::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<GeneralCommissioning::Commands::CommissioningComplete::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_arm_fail_safe_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::ArmFailSafeResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GeneralCommissioning::Commands::ArmFailSafeResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_regulatory_config_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::SetRegulatoryConfigResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GeneralCommissioning::Commands::SetRegulatoryConfigResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_commissioning_complete_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::CommissioningCompleteResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GeneralCommissioning::Commands::CommissioningCompleteResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_tc_acknowledgements(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::SetTCAcknowledgements::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<GeneralCommissioning::Commands::SetTCAcknowledgements::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_tc_acknowledgements_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, GeneralCommissioning::Commands::SetTCAcknowledgementsResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<GeneralCommissioning::Commands::SetTCAcknowledgementsResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1317,56 +1320,56 @@ namespace command {
 
 command_t *create_scan_networks(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::ScanNetworks::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::ScanNetworks::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_or_update_wifi_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::AddOrUpdateWiFiNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::AddOrUpdateWiFiNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_or_update_thread_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::AddOrUpdateThreadNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::AddOrUpdateThreadNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::RemoveNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::RemoveNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_connect_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::ConnectNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::ConnectNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_reorder_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::ReorderNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::ReorderNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_scan_networks_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::ScanNetworksResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::ScanNetworksResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_network_config_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::NetworkConfigResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::NetworkConfigResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_connect_network_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, NetworkCommissioning::Commands::ConnectNetworkResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<NetworkCommissioning::Commands::ConnectNetworkResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1378,20 +1381,20 @@ namespace command {
 
 command_t *create_open_commissioning_window(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AdministratorCommissioning::Commands::OpenCommissioningWindow::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<AdministratorCommissioning::Commands::OpenCommissioningWindow::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_open_basic_commissioning_window(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AdministratorCommissioning::Commands::OpenBasicCommissioningWindow::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<AdministratorCommissioning::Commands::OpenBasicCommissioningWindow::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_revoke_commissioning(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, AdministratorCommissioning::Commands::RevokeCommissioning::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<AdministratorCommissioning::Commands::RevokeCommissioning::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1402,92 +1405,90 @@ namespace command {
 
 command_t *create_attestation_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::AttestationRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::AttestationRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_certificate_chain_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::CertificateChainRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::CertificateChainRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_csr_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::CSRRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::CSRRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_noc(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::AddNOC::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::AddNOC::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_update_noc(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::UpdateNOC::Id, COMMAND_FLAG_ACCEPTED,
-                                       NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::UpdateNOC::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_update_fabric_label(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::UpdateFabricLabel::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::UpdateFabricLabel::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_fabric(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::RemoveFabric::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::RemoveFabric::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_trusted_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::AddTrustedRootCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::AddTrustedRootCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_attestation_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::AttestationResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::AttestationResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_certificate_chain_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::CertificateChainResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::CertificateChainResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_csr_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::CSRResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::CSRResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_noc_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::NOCResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::NOCResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_vid_verification_statement(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::SetVIDVerificationStatement::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::SetVIDVerificationStatement::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_sign_vid_verification_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::SignVIDVerificationRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::SignVIDVerificationRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_sign_vid_verification_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalCredentials::Commands::SignVIDVerificationResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalCredentials::Commands::SignVIDVerificationResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1498,32 +1499,32 @@ namespace command {
 
 command_t *create_query_image(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateProvider::Commands::QueryImage::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<OtaSoftwareUpdateProvider::Commands::QueryImage::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_apply_update_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateProvider::Commands::ApplyUpdateRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<OtaSoftwareUpdateProvider::Commands::ApplyUpdateRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_notify_update_applied(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateProvider::Commands::NotifyUpdateApplied::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<OtaSoftwareUpdateProvider::Commands::NotifyUpdateApplied::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_query_image_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateProvider::Commands::QueryImageResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OtaSoftwareUpdateProvider::Commands::QueryImageResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_apply_update_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateProvider::Commands::ApplyUpdateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OtaSoftwareUpdateProvider::Commands::ApplyUpdateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1534,8 +1535,8 @@ namespace command {
 
 command_t *create_announce_ota_provider(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OtaSoftwareUpdateRequestor::Commands::AnnounceOTAProvider::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_announce_ota_provider);
+    return esp_matter::command::create<OtaSoftwareUpdateRequestor::Commands::AnnounceOTAProvider::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_announce_ota_provider>(cluster);
 }
 
 } /* command */
@@ -1546,14 +1547,12 @@ namespace command {
 
 command_t *create_identify(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Identify::Commands::Identify::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<Identify::Commands::Identify::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_trigger_effect(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Identify::Commands::TriggerEffect::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<Identify::Commands::TriggerEffect::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -1564,54 +1563,53 @@ namespace command {
 
 command_t *create_add_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::AddGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::AddGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_view_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::ViewGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::ViewGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_group_membership(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::GetGroupMembership::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::GetGroupMembership::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_group(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::RemoveGroup::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::RemoveGroup::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_all_groups(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::RemoveAllGroups::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::RemoveAllGroups::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_group_if_identifying(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::AddGroupIfIdentifying::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Groups::Commands::AddGroupIfIdentifying::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::AddGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<Groups::Commands::AddGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_view_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::ViewGroupResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<Groups::Commands::ViewGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_group_membership_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::GetGroupMembershipResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<Groups::Commands::GetGroupMembershipResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_group_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Groups::Commands::RemoveGroupResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<Groups::Commands::RemoveGroupResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1621,31 +1619,28 @@ namespace icd_management {
 namespace command {
 command_t *create_register_client(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, IcdManagement::Commands::RegisterClient::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<IcdManagement::Commands::RegisterClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_register_client_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, IcdManagement::Commands::RegisterClientResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<IcdManagement::Commands::RegisterClientResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_unregister_client(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, IcdManagement::Commands::UnregisterClient::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<IcdManagement::Commands::UnregisterClient::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stay_active_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, IcdManagement::Commands::StayActiveRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<IcdManagement::Commands::StayActiveRequest::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 command_t *create_stay_active_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, IcdManagement::Commands::StayActiveResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<IcdManagement::Commands::StayActiveResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1656,80 +1651,85 @@ namespace command {
 
 command_t *create_add_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::AddScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::AddScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_view_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::ViewScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::ViewScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::RemoveScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::RemoveScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_all_scenes(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::RemoveAllScenes::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::RemoveAllScenes::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_store_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::StoreScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::StoreScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_recall_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::RecallScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::RecallScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_scene_membership(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::GetSceneMembership::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::GetSceneMembership::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_copy_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::CopyScene::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::CopyScene::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::AddSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::AddSceneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_view_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::ViewSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::ViewSceneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::RemoveSceneResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::RemoveSceneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_all_scenes_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::RemoveAllScenesResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::RemoveAllScenesResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_store_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::StoreSceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::StoreSceneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_scene_membership_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::GetSceneMembershipResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::GetSceneMembershipResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_copy_scene_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ScenesManagement::Commands::CopySceneResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ScenesManagement::Commands::CopySceneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1740,38 +1740,38 @@ namespace command {
 
 command_t *create_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::Off::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_off);
+    return esp_matter::command::create<OnOff::Commands::Off::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_off>(cluster);
 }
 
 command_t *create_on(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::On::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_on);
+    return esp_matter::command::create<OnOff::Commands::On::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_on>(cluster);
 }
 
 command_t *create_toggle(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::Toggle::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_toggle);
+    return esp_matter::command::create<OnOff::Commands::Toggle::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_toggle>(cluster);
 }
 
 command_t *create_off_with_effect(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::OffWithEffect::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_off_with_effect);
+    return esp_matter::command::create<OnOff::Commands::OffWithEffect::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_off_with_effect>(cluster);
 }
 
 command_t *create_on_with_recall_global_scene(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::OnWithRecallGlobalScene::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_on_with_recall_global_scene);
+    return esp_matter::command::create<OnOff::Commands::OnWithRecallGlobalScene::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_on_with_recall_global_scene>(cluster);
 }
 
 command_t *create_on_with_timed_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OnOff::Commands::OnWithTimedOff::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_on_with_timed_off);
+    return esp_matter::command::create<OnOff::Commands::OnWithTimedOff::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_on_with_timed_off>(cluster);
 }
 
 } /* command */
@@ -1782,50 +1782,50 @@ namespace command {
 
 command_t *create_move_to_level(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::MoveToLevel::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_to_level);
+    return esp_matter::command::create<LevelControl::Commands::MoveToLevel::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_level>(cluster);
 }
 
 command_t *create_move(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::Move::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move);
+    return esp_matter::command::create<LevelControl::Commands::Move::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move>(cluster);
 }
 
 command_t *create_step(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::Step::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_step);
+    return esp_matter::command::create<LevelControl::Commands::Step::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step>(cluster);
 }
 
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::Stop::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_stop);
+    return esp_matter::command::create<LevelControl::Commands::Stop::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_stop>(cluster);
 }
 
 command_t *create_move_to_level_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::MoveToLevelWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_to_level_with_on_off);
+    return esp_matter::command::create<LevelControl::Commands::MoveToLevelWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_level_with_on_off>(cluster);
 }
 
 command_t *create_move_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::MoveWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_with_on_off);
+    return esp_matter::command::create<LevelControl::Commands::MoveWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_with_on_off>(cluster);
 }
 
 command_t *create_step_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::StepWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_step_with_on_off);
+    return esp_matter::command::create<LevelControl::Commands::StepWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step_with_on_off>(cluster);
 }
 
 command_t *create_stop_with_on_off(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, LevelControl::Commands::StopWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_stop_with_on_off);
+    return esp_matter::command::create<LevelControl::Commands::StopWithOnOff::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_stop_with_on_off>(cluster);
 }
 
 command_t *create_move_to_closest_frequency(cluster_t *cluster)
@@ -1843,116 +1843,116 @@ namespace command {
 
 command_t *create_move_to_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveToHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_to_hue);
+    return esp_matter::command::create<ColorControl::Commands::MoveToHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_hue>(cluster);
 }
 
 command_t *create_move_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_hue);
+    return esp_matter::command::create<ColorControl::Commands::MoveHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_hue>(cluster);
 }
 
 command_t *create_step_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::StepHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_step_hue);
+    return esp_matter::command::create<ColorControl::Commands::StepHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step_hue>(cluster);
 }
 
 command_t *create_move_to_saturation(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveToSaturation::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_to_saturation);
+    return esp_matter::command::create<ColorControl::Commands::MoveToSaturation::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_saturation>(cluster);
 }
 
 command_t *create_move_saturation(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveSaturation::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_saturation);
+    return esp_matter::command::create<ColorControl::Commands::MoveSaturation::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_saturation>(cluster);
 }
 
 command_t *create_step_saturation(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::StepSaturation::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_step_saturation);
+    return esp_matter::command::create<ColorControl::Commands::StepSaturation::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step_saturation>(cluster);
 }
 
 command_t *create_move_to_hue_and_saturation(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveToHueAndSaturation::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_hue_and_saturation);
+    return esp_matter::command::create<ColorControl::Commands::MoveToHueAndSaturation::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_hue_and_saturation>(cluster);
 }
 
 command_t *create_stop_move_step(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::StopMoveStep::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_stop_move_step);
+    return esp_matter::command::create<ColorControl::Commands::StopMoveStep::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_stop_move_step>(cluster);
 }
 
 command_t *create_move_to_color_temperature(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveToColorTemperature::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_to_color_temperature);
+    return esp_matter::command::create<ColorControl::Commands::MoveToColorTemperature::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_color_temperature>(cluster);
 }
 
 command_t *create_move_color_temperature(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveColorTemperature::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_move_color_temperature);
+    return esp_matter::command::create<ColorControl::Commands::MoveColorTemperature::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_color_temperature>(cluster);
 }
 
 command_t *create_step_color_temperature(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::StepColorTemperature::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_step_color_temperature);
+    return esp_matter::command::create<ColorControl::Commands::StepColorTemperature::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step_color_temperature>(cluster);
 }
 
 command_t *create_move_to_color(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveToColor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_to_color);
+    return esp_matter::command::create<ColorControl::Commands::MoveToColor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_to_color>(cluster);
 }
 
 command_t *create_move_color(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::MoveColor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_move_color);
+    return esp_matter::command::create<ColorControl::Commands::MoveColor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_move_color>(cluster);
 }
 
 command_t *create_step_color(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::StepColor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_step_color);
+    return esp_matter::command::create<ColorControl::Commands::StepColor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_step_color>(cluster);
 }
 
 command_t *create_enhanced_move_to_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::EnhancedMoveToHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_enhanced_move_to_hue);
+    return esp_matter::command::create<ColorControl::Commands::EnhancedMoveToHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enhanced_move_to_hue>(cluster);
 }
 
 command_t *create_enhanced_move_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::EnhancedMoveHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_enhanced_move_hue);
+    return esp_matter::command::create<ColorControl::Commands::EnhancedMoveHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enhanced_move_hue>(cluster);
 }
 
 command_t *create_enhanced_step_hue(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::EnhancedStepHue::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_enhanced_step_hue);
+    return esp_matter::command::create<ColorControl::Commands::EnhancedStepHue::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enhanced_step_hue>(cluster);
 }
 
 command_t *create_enhanced_move_to_hue_and_saturation(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::EnhancedMoveToHueAndSaturation::Id,
-                                       COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_enhanced_move_to_hue_and_saturation);
+    return esp_matter::command::create<ColorControl::Commands::EnhancedMoveToHueAndSaturation::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_enhanced_move_to_hue_and_saturation>(cluster);
 }
 
 command_t *create_color_loop_set(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ColorControl::Commands::ColorLoopSet::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_color_loop_set);
+    return esp_matter::command::create<ColorControl::Commands::ColorLoopSet::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_color_loop_set>(cluster);
 }
 
 } /* command */
@@ -1963,31 +1963,31 @@ namespace command {
 
 command_t *create_setpoint_raise_lower(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Thermostat::Commands::SetpointRaiseLower::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_setpoint_raise_lower);
+    return esp_matter::command::create<Thermostat::Commands::SetpointRaiseLower::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_setpoint_raise_lower>(cluster);
 }
 
 command_t *create_set_active_schedule_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Thermostat::Commands::SetActiveScheduleRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_active_schedule_request);
+    return esp_matter::command::create<Thermostat::Commands::SetActiveScheduleRequest::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_active_schedule_request>(cluster);
 }
 
 command_t *create_set_active_preset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Thermostat::Commands::SetActivePresetRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_active_preset_request);
+    return esp_matter::command::create<Thermostat::Commands::SetActivePresetRequest::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_active_preset_request>(cluster);
 }
 
 command_t *create_atomic_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Thermostat::Commands::AtomicRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_thermostat_atomic_request);
+    return esp_matter::command::create<Thermostat::Commands::AtomicRequest::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_thermostat_atomic_request>(cluster);
 }
 
 command_t *create_atomic_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Thermostat::Commands::AtomicResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<Thermostat::Commands::AtomicResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -1997,28 +1997,28 @@ namespace operational_state {
 namespace command {
 command_t *create_pause(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalState::Commands::Pause::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalState::Commands::Pause::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalState::Commands::Stop::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalState::Commands::Stop::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalState::Commands::Start::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalState::Commands::Start::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_resume(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalState::Commands::Resume::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<OperationalState::Commands::Resume::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_operational_command_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, OperationalState::Commands::OperationalCommandResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<OperationalState::Commands::OperationalCommandResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 } /* command */
 } /* operational_state */
@@ -2028,8 +2028,8 @@ namespace command {
 
 command_t *create_self_test_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, SmokeCoAlarm::Commands::SelfTestRequest::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_self_test_request);
+    return esp_matter::command::create<SmokeCoAlarm::Commands::SelfTestRequest::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_self_test_request>(cluster);
 }
 
 } /* command */
@@ -2040,164 +2040,162 @@ namespace command {
 
 command_t *create_lock_door(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::LockDoor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_lock_door);
+    return esp_matter::command::create<DoorLock::Commands::LockDoor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_lock_door>(cluster);
 }
 
 command_t *create_unlock_door(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::UnlockDoor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_unlock_door);
+    return esp_matter::command::create<DoorLock::Commands::UnlockDoor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_unlock_door>(cluster);
 }
 
 command_t *create_unlock_with_timeout(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::UnlockWithTimeout::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_unlock_with_timeout);
+    return esp_matter::command::create<DoorLock::Commands::UnlockWithTimeout::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_unlock_with_timeout>(cluster);
 }
 
 command_t *create_set_weekday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_weekday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::SetWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_weekday_schedule>(cluster);
 }
 
 command_t *create_get_weekday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_get_weekday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::GetWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_get_weekday_schedule>(cluster);
 }
 
 command_t *create_get_weekday_schedule_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetWeekDayScheduleResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::GetWeekDayScheduleResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_clear_weekday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_weekday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::ClearWeekDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_weekday_schedule>(cluster);
 }
 
 command_t *create_set_year_day_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_year_day_schedule);
+    return esp_matter::command::create<DoorLock::Commands::SetYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_year_day_schedule>(cluster);
 }
 
 command_t *create_get_year_day_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_get_year_day_schedule);
+    return esp_matter::command::create<DoorLock::Commands::GetYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_get_year_day_schedule>(cluster);
 }
 
 command_t *create_get_year_day_schedule_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetYearDayScheduleResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::GetYearDayScheduleResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_clear_year_day_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_year_day_schedule);
+    return esp_matter::command::create<DoorLock::Commands::ClearYearDaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_year_day_schedule>(cluster);
 }
 
 command_t *create_set_holiday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_holiday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::SetHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_holiday_schedule>(cluster);
 }
 
 command_t *create_get_holiday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_get_holiday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::GetHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_get_holiday_schedule>(cluster);
 }
 
 command_t *create_get_holiday_schedule_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetHolidayScheduleResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::GetHolidayScheduleResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_clear_holiday_schedule(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_holiday_schedule);
+    return esp_matter::command::create<DoorLock::Commands::ClearHolidaySchedule::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_holiday_schedule>(cluster);
 }
 
 command_t *create_set_user(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetUser::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_user);
+    return esp_matter::command::create<DoorLock::Commands::SetUser::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_user>(cluster);
 }
 
 command_t *create_get_user(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetUser::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_get_user);
+    return esp_matter::command::create<DoorLock::Commands::GetUser::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_get_user>(cluster);
 }
 
 command_t *create_get_user_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetUserResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::GetUserResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_clear_user(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearUser::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_user);
+    return esp_matter::command::create<DoorLock::Commands::ClearUser::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_user>(cluster);
 }
 
 command_t *create_set_credential(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetCredential::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_credential);
+    return esp_matter::command::create<DoorLock::Commands::SetCredential::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_credential>(cluster);
 }
 
 command_t *create_set_credential_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetCredentialResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::SetCredentialResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_credential_status(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetCredentialStatus::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_get_credential_status);
+    return esp_matter::command::create<DoorLock::Commands::GetCredentialStatus::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_get_credential_status>(cluster);
 }
 
 command_t *create_get_credential_status_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::GetCredentialStatusResponse::Id, COMMAND_FLAG_GENERATED,
-                                       NULL);
+    return esp_matter::command::create<DoorLock::Commands::GetCredentialStatusResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_clear_credential(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearCredential::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_credential);
+    return esp_matter::command::create<DoorLock::Commands::ClearCredential::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_credential>(cluster);
 }
 
 command_t *create_unbolt_door(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::UnboltDoor::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_unbolt_door);
+    return esp_matter::command::create<DoorLock::Commands::UnboltDoor::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_unbolt_door>(cluster);
 }
 
 command_t *create_set_aliro_reader_config(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::SetAliroReaderConfig::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_set_aliro_reader_config);
+    return esp_matter::command::create<DoorLock::Commands::SetAliroReaderConfig::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_set_aliro_reader_config>(cluster);
 }
 
 command_t *create_clear_aliro_reader_config(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DoorLock::Commands::ClearAliroReaderConfig::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_clear_aliro_reader_config);
+    return esp_matter::command::create<DoorLock::Commands::ClearAliroReaderConfig::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_clear_aliro_reader_config>(cluster);
 }
 
 } /* command */
@@ -2208,32 +2206,32 @@ namespace command {
 
 command_t *create_up_or_open(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WindowCovering::Commands::UpOrOpen::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_up_or_open);
+    return esp_matter::command::create<WindowCovering::Commands::UpOrOpen::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_up_or_open>(cluster);
 }
 
 command_t *create_down_or_close(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WindowCovering::Commands::DownOrClose::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_down_or_close);
+    return esp_matter::command::create<WindowCovering::Commands::DownOrClose::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_down_or_close>(cluster);
 }
 
 command_t *create_stop_motion(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WindowCovering::Commands::StopMotion::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_stop_motion);
+    return esp_matter::command::create<WindowCovering::Commands::StopMotion::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_stop_motion>(cluster);
 }
 
 command_t *create_go_to_lift_percentage(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WindowCovering::Commands::GoToLiftPercentage::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_go_to_lift_percentage);
+    return esp_matter::command::create<WindowCovering::Commands::GoToLiftPercentage::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_go_to_lift_percentage>(cluster);
 }
 
 command_t *create_go_to_tilt_percentage(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WindowCovering::Commands::GoToTiltPercentage::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_go_to_tilt_percentage);
+    return esp_matter::command::create<WindowCovering::Commands::GoToTiltPercentage::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_go_to_tilt_percentage>(cluster);
 }
 
 } /* command */
@@ -2244,7 +2242,8 @@ namespace command {
 
 command_t *create_change_to_mode(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ModeSelect::Commands::ChangeToMode::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_change_to_mode);
+    return esp_matter::command::create<ModeSelect::Commands::ChangeToMode::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_change_to_mode>(cluster);
 }
 
 } /* command */
@@ -2255,7 +2254,8 @@ namespace command {
 
 command_t *create_set_temperature(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TemperatureControl::Commands::SetTemperature::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TemperatureControl::Commands::SetTemperature::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2265,8 +2265,8 @@ namespace fan_control {
 namespace command {
 command_t *create_step(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, FanControl::Commands::Step::Id, COMMAND_FLAG_ACCEPTED,
-                                       esp_matter_command_callback_fan_step);
+    return esp_matter::command::create<FanControl::Commands::Step::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_fan_step>(cluster);
 }
 
 } /* command */
@@ -2276,7 +2276,8 @@ namespace resource_monitoring {
 namespace command {
 command_t *create_reset_condition(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, HepaFilterMonitoring::Commands::ResetCondition::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<HepaFilterMonitoring::Commands::ResetCondition::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2288,12 +2289,12 @@ namespace command {
 // command response is null because of InvokeCommandHandler is overridden in srs/app/clusters/mode-base
 command_t *create_change_to_mode(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ModeBase::Commands::ChangeToMode::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ModeBase::Commands::ChangeToMode::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_change_to_mode_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ModeBase::Commands::ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ModeBase::Commands::ChangeToModeResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2304,12 +2305,13 @@ namespace command {
 
 command_t *create_send_key(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeypadInput::Commands::SendKey::Id, COMMAND_FLAG_ACCEPTED, esp_matter_command_callback_send_key);
+    return esp_matter::command::create<KeypadInput::Commands::SendKey::Id, COMMAND_FLAG_ACCEPTED,
+                                       esp_matter_command_callback_send_key>(cluster);
 }
 
 command_t *create_send_key_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, KeypadInput::Commands::SendKeyResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<KeypadInput::Commands::SendKeyResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2319,12 +2321,14 @@ namespace boolean_state_configuration {
 namespace command {
 command_t *create_suppress_alarm(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, BooleanStateConfiguration::Commands::SuppressAlarm::Id, COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<BooleanStateConfiguration::Commands::SuppressAlarm::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_disable_alarm(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, BooleanStateConfiguration::Commands::EnableDisableAlarm::Id, COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<BooleanStateConfiguration::Commands::EnableDisableAlarm::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2335,42 +2339,42 @@ namespace command {
 
 command_t *create_disable(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::Disable::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::Disable::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_charging(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::EnableCharging::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::EnableCharging::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_enable_discharging(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::EnableDischarging::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::EnableDischarging::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_diagnostics(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::StartDiagnostics::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::StartDiagnostics::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_targets(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::SetTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::SetTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_targets(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::GetTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::GetTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_clear_targets(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::ClearTargets::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::ClearTargets::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_targets_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, EnergyEvse::Commands::GetTargetsResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<EnergyEvse::Commands::GetTargetsResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2381,12 +2385,13 @@ namespace command {
 
 command_t *create_set_cooking_parameters(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, MicrowaveOvenControl::Commands::SetCookingParameters::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MicrowaveOvenControl::Commands::SetCookingParameters::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_add_more_time(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, MicrowaveOvenControl::Commands::AddMoreTime::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<MicrowaveOvenControl::Commands::AddMoreTime::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2397,12 +2402,14 @@ namespace command {
 
 command_t *create_open(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ValveConfigurationAndControl::Commands::Open::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ValveConfigurationAndControl::Commands::Open::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_close(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ValveConfigurationAndControl::Commands::Close::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ValveConfigurationAndControl::Commands::Close::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2412,42 +2419,50 @@ namespace device_energy_management {
 namespace command {
 command_t *create_power_adjust_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::PowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::PowerAdjustRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_power_adjust_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::CancelPowerAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::CancelPowerAdjustRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_start_time_adjust_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::StartTimeAdjustRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::StartTimeAdjustRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_pause_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::PauseRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::PauseRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_resume_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::ResumeRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::ResumeRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_modify_forecast_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::ModifyForecastRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::ModifyForecastRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_request_constraint_based_forecast(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::RequestConstraintBasedForecast::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::RequestConstraintBasedForecast::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, DeviceEnergyManagement::Commands::CancelRequest::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<DeviceEnergyManagement::Commands::CancelRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2458,32 +2473,32 @@ namespace command {
 
 command_t *create_get_active_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadBorderRouterManagement::Commands::GetActiveDatasetRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadBorderRouterManagement::Commands::GetActiveDatasetRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_pending_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadBorderRouterManagement::Commands::GetPendingDatasetRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadBorderRouterManagement::Commands::GetPendingDatasetRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dataset_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadBorderRouterManagement::Commands::DatasetResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ThreadBorderRouterManagement::Commands::DatasetResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_active_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadBorderRouterManagement::Commands::SetActiveDatasetRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadBorderRouterManagement::Commands::SetActiveDatasetRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_pending_dataset_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadBorderRouterManagement::Commands::SetPendingDatasetRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadBorderRouterManagement::Commands::SetPendingDatasetRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2494,14 +2509,14 @@ namespace command {
 
 command_t *create_network_passphrase_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WiFiNetworkManagement::Commands::NetworkPassphraseRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WiFiNetworkManagement::Commands::NetworkPassphraseRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_network_passphrase_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WiFiNetworkManagement::Commands::NetworkPassphraseResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<WiFiNetworkManagement::Commands::NetworkPassphraseResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2512,26 +2527,26 @@ namespace command {
 
 command_t *create_add_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadNetworkDirectory::Commands::AddNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadNetworkDirectory::Commands::AddNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_network(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadNetworkDirectory::Commands::RemoveNetwork::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadNetworkDirectory::Commands::RemoveNetwork::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_operational_dataset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadNetworkDirectory::Commands::GetOperationalDataset::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ThreadNetworkDirectory::Commands::GetOperationalDataset::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_operational_dataset_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ThreadNetworkDirectory::Commands::OperationalDatasetResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ThreadNetworkDirectory::Commands::OperationalDatasetResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2542,22 +2557,22 @@ namespace command {
 
 command_t *create_select_areas(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ServiceArea::Commands::SelectAreas::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ServiceArea::Commands::SelectAreas::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_select_areas_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ServiceArea::Commands::SelectAreasResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ServiceArea::Commands::SelectAreasResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_skip_area(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ServiceArea::Commands::SkipAreaResponse::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ServiceArea::Commands::SkipAreaResponse::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_skip_area_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ServiceArea::Commands::SkipAreaResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ServiceArea::Commands::SkipAreaResponse::Id, COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2568,14 +2583,13 @@ namespace command {
 
 command_t *create_boost(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WaterHeaterManagement::Commands::Boost::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WaterHeaterManagement::Commands::Boost::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_cancel_boost(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WaterHeaterManagement::Commands::CancelBoost::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WaterHeaterManagement::Commands::CancelBoost::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2586,20 +2600,20 @@ namespace command {
 
 command_t *create_request_commissioning_approval(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissionerControl::Commands::RequestCommissioningApproval::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommissionerControl::Commands::RequestCommissioningApproval::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_commission_node(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissionerControl::Commands::CommissionNode::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommissionerControl::Commands::CommissionNode::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_reverse_open_commissioning_window(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommissionerControl::Commands::ReverseOpenCommissioningWindow::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommissionerControl::Commands::ReverseOpenCommissioningWindow::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2610,38 +2624,35 @@ namespace command {
 
 command_t *create_set_utc_time(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetUTCTime::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetUTCTime::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_trusted_time_source(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetTrustedTimeSource::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetTrustedTimeSource::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_time_zone(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetTimeZone::Id, COMMAND_FLAG_ACCEPTED,
-                                       nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetTimeZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_time_zone_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetTimeZoneResponse::Id,
-                                       COMMAND_FLAG_GENERATED, nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetTimeZoneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_set_dst_offset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetDSTOffset::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetDSTOffset::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_default_ntp(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TimeSynchronization::Commands::SetDefaultNTP::Id,
-                                       COMMAND_FLAG_ACCEPTED, nullptr);
+    return esp_matter::command::create<TimeSynchronization::Commands::SetDefaultNTP::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2652,73 +2663,87 @@ namespace command {
 
 command_t *create_audio_stream_allocate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::AudioStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::AudioStreamAllocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_audio_stream_allocate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::AudioStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::AudioStreamAllocateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_audio_stream_deallocate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::AudioStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::AudioStreamDeallocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_allocate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::VideoStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::VideoStreamAllocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_allocate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::VideoStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::VideoStreamAllocateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_video_stream_modify(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::VideoStreamModify::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::VideoStreamModify::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_video_stream_deallocate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::VideoStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::VideoStreamDeallocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_allocate(cluster_t *cluster)
 
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::SnapshotStreamAllocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::SnapshotStreamAllocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_allocate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::SnapshotStreamAllocateResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::SnapshotStreamAllocateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_snapshot_stream_modify(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::SnapshotStreamModify::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::SnapshotStreamModify::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_snapshot_stream_deallocate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::SnapshotStreamDeallocate::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::SnapshotStreamDeallocate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_stream_priorities(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::SetStreamPriorities::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::SetStreamPriorities::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_capture_snapshot(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::CaptureSnapshot::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::CaptureSnapshot::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_capture_snapshot_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvStreamManagement::Commands::CaptureSnapshotResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CameraAvStreamManagement::Commands::CaptureSnapshotResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2729,37 +2754,44 @@ namespace command {
 
 command_t *create_solicit_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::SolicitOffer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::SolicitOffer::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_solicit_offer_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::SolicitOfferResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::SolicitOfferResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provide_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::ProvideOffer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::ProvideOffer::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provide_offer_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::ProvideOfferResponse::Id, COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::ProvideOfferResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provide_answer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::ProvideAnswer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::ProvideAnswer::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provide_ice_candidates(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::ProvideICECandidates::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::ProvideICECandidates::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_end_session(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportProvider::Commands::EndSession::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportProvider::Commands::EndSession::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2770,22 +2802,23 @@ namespace command {
 
 command_t *create_offer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportRequestor::Commands::Offer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportRequestor::Commands::Offer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_answer(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportRequestor::Commands::Answer::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportRequestor::Commands::Answer::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_ice_candidates(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportRequestor::Commands::ICECandidates::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportRequestor::Commands::ICECandidates::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_end(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, WebRTCTransportRequestor::Commands::End::Id, COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<WebRTCTransportRequestor::Commands::End::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2795,8 +2828,7 @@ namespace chime {
 namespace command {
 command_t *create_play_chime_sound(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, Chime::Commands::PlayChimeSound::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<Chime::Commands::PlayChimeSound::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2806,20 +2838,17 @@ namespace closure_control {
 namespace command {
 command_t *create_stop(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClosureControl::Commands::Stop::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClosureControl::Commands::Stop::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_move_to(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClosureControl::Commands::MoveTo::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClosureControl::Commands::MoveTo::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_calibrate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClosureControl::Commands::Calibrate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClosureControl::Commands::Calibrate::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2829,14 +2858,12 @@ namespace closure_dimension {
 namespace command {
 command_t *create_set_target(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClosureDimension::Commands::SetTarget::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClosureDimension::Commands::SetTarget::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_step(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ClosureDimension::Commands::Step::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ClosureDimension::Commands::Step::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2846,44 +2873,44 @@ namespace camera_av_settings_user_level_management {
 namespace command {
 command_t *create_mptz_set_position(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::MPTZSetPosition::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::MPTZSetPosition::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_relative_move(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::MPTZRelativeMove::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::MPTZRelativeMove::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_move_to_preset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::MPTZMoveToPreset::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::MPTZMoveToPreset::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_save_preset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::MPTZSavePreset::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::MPTZSavePreset::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_mptz_remove_preset(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::MPTZRemovePreset::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::MPTZRemovePreset::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dptz_set_viewport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::DPTZSetViewport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::DPTZSetViewport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_dptz_relative_move(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CameraAvSettingsUserLevelManagement::Commands::DPTZRelativeMove::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CameraAvSettingsUserLevelManagement::Commands::DPTZRelativeMove::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -2893,50 +2920,50 @@ namespace push_av_stream_transport {
 namespace command {
 command_t *create_allocate_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::AllocatePushTransport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::AllocatePushTransport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_allocate_push_transport_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::AllocatePushTransportResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::AllocatePushTransportResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_deallocate_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::DeallocatePushTransport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::DeallocatePushTransport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_modify_push_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::ModifyPushTransport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::ModifyPushTransport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_set_transport_status(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::SetTransportStatus::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::SetTransportStatus::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_manually_trigger_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::ManuallyTriggerTransport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::ManuallyTriggerTransport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_transport(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::FindTransport::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::FindTransport::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_transport_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, PushAvStreamTransport::Commands::FindTransportResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<PushAvStreamTransport::Commands::FindTransportResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2946,26 +2973,25 @@ namespace commodity_tariff {
 namespace command {
 command_t *create_get_tariff_component(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityTariff::Commands::GetTariffComponent::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommodityTariff::Commands::GetTariffComponent::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_tariff_component_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityTariff::Commands::GetTariffComponentResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommodityTariff::Commands::GetTariffComponentResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_day_entry(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityTariff::Commands::GetDayEntry::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommodityTariff::Commands::GetDayEntry::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_day_entry_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityTariff::Commands::GetDayEntryResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommodityTariff::Commands::GetDayEntryResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -2975,26 +3001,26 @@ namespace commodity_price {
 namespace command {
 command_t *create_get_detailed_price_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityPrice::Commands::GetDetailedPriceRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommodityPrice::Commands::GetDetailedPriceRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_detailed_price_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityPrice::Commands::GetDetailedPriceResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommodityPrice::Commands::GetDetailedPriceResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_get_detailed_forecast_request(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityPrice::Commands::GetDetailedForecastRequest::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<CommodityPrice::Commands::GetDetailedForecastRequest::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_get_detailed_forecast_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, CommodityPrice::Commands::GetDetailedForecastResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<CommodityPrice::Commands::GetDetailedForecastResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 } /* command */
@@ -3004,38 +3030,36 @@ namespace zone_management {
 namespace command {
 command_t *create_two_d_cartesian_zone(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::CreateTwoDCartesianZone::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::CreateTwoDCartesianZone::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_two_d_cartesian_zone_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::CreateTwoDCartesianZoneResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::CreateTwoDCartesianZoneResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_update_two_d_cartesian_zone(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::UpdateTwoDCartesianZone::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::UpdateTwoDCartesianZone::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_zone(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::RemoveZone::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::RemoveZone::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_or_update_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::CreateOrUpdateTrigger::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::CreateOrUpdateTrigger::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_remove_trigger(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, ZoneManagement::Commands::RemoveTrigger::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<ZoneManagement::Commands::RemoveTrigger::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -3045,32 +3069,31 @@ namespace tls_client_management {
 namespace command {
 command_t *create_provision_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsClientManagement::Commands::ProvisionEndpoint::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsClientManagement::Commands::ProvisionEndpoint::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provision_endpoint_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsClientManagement::Commands::ProvisionEndpointResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsClientManagement::Commands::ProvisionEndpointResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_find_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsClientManagement::Commands::FindEndpoint::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsClientManagement::Commands::FindEndpoint::Id, COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_endpoint_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsClientManagement::Commands::FindEndpointResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsClientManagement::Commands::FindEndpointResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_endpoint(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsClientManagement::Commands::RemoveEndpoint::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsClientManagement::Commands::RemoveEndpoint::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -3080,92 +3103,92 @@ namespace tls_certificate_management {
 namespace command {
 command_t *create_provision_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::ProvisionRootCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::ProvisionRootCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_provision_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::ProvisionRootCertificateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::ProvisionRootCertificateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_find_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::FindRootCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::FindRootCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::FindRootCertificateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::FindRootCertificateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_lookup_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::LookupRootCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::LookupRootCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_lookup_root_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::LookupRootCertificateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::LookupRootCertificateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_root_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::RemoveRootCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::RemoveRootCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_client_csr(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::ClientCSR::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::ClientCSR::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_client_csr_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::ClientCSRResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::ClientCSRResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_provision_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::ProvisionClientCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::ProvisionClientCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::FindClientCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::FindClientCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_find_client_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::FindClientCertificateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::FindClientCertificateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_lookup_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::LookupClientCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::LookupClientCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 command_t *create_lookup_client_certificate_response(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::LookupClientCertificateResponse::Id,
-                                       COMMAND_FLAG_GENERATED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::LookupClientCertificateResponse::Id,
+                                       COMMAND_FLAG_GENERATED>(cluster);
 }
 
 command_t *create_remove_client_certificate(cluster_t *cluster)
 {
-    return esp_matter::command::create(cluster, TlsCertificateManagement::Commands::RemoveClientCertificate::Id,
-                                       COMMAND_FLAG_ACCEPTED, NULL);
+    return esp_matter::command::create<TlsCertificateManagement::Commands::RemoveClientCertificate::Id,
+                                       COMMAND_FLAG_ACCEPTED>(cluster);
 }
 
 } /* command */
@@ -15,9 +15,11 @@
 #include "esp_matter_cluster_impl.h"
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_matter_boot_profile.h>
 #include <esp_matter_endpoint_impl.h>
 #include <esp_matter_icd_configuration.h>
 #include <esp_matter_macros.h>
+#include <esp_matter_nvs.h>
 
 static const char *TAG = "esp_matter_endpoint";
 
@@ -2484,10 +2486,15 @@ namespace node {
 node_t *create(config_t *config, attribute::callback_t attribute_callback,
                identification::callback_t identification_callback, void* priv_data)
 {
+    boot_profile::begin(boot_profile::PHASE_NODE_BUILD);
     node_t *node = create_raw();
     /* Initialize esp-matter nvs partition */
     VerifyOrReturnValue(esp_matter_nvs_init() == ESP_OK, NULL, ESP_LOGE(TAG, "Failed to init esp-matter nvs partition"));
     VerifyOrReturnValue(node != nullptr, NULL, ESP_LOGE(TAG, "Could not create node"));
+    /* The attributes of the node are restored with one NVS handle until esp_matter::start() */
+    if (attribute::begin_nvs_restore() != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to open the attributes in NVS, they are restored one by one");
+    }
     endpoint_t *endpoint = endpoint::root_node::create(node, &(config->root_node), ENDPOINT_FLAG_NONE, priv_data);
     if (endpoint == nullptr) {
         destroy_raw();
@@ -0,0 +1,159 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_err.h>
+#include <esp_log.h>
+#include <esp_matter_arena.h>
+#include <esp_matter_data_model_arena.h>
+#include <esp_matter_mem.h>
+#include <inttypes.h>
+#include <string.h>
+
+#include <lib/support/CodeUtils.h>
+
+namespace esp_matter {
+namespace arena {
+
+static const char *TAG = "mtr_arena";
+
+namespace {
+stats_t s_stats;
+
+#if CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+constexpr size_t k_alignment = 8;
+// The nodes up to this size are carved from the slabs, the larger ones (if any) come from the heap.
+constexpr size_t k_max_node_size = 256;
+constexpr size_t k_size_class_count = k_max_node_size / k_alignment;
+constexpr size_t k_slab_size = CONFIG_ESP_MATTER_DATA_MODEL_ARENA_SLAB_SIZE;
+
+struct slab_t {
+    slab_t *next;
+};
+
+struct free_node_t {
+    free_node_t *next;
+};
+
+constexpr size_t k_slab_header_size = (sizeof(slab_t) + k_alignment - 1) & ~(k_alignment - 1);
+static_assert(k_slab_size >= k_slab_header_size + k_max_node_size, "The slab must fit the largest node");
+
+slab_t *s_slabs = nullptr;
+uint8_t *s_cursor = nullptr;
+size_t s_remaining = 0;
+// One free list per size class, the nodes of a destroyed endpoint are reused by the next one.
+free_node_t *s_free_lists[k_size_class_count];
+#endif // CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+} // namespace
+
+#if CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+static size_t get_block_size(size_t size)
+{
+    return (size + k_alignment - 1) & ~(k_alignment - 1);
+}
+
+static void push_free_block(void *ptr, size_t block_size)
+{
+    free_node_t *node = (free_node_t *)ptr;
+    node->next = s_free_lists[block_size / k_alignment - 1];
+    s_free_lists[block_size / k_alignment - 1] = node;
+    s_stats.free_list_bytes += block_size;
+}
+
+static bool add_slab()
+{
+    slab_t *slab = (slab_t *)esp_matter_mem_calloc(1, k_slab_size);
+    VerifyOrReturnValue(slab, false, ESP_LOGE(TAG, "Couldn't allocate a slab of %u bytes", (unsigned)k_slab_size));
+    // Keep the tail of the current slab for the nodes that still fit in it
+    if (s_remaining >= k_alignment) {
+        push_free_block(s_cursor, s_remaining);
+        s_stats.unused_bytes -= s_remaining;
+    }
+    slab->next = s_slabs;
+    s_slabs = slab;
+    s_cursor = (uint8_t *)slab + k_slab_header_size;
+    s_remaining = k_slab_size - k_slab_header_size;
+    s_stats.slab_count++;
+    s_stats.slab_bytes += k_slab_size;
+    s_stats.unused_bytes += s_remaining;
+    return true;
+}
+#endif // CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+
+void *alloc(size_t size)
+{
+    VerifyOrReturnValue(size > 0, nullptr);
+    void *ptr = nullptr;
+#if CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+    size_t block_size = get_block_size(size);
+    if (block_size > k_max_node_size) {
+        ptr = esp_matter_mem_calloc(1, size);
+        VerifyOrReturnValue(ptr, nullptr);
+        s_stats.heap_node_count++;
+    } else if (free_node_t *node = s_free_lists[block_size / k_alignment - 1]) {
+        s_free_lists[block_size / k_alignment - 1] = node->next;
+        s_stats.free_list_bytes -= block_size;
+        memset(node, 0, block_size);
+        ptr = node;
+    } else {
+        if (s_remaining < block_size) {
+            VerifyOrReturnValue(add_slab(), nullptr);
+        }
+        // The slabs are zeroed when allocated
+        ptr = s_cursor;
+        s_cursor += block_size;
+        s_remaining -= block_size;
+        s_stats.unused_bytes -= block_size;
+    }
+#else
+    ptr = esp_matter_mem_calloc(1, size);
+    VerifyOrReturnValue(ptr, nullptr);
+#endif // CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+    s_stats.node_count++;
+    s_stats.node_bytes += size;
+    return ptr;
+}
+
+void free(void *ptr, size_t size)
+{
+    VerifyOrReturn(ptr);
+    s_stats.node_count--;
+    s_stats.node_bytes -= size;
+#if CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+    size_t block_size = get_block_size(size);
+    if (block_size <= k_max_node_size) {
+        push_free_block(ptr, block_size);
+        return;
+    }
+    s_stats.heap_node_count--;
+#endif // CONFIG_ESP_MATTER_DATA_MODEL_ARENA
+    esp_matter_mem_free(ptr);
+}
+
+esp_err_t get_stats(stats_t *stats)
+{
+    VerifyOrReturnError(stats, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "stats cannot be NULL"));
+    *stats = s_stats;
+    return ESP_OK;
+}
+
+void print_stats()
+{
+    ESP_LOGI(TAG, "Nodes: %" PRIu32 " (%" PRIu32 " bytes), slabs: %" PRIu32 " (%" PRIu32 " bytes, %" PRIu32
+             " unused), free lists: %" PRIu32 " bytes, heap nodes: %" PRIu32, s_stats.node_count, s_stats.node_bytes,
+             s_stats.slab_count, s_stats.slab_bytes, s_stats.unused_bytes, s_stats.free_list_bytes,
+             s_stats.heap_node_count);
+}
+
+} // namespace arena
+} // namespace esp_matter
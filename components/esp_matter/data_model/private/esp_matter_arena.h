@@ -0,0 +1,43 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+namespace esp_matter {
+namespace arena {
+
+/**
+ * @brief Allocates a zero-initialized data model node (endpoint, cluster, attribute, command or event).
+ *
+ * With CONFIG_ESP_MATTER_DATA_MODEL_ARENA the node is carved from a slab, or reused from the free list of its size,
+ * otherwise it is allocated with esp_matter_mem_calloc(). The statistics are updated in both cases.
+ *
+ * @param size Size of the node
+ *
+ * @return Pointer to the node, or NULL if there is not enough memory
+ */
+void *alloc(size_t size);
+
+/**
+ * @brief Releases a node allocated with alloc().
+ *
+ * @param ptr  Pointer to the node, can be NULL
+ * @param size Size that was passed to alloc()
+ */
+void free(void *ptr, size_t size);
+
+} // namespace arena
+} // namespace esp_matter
@@ -0,0 +1,74 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <esp_matter_data_model.h>
+
+#include <app/data-model-provider/MetadataTypes.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/support/Span.h>
+
+namespace esp_matter {
+namespace cluster {
+
+/**
+ * @brief Metadata of a cluster as reported by the data model provider.
+ *
+ * The snapshot is one allocation: this header followed by the entries the spans point to. It is built by the provider
+ * on the first query of the cluster and dropped by the data model whenever an attribute or a command of the cluster
+ * is created or destroyed.
+ *
+ * The snapshot is only used in the Matter context, by the provider calls. Once the stack is started, a dropped snapshot
+ * is freed from the Matter context, so it stays valid until the end of the current provider call even if another task
+ * changes the cluster meanwhile. It must not be kept across provider calls.
+ */
+struct metadata_cache_t {
+    chip::Span<const chip::app::DataModel::AttributeEntry> attributes;
+    chip::Span<const chip::app::DataModel::AcceptedCommandEntry> accepted_commands;
+    chip::Span<const chip::CommandId> generated_commands;
+};
+
+/**
+ * @brief Gets the metadata snapshot of the cluster.
+ *
+ * @param cluster Cluster handle
+ *
+ * @return The snapshot, or NULL if it was not built yet or was invalidated. It is valid until the end of the current
+ *         Matter event, see metadata_cache_t.
+ */
+metadata_cache_t *get_metadata_cache(cluster_t *cluster);
+
+/**
+ * @brief Hands the metadata snapshot over to the cluster, the cluster frees it with esp_matter_mem_free() when it is
+ *        invalidated.
+ *
+ * @param cluster Cluster handle
+ * @param cache   Snapshot allocated with esp_matter_mem_calloc()
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t set_metadata_cache(cluster_t *cluster, metadata_cache_t *cache);
+
+/**
+ * @brief Drops the metadata snapshot of the cluster, if any. Once the stack is started, the snapshot is freed from the
+ *        Matter context.
+ *
+ * @param cluster Cluster handle
+ */
+void invalidate_metadata_cache(cluster_t *cluster);
+
+} // namespace cluster
+} // namespace esp_matter
@@ -74,6 +74,19 @@ esp_err_t get_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val);
 esp_err_t execute_callback(callback_type_t type, uint16_t endpoint_id, uint32_t cluster_id,
                            uint32_t attribute_id, esp_matter_attr_val_t *val);
 
+/** Validate an attribute value without setting it
+ *
+ * Checks the value type, the bounds and, for strings, the maximum length of the attribute. Only the value type is
+ * checked for the attributes managed internally.
+ *
+ * @param[in] attribute Attribute handle.
+ * @param[in] val Pointer to `esp_matter_attr_val_t`. Use appropriate elements as per the value type.
+ *
+ * @return ESP_OK if the value can be set.
+ * @return error in case of failure.
+ */
+esp_err_t validate_val(attribute_t *attribute, esp_matter_attr_val_t *val);
+
 /** Set the attribute value in the esp-matter storage
  *
  * @param[in] attribute Attribute handle.
@@ -85,6 +98,35 @@ esp_err_t execute_callback(callback_type_t type, uint16_t endpoint_id, uint32_t
  */
 esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, bool call_callbacks = true);
 
+/** Check whether the stored value of the attribute has to be reported
+ *
+ * Applies the report policy set with set_report_policy() to the value just stored by a local update. It must be
+ * called with the Matter stack lock held, once per change. The policy only holds back the report: when the change is
+ * not reported now, the data version of the cluster is still increased, so that the reads see the new value.
+ *
+ * @param[in] attribute Attribute handle.
+ *
+ * @return true if the change has to be reported now, always true for the attributes without a report policy.
+ */
+bool should_report_change(attribute_t *attribute);
+
+/** Check whether the stored value of the attribute has to be reported, for a change of a batch
+ *
+ * Same as should_report_change(), but the data version is not increased: the batches increase the data version of
+ * each changed cluster once, with data_model::provider::ReportAttributesChanged().
+ *
+ * @param[in] attribute Attribute handle.
+ *
+ * @return true if the change has to be reported now, always true for the attributes without a report policy.
+ */
+bool should_report_batched_change(attribute_t *attribute);
+
+/** Schedule the background restore of the attributes registered with set_background_restore()
+ *
+ * Called once the Matter stack is started, the attributes created later are scheduled when they are created.
+ */
+void schedule_background_restore();
+
 /** Destroy attribute
  *
  * This function destroys an attribute that was created and added to a cluster.
@@ -0,0 +1,122 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace esp_matter {
+
+/**
+ * @brief Bounded multi-producer single-consumer ring.
+ *
+ * push() can be called from any number of tasks at the same time, pop() from a single task. Neither of them blocks or
+ * takes a lock: each slot carries a sequence number telling whether it is free for the producer of that round or
+ * ready for the consumer. The capacity is rounded up to a power of two.
+ */
+template <typename T, size_t Capacity>
+class mpsc_ring {
+public:
+    static constexpr size_t round_up_capacity(size_t capacity)
+    {
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+
+    static constexpr size_t k_capacity = round_up_capacity(Capacity);
+
+    mpsc_ring()
+    {
+        for (size_t index = 0; index < k_capacity; ++index) {
+            m_slots[index].sequence.store(index, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Copies the item into the ring.
+     *
+     * @return false if the ring is full
+     */
+    bool push(const T &item)
+    {
+        size_t position = m_push_position.load(std::memory_order_relaxed);
+        while (true) {
+            slot_t &slot = m_slots[position & k_mask];
+            intptr_t diff = (intptr_t)slot.sequence.load(std::memory_order_acquire) - (intptr_t)position;
+            if (diff == 0) {
+                // The slot is free for this round, claim it
+                if (m_push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    slot.item = item;
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // The consumer did not release the slot of the previous round yet
+                return false;
+            } else {
+                // Another producer claimed the slot first
+                position = m_push_position.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Moves the oldest item out of the ring. Only one task may call it.
+     *
+     * @return false if the ring is empty
+     */
+    bool pop(T &item)
+    {
+        size_t position = m_pop_position.load(std::memory_order_relaxed);
+        slot_t &slot = m_slots[position & k_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            return false;
+        }
+        item = slot.item;
+        // Hand the slot over to the producers of the next round
+        slot.sequence.store(position + k_capacity, std::memory_order_release);
+        m_pop_position.store(position + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Gets the number of items in the ring. It is a snapshot when producers are running.
+     */
+    size_t size() const
+    {
+        size_t pushed = m_push_position.load(std::memory_order_relaxed);
+        size_t popped = m_pop_position.load(std::memory_order_relaxed);
+        return pushed >= popped ? pushed - popped : 0;
+    }
+
+private:
+    static_assert(Capacity > 0, "The ring needs at least one slot");
+    static constexpr size_t k_mask = k_capacity - 1;
+
+    struct slot_t {
+        std::atomic<size_t> sequence;
+        T item;
+    };
+
+    slot_t m_slots[k_capacity];
+    std::atomic<size_t> m_push_position{0};
+    std::atomic<size_t> m_pop_position{0};
+};
+
+} // namespace esp_matter
@@ -17,10 +17,16 @@
 #include <nvs.h>
 #include <nvs_flash.h>
 #include <esp_matter_attribute_utils.h>
+#include <esp_matter_latency.h>
 #include <esp_matter_mem.h>
 #include <esp_matter_nvs.h>
+#include <esp_rom_crc.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 
+#include <lib/core/DataModelTypes.h>
 #include <lib/support/Base64.h>
+#include <lib/support/CodeUtils.h>
 
 #define ESP_MATTER_NVS_PART_NAME CONFIG_ESP_MATTER_NVS_PART_NAME
 
@@ -47,15 +53,77 @@ static void get_attribute_key(uint16_t endpoint_id, uint32_t cluster_id, uint32_
 
 static esp_err_t nvs_store_val(const char *nvs_namespace, const char *attribute_key, const esp_matter_attr_val_t  &val);
 static esp_err_t nvs_erase_val(const char *nvs_namespace, const char *attribute_key);
-
-static esp_err_t nvs_get_val(const char *nvs_namespace, const char *attribute_key, esp_matter_attr_val_t  &val)
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+static void packed_flush();
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+
+namespace {
+// Handle of the attribute namespace shared by the reads between begin_nvs_restore() and end_nvs_restore()
+struct restore_t {
+    bool active;
+    nvs_handle_t handle;
+    // The namespace of the previous key format is looked up once per endpoint, the attributes of an endpoint are
+    // restored one after the other
+    uint16_t legacy_endpoint_id;
+    bool has_legacy_namespace;
+};
+restore_t s_restore;
+} // namespace
+
+esp_err_t begin_nvs_restore()
 {
+    VerifyOrReturnError(!s_restore.active, ESP_OK);
     nvs_handle_t handle;
-    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, nvs_namespace, NVS_READONLY, &handle);
-    if (err != ESP_OK) {
-        return err;
+    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READONLY, &handle);
+    // The namespace does not exist before the first attribute is stored, nothing to restore
+    VerifyOrReturnError(err == ESP_OK, err == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : err);
+    s_restore = {true, handle, chip::kInvalidEndpointId, false};
+    return ESP_OK;
+}
+
+void end_nvs_restore()
+{
+    if (s_restore.active) {
+        nvs_close(s_restore.handle);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+        // The blob of the last restored cluster might hold attributes moved from their own key
+        packed_flush();
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    }
+    s_restore = {};
+}
+
+static esp_err_t open_for_read(const char *nvs_namespace, nvs_handle_t &handle, bool &shared)
+{
+    shared = s_restore.active && strcmp(nvs_namespace, ESP_MATTER_KVS_NAMESPACE) == 0;
+    if (shared) {
+        handle = s_restore.handle;
+        return ESP_OK;
+    }
+    return nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, nvs_namespace, NVS_READONLY, &handle);
+}
+
+static bool has_legacy_namespace(uint16_t endpoint_id, const char *nvs_namespace)
+{
+    VerifyOrReturnValue(s_restore.active, true);
+    if (s_restore.legacy_endpoint_id != endpoint_id) {
+        nvs_handle_t handle;
+        s_restore.legacy_endpoint_id = endpoint_id;
+        s_restore.has_legacy_namespace =
+            nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, nvs_namespace, NVS_READONLY, &handle) == ESP_OK;
+        if (s_restore.has_legacy_namespace) {
+            nvs_close(handle);
+        }
     }
+    return s_restore.has_legacy_namespace;
+}
 
+// Reads the value with an opened handle. is_blob is set when a primitive value is found in the previous blob format.
+static esp_err_t nvs_read_val(nvs_handle_t handle, const char *attribute_key, esp_matter_attr_val_t  &val,
+                              bool &is_blob)
+{
+    esp_err_t err = ESP_OK;
+    is_blob = false;
     if (val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ||
             val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
             val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
@@ -77,8 +145,6 @@ static esp_err_t nvs_get_val(const char *nvs_namespace, const char *attribute_ke
                 err = nvs_get_blob(handle, attribute_key, buffer, &len);
             }
         }
-
-        nvs_close(handle);
         return err;
     }
 
@@ -143,47 +209,52 @@ static esp_err_t nvs_get_val(const char *nvs_namespace, const char *attribute_ke
 
     default: {
         // handle the case where the type is not recognized
-        nvs_close(handle);
         ESP_LOGE(TAG, "Invalid attribute type: %u", val.type);
         return ESP_ERR_INVALID_ARG;
     }
     }
 
-    // Found the value as primitive data type
-    if (err == ESP_OK) {
-        nvs_close(handle);
-        return err;
-    }
-
     if (err == ESP_ERR_NVS_NOT_FOUND) {
-        // Read as blob, if found, write as primitive data type
+        // Read as blob, if found, the caller writes it as primitive data type
         size_t len = sizeof(esp_matter_attr_val_t);
         err = nvs_get_blob(handle, attribute_key, &val, &len);
-        if (err == ESP_OK) {
-            // found it as a blob, close the handle
-            nvs_close(handle);
-
-            // nvs_store_val always stores primitive value using primitive data type APIs
-            err = nvs_store_val(nvs_namespace, attribute_key, val);
-            if (err != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to store as primitive data type");
-            }
-        }
+        is_blob = err == ESP_OK;
     }
-
-    // There is no harm calling this function even on a closed handle
-    nvs_close(handle);
     return err;
 }
 
-static esp_err_t nvs_store_val(const char *nvs_namespace, const char *attribute_key, const esp_matter_attr_val_t  &val)
+static esp_err_t nvs_get_val(const char *nvs_namespace, const char *attribute_key, esp_matter_attr_val_t  &val)
 {
     nvs_handle_t handle;
-    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, nvs_namespace, NVS_READWRITE, &handle);
+    bool shared = false;
+    esp_err_t err = open_for_read(nvs_namespace, handle, shared);
     if (err != ESP_OK) {
         return err;
     }
+    bool is_blob = false;
+    err = nvs_read_val(handle, attribute_key, val, is_blob);
+    if (!shared) {
+        nvs_close(handle);
+    } else if (err == ESP_ERR_NVS_INVALID_HANDLE) {
+        // The partition was deinitialized during the restore, read without the shared handle
+        end_nvs_restore();
+        return nvs_get_val(nvs_namespace, attribute_key, val);
+    }
+
+    if (is_blob) {
+        // nvs_store_val always stores primitive value using primitive data type APIs
+        err = nvs_store_val(nvs_namespace, attribute_key, val);
+        if (err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to store as primitive data type");
+        }
+    }
+    return err;
+}
 
+// Writes the value with an already opened handle, the caller commits and closes the handle.
+static esp_err_t nvs_set_val(nvs_handle_t handle, const char *attribute_key, const esp_matter_attr_val_t  &val)
+{
+    esp_err_t err = ESP_OK;
     if (val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ||
             val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
             val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
@@ -195,7 +266,6 @@ static esp_err_t nvs_store_val(const char *nvs_namespace, const char *attribute_
         } else {
             err = nvs_erase_key(handle, attribute_key);
         }
-        nvs_commit(handle);
     } else {
         // This switch case handles primitive data types
         // always store values as primitive data type
@@ -259,6 +329,17 @@ static esp_err_t nvs_store_val(const char *nvs_namespace, const char *attribute_
         }
         }
     }
+    return err;
+}
+
+static esp_err_t nvs_store_val(const char *nvs_namespace, const char *attribute_key, const esp_matter_attr_val_t  &val)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, nvs_namespace, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_val(handle, attribute_key, val);
     nvs_commit(handle);
     nvs_close(handle);
     return err;
@@ -277,7 +358,388 @@ static esp_err_t nvs_erase_val(const char *nvs_namespace, const char *attribute_
     return err;
 }
 
-esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t  &val)
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+// Packed storage: the non-volatile attributes of a cluster are stored in one blob, keyed by the base64 encoded
+// endpoint_id and cluster_id.
+//   header: version (1 byte), reserved (1 byte), record count (2 bytes), crc32 of the records (4 bytes)
+//   record: attribute_id (4 bytes), value type (1 byte), value length (2 bytes), value (length bytes)
+// Primitive values are stored with the size of their storage type, strings and arrays with their length.
+constexpr uint8_t k_packed_version = 1;
+constexpr size_t k_packed_header_size = 8;
+constexpr size_t k_packed_record_header_size = 7;
+
+namespace {
+// The blob of the last accessed cluster. The attributes of a cluster are restored one after the other when it is
+// created, so they are all served from a single blob read.
+struct packed_cluster_t {
+    bool valid;
+    bool dirty; // Set within a batch until end_nvs_batch(), or after a failed write until it is written again
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    uint8_t *blob;
+    size_t len;
+    // Attributes moved into the blob from their own key, the keys are erased once the blob is written
+    uint32_t *migrated_ids;
+    uint16_t migrated_count;
+};
+packed_cluster_t s_packed_cluster;
+
+// The cached blob is used by the restore, the write-back queue and the direct stores. They might run in different
+// tasks, some of them before the Matter stack is started, so the cache has its own lock. It is recursive because a
+// read moves the values stored with their own key into the blob.
+class packed_lock_t {
+public:
+    packed_lock_t()
+    {
+        xSemaphoreTakeRecursive(get_mutex(), portMAX_DELAY);
+    }
+    ~packed_lock_t()
+    {
+        xSemaphoreGiveRecursive(get_mutex());
+    }
+
+private:
+    static SemaphoreHandle_t get_mutex()
+    {
+        static StaticSemaphore_t mutex_buffer;
+        static SemaphoreHandle_t mutex = xSemaphoreCreateRecursiveMutexStatic(&mutex_buffer);
+        return mutex;
+    }
+};
+} // namespace
+
+static void get_cluster_key(uint16_t endpoint_id, uint32_t cluster_id, char *cluster_key)
+{
+    // 6 bytes are encoded to 8 base64 characters without padding
+    uint8_t encode_buf[6] = {0};
+    memcpy(&encode_buf[0], &endpoint_id, sizeof(endpoint_id));
+    memcpy(&encode_buf[2], &cluster_id, sizeof(cluster_id));
+    chip::Base64Encode(encode_buf, 6, cluster_key);
+    cluster_key[8] = 0;
+}
+
+// Erases the keys of the attributes moved into the blob, after the blob is written
+static void packed_erase_migrated(nvs_handle_t handle)
+{
+    for (uint16_t i = 0; i < s_packed_cluster.migrated_count; ++i) {
+        char attribute_key[16] = {0};
+        get_attribute_key(s_packed_cluster.endpoint_id, s_packed_cluster.cluster_id, s_packed_cluster.migrated_ids[i],
+                          attribute_key);
+        esp_err_t err = nvs_erase_key(handle, attribute_key);
+        if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+            ESP_LOGE(TAG, "Failed to erase migrated attribute key");
+        }
+    }
+    esp_matter_mem_free(s_packed_cluster.migrated_ids);
+    s_packed_cluster.migrated_ids = nullptr;
+    s_packed_cluster.migrated_count = 0;
+}
+
+static uint32_t packed_crc(const uint8_t *blob, size_t len)
+{
+    return esp_rom_crc32_le(0, blob + k_packed_header_size, len - k_packed_header_size);
+}
+
+static void packed_update_header(uint8_t *blob, size_t len, uint16_t count)
+{
+    blob[0] = k_packed_version;
+    blob[1] = 0;
+    memcpy(&blob[2], &count, sizeof(count));
+    uint32_t crc = packed_crc(blob, len);
+    memcpy(&blob[4], &crc, sizeof(crc));
+}
+
+// Writes and commits the loaded blob if it has changes. It stays dirty if the write fails, so that it is written again
+// by the next store or when another cluster is loaded.
+static esp_err_t packed_write(nvs_handle_t handle)
+{
+    VerifyOrReturnError(s_packed_cluster.valid && s_packed_cluster.dirty, ESP_OK);
+    char cluster_key[16] = {0};
+    get_cluster_key(s_packed_cluster.endpoint_id, s_packed_cluster.cluster_id, cluster_key);
+    uint16_t count = 0;
+    memcpy(&count, &s_packed_cluster.blob[2], sizeof(count));
+    esp_err_t err = ESP_OK;
+    if (count == 0) {
+        err = nvs_erase_key(handle, cluster_key);
+        err = err == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : err;
+    } else {
+        err = nvs_set_blob(handle, cluster_key, s_packed_cluster.blob, s_packed_cluster.len);
+    }
+    if (err == ESP_OK) {
+        packed_erase_migrated(handle);
+        err = nvs_commit(handle);
+    }
+    if (err == ESP_OK) {
+        s_packed_cluster.dirty = false;
+    }
+    return err;
+}
+
+// Writes the loaded blob before another cluster is loaded. The handle of the caller might be read-only, the blob is
+// written with its own handle.
+static esp_err_t packed_evict()
+{
+    VerifyOrReturnError(s_packed_cluster.valid && s_packed_cluster.dirty, ESP_OK);
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READWRITE, &handle);
+    VerifyOrReturnError(err == ESP_OK, err);
+    err = packed_write(handle);
+    nvs_close(handle);
+    return err;
+}
+
+static void packed_reset()
+{
+    // The keys of the migrated attributes are kept, they are moved again by the next read
+    esp_matter_mem_free(s_packed_cluster.migrated_ids);
+    esp_matter_mem_free(s_packed_cluster.blob);
+    s_packed_cluster = {};
+}
+
+static esp_err_t packed_load(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id)
+{
+    if (s_packed_cluster.valid && s_packed_cluster.endpoint_id == endpoint_id &&
+            s_packed_cluster.cluster_id == cluster_id) {
+        return ESP_OK;
+    }
+    esp_err_t err = packed_evict();
+    // Keep the changes which are not stored yet instead of dropping them, the eviction is retried by the next access
+    VerifyOrReturnError(err == ESP_OK, err,
+                        ESP_LOGE(TAG, "Failed to store the attributes of cluster 0x%" PRIx32 " on endpoint 0x%" PRIx16,
+                                 s_packed_cluster.cluster_id, s_packed_cluster.endpoint_id));
+    packed_reset();
+
+    char cluster_key[16] = {0};
+    get_cluster_key(endpoint_id, cluster_id, cluster_key);
+    size_t len = 0;
+    uint8_t *blob = nullptr;
+    err = nvs_get_blob(handle, cluster_key, NULL, &len);
+    if (err == ESP_OK && len >= k_packed_header_size) {
+        blob = (uint8_t *)esp_matter_mem_calloc(1, len);
+        VerifyOrReturnError(blob, ESP_ERR_NO_MEM);
+        err = nvs_get_blob(handle, cluster_key, blob, &len);
+        uint32_t crc = 0;
+        memcpy(&crc, &blob[4], sizeof(crc));
+        if (err != ESP_OK || blob[0] != k_packed_version || crc != packed_crc(blob, len)) {
+            ESP_LOGE(TAG, "Discarding the invalid attribute blob of cluster 0x%" PRIx32 " on endpoint 0x%" PRIx16,
+                     cluster_id, endpoint_id);
+            esp_matter_mem_free(blob);
+            blob = nullptr;
+        }
+    } else if (err != ESP_OK && err != ESP_ERR_NVS_NOT_FOUND) {
+        return err;
+    }
+    if (!blob) {
+        // Start with an empty blob, it is written once an attribute is stored
+        len = k_packed_header_size;
+        blob = (uint8_t *)esp_matter_mem_calloc(1, len);
+        VerifyOrReturnError(blob, ESP_ERR_NO_MEM);
+        packed_update_header(blob, len, 0);
+    }
+    s_packed_cluster = {true, false, endpoint_id, cluster_id, blob, len};
+    return ESP_OK;
+}
+
+// Returns the offset of the record of the attribute in the loaded blob, or 0 if it is not present
+static size_t packed_find(uint32_t attribute_id, uint16_t &value_len)
+{
+    size_t offset = k_packed_header_size;
+    while (offset + k_packed_record_header_size <= s_packed_cluster.len) {
+        uint32_t record_attribute_id = 0;
+        memcpy(&record_attribute_id, &s_packed_cluster.blob[offset], sizeof(record_attribute_id));
+        memcpy(&value_len, &s_packed_cluster.blob[offset + 5], sizeof(value_len));
+        if (offset + k_packed_record_header_size + value_len > s_packed_cluster.len) {
+            break;
+        }
+        if (record_attribute_id == attribute_id) {
+            return offset;
+        }
+        offset += k_packed_record_header_size + value_len;
+    }
+    return 0;
+}
+
+static bool is_buffer_type(esp_matter_val_type_t type)
+{
+    return type == ESP_MATTER_VAL_TYPE_CHAR_STRING || type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING ||
+           type == ESP_MATTER_VAL_TYPE_OCTET_STRING || type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING ||
+           type == ESP_MATTER_VAL_TYPE_ARRAY;
+}
+
+static uint16_t get_primitive_size(const esp_matter_attr_val_t &val)
+{
+    switch (val.get_storage_type()) {
+    case ESP_MATTER_VAL_TYPE_BOOLEAN:
+    case ESP_MATTER_VAL_TYPE_INT8:
+    case ESP_MATTER_VAL_TYPE_UINT8:
+        return 1;
+    case ESP_MATTER_VAL_TYPE_INT16:
+    case ESP_MATTER_VAL_TYPE_UINT16:
+        return 2;
+    case ESP_MATTER_VAL_TYPE_FLOAT:
+    case ESP_MATTER_VAL_TYPE_INT32:
+    case ESP_MATTER_VAL_TYPE_UINT32:
+        return 4;
+    case ESP_MATTER_VAL_TYPE_INT64:
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+static esp_err_t packed_get_val(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                esp_matter_attr_val_t &val)
+{
+    esp_err_t err = packed_load(handle, endpoint_id, cluster_id);
+    VerifyOrReturnError(err == ESP_OK, err);
+    uint16_t value_len = 0;
+    size_t offset = packed_find(attribute_id, value_len);
+    VerifyOrReturnError(offset != 0, ESP_ERR_NVS_NOT_FOUND);
+    VerifyOrReturnError(s_packed_cluster.blob[offset + 4] == val.type, ESP_ERR_NVS_TYPE_MISMATCH,
+                        ESP_LOGE(TAG, "Stored type of attribute 0x%" PRIx32 " does not match", attribute_id));
+    const uint8_t *value = &s_packed_cluster.blob[offset + k_packed_record_header_size];
+
+    if (is_buffer_type(val.type)) {
+        // Same as nvs_get_val(), we should not decrease the size of the attribute value
+        size_t len = std::max(value_len, val.val.a.s);
+        bool null_reserve = (val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING) || (val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING);
+        uint8_t *buffer = (uint8_t *)esp_matter_mem_calloc(1, len + (null_reserve ? 1 : 0));
+        VerifyOrReturnError(buffer, ESP_ERR_NO_MEM);
+        memcpy(buffer, value, value_len);
+        val.val.a.b = buffer;
+        val.val.a.t = len + (val.val.a.t - val.val.a.s);
+        val.val.a.s = len;
+        return ESP_OK;
+    }
+    VerifyOrReturnError(value_len == get_primitive_size(val), ESP_ERR_NVS_TYPE_MISMATCH);
+    memcpy(&val.val, value, value_len);
+    return ESP_OK;
+}
+
+// Replaces the record of the attribute in the loaded blob, the record is removed if val is nullptr or a null string.
+static esp_err_t packed_set_val(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                const esp_matter_attr_val_t *val)
+{
+    esp_err_t err = packed_load(handle, endpoint_id, cluster_id);
+    VerifyOrReturnError(err == ESP_OK, err);
+
+    const uint8_t *value = nullptr;
+    uint16_t value_len = 0;
+    if (val && is_buffer_type(val->type)) {
+        value = val->val.a.b;
+        value_len = val->val.a.s;
+    } else if (val) {
+        value = (const uint8_t *)&val->val;
+        value_len = get_primitive_size(*val);
+        VerifyOrReturnError(value_len > 0, ESP_ERR_INVALID_ARG, ESP_LOGE(TAG, "Invalid attribute type: %u", val->type));
+    }
+
+    uint16_t count = 0;
+    memcpy(&count, &s_packed_cluster.blob[2], sizeof(count));
+    uint16_t old_value_len = 0;
+    size_t old_offset = packed_find(attribute_id, old_value_len);
+    size_t old_record_len = old_offset ? k_packed_record_header_size + old_value_len : 0;
+    size_t new_record_len = value ? k_packed_record_header_size + value_len : 0;
+    if (old_record_len == 0 && new_record_len == 0) {
+        return ESP_OK;
+    }
+
+    size_t new_len = s_packed_cluster.len - old_record_len + new_record_len;
+    uint8_t *new_blob = (uint8_t *)esp_matter_mem_calloc(1, new_len);
+    VerifyOrReturnError(new_blob, ESP_ERR_NO_MEM);
+    size_t new_offset = k_packed_header_size;
+    if (old_offset) {
+        // Keep the other records, the record of the attribute is appended at the end
+        memcpy(&new_blob[new_offset], &s_packed_cluster.blob[k_packed_header_size], old_offset - k_packed_header_size);
+        new_offset += old_offset - k_packed_header_size;
+        size_t tail = s_packed_cluster.len - old_offset - old_record_len;
+        memcpy(&new_blob[new_offset], &s_packed_cluster.blob[old_offset + old_record_len], tail);
+        new_offset += tail;
+        count--;
+    } else {
+        memcpy(&new_blob[new_offset], &s_packed_cluster.blob[k_packed_header_size],
+               s_packed_cluster.len - k_packed_header_size);
+        new_offset += s_packed_cluster.len - k_packed_header_size;
+    }
+    if (value) {
+        memcpy(&new_blob[new_offset], &attribute_id, sizeof(attribute_id));
+        new_blob[new_offset + 4] = (uint8_t)val->type;
+        memcpy(&new_blob[new_offset + 5], &value_len, sizeof(value_len));
+        if (value_len > 0) {
+            memcpy(&new_blob[new_offset + k_packed_record_header_size], value, value_len);
+        }
+        count++;
+    }
+    packed_update_header(new_blob, new_len, count);
+
+    esp_matter_mem_free(s_packed_cluster.blob);
+    s_packed_cluster.blob = new_blob;
+    s_packed_cluster.len = new_len;
+    s_packed_cluster.dirty = true;
+    return ESP_OK;
+}
+
+static esp_err_t packed_store_val(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                  const esp_matter_attr_val_t *val)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    // The loaded blob is left unchanged if the value cannot be set
+    err = packed_set_val(handle, endpoint_id, cluster_id, attribute_id, val);
+    if (err == ESP_OK) {
+        err = packed_write(handle);
+    }
+    nvs_close(handle);
+    return err;
+}
+
+// Moves a value stored with its own key into the loaded blob, as a store of a batch. The attributes of a cluster are
+// restored one after the other, so the blob is written once for all of them: when another cluster is loaded, by the
+// next store or at the end of the restore. The key is erased only then, the value is moved again by the next restore
+// if the device restarts before.
+static esp_err_t packed_migrate_val(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                    const esp_matter_attr_val_t &val)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READWRITE, &handle);
+    VerifyOrReturnError(err == ESP_OK, err);
+    err = packed_load(handle, endpoint_id, cluster_id);
+    if (err == ESP_OK) {
+        // Reserve the entry first, the value must not be in the blob without its key being erased later
+        uint32_t *migrated_ids = (uint32_t *)esp_matter_mem_realloc(s_packed_cluster.migrated_ids,
+                                                                    (s_packed_cluster.migrated_count + 1) *
+                                                                    sizeof(uint32_t));
+        if (migrated_ids) {
+            s_packed_cluster.migrated_ids = migrated_ids;
+            err = packed_set_val(handle, endpoint_id, cluster_id, attribute_id, &val);
+        } else {
+            err = ESP_ERR_NO_MEM;
+        }
+    }
+    if (err == ESP_OK) {
+        s_packed_cluster.migrated_ids[s_packed_cluster.migrated_count++] = attribute_id;
+    }
+    nvs_close(handle);
+    return err;
+}
+
+// Writes the loaded blob at the end of a restore, with the attributes moved into it
+static void packed_flush()
+{
+    packed_lock_t lock;
+    if (packed_evict() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store the attributes of cluster 0x%" PRIx32 " on endpoint 0x%" PRIx16,
+                 s_packed_cluster.cluster_id, s_packed_cluster.endpoint_id);
+    }
+}
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+
+static esp_err_t get_val_from_nvs_key(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                     esp_matter_attr_val_t  &val)
 {
     /* Get attribute key */
     char attribute_key[16] = {0};
@@ -293,6 +755,7 @@ esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
         char old_attribute_key[16] = {0};
         snprintf(nvs_namespace, 16, "endpoint_%" PRIX16 "", endpoint_id); /* endpoint_id */
         snprintf(old_attribute_key, 16, "%" PRIX32 ":%" PRIX32 "", cluster_id, attribute_id); /* cluster_id:attribute_id */
+        VerifyOrReturnError(has_legacy_namespace(endpoint_id, nvs_namespace), ESP_ERR_NVS_NOT_FOUND);
         err = nvs_get_val(nvs_namespace, old_attribute_key, val);
         if (err == ESP_OK) {
             // If we get the attribute value with the previous key, we will erase it and store it in current namespace
@@ -308,14 +771,95 @@ esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
     return err;
 }
 
+esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t  &val)
+{
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    packed_lock_t lock;
+    nvs_handle_t handle;
+    bool shared = false;
+    esp_err_t err = open_for_read(ESP_MATTER_KVS_NAMESPACE, handle, shared);
+    if (err == ESP_OK) {
+        err = packed_get_val(handle, endpoint_id, cluster_id, attribute_id, val);
+        if (!shared) {
+            nvs_close(handle);
+        } else if (err == ESP_ERR_NVS_INVALID_HANDLE) {
+            // The partition was deinitialized during the restore, read without the shared handle
+            end_nvs_restore();
+            return get_val_from_nvs(endpoint_id, cluster_id, attribute_id, val);
+        }
+        if (err != ESP_ERR_NVS_NOT_FOUND) {
+            return err;
+        }
+    }
+    // The attribute is not in the cluster blob yet, if it is stored with its own key, move it into the blob.
+    err = get_val_from_nvs_key(endpoint_id, cluster_id, attribute_id, val);
+    if (err == ESP_OK && packed_migrate_val(endpoint_id, cluster_id, attribute_id, val) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to move attribute_val into the cluster blob");
+    }
+    return err;
+#else
+    return get_val_from_nvs_key(endpoint_id, cluster_id, attribute_id, val);
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+}
+
 esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, const esp_matter_attr_val_t  &val)
 {
+    ESP_LOGD(TAG, "Store attribute in nvs: endpoint_id-0x%" PRIx16 ", cluster_id-0x%" PRIx32 ", attribute_id-0x%" PRIx32 "",
+             endpoint_id, cluster_id, attribute_id);
+    latency::scoped_timer timer(latency::OPERATION_NVS_STORE, endpoint_id, cluster_id);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    packed_lock_t lock;
+    return packed_store_val(endpoint_id, cluster_id, attribute_id, &val);
+#else
     /* Get attribute key */
     char attribute_key[16] = {0};
     get_attribute_key(endpoint_id, cluster_id, attribute_id, attribute_key);
-    ESP_LOGD(TAG, "Store attribute in nvs: endpoint_id-0x%" PRIx16 ", cluster_id-0x%" PRIx32 ", attribute_id-0x%" PRIx32 "",
-             endpoint_id, cluster_id, attribute_id);
     return nvs_store_val(ESP_MATTER_KVS_NAMESPACE, attribute_key, val);
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+}
+
+esp_err_t begin_nvs_batch(nvs_handle_t &handle)
+{
+    return nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READWRITE, &handle);
+}
+
+esp_err_t store_val_in_nvs_batch(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                 const esp_matter_attr_val_t  &val)
+{
+    ESP_LOGD(TAG, "Store attribute in nvs batch: endpoint_id-0x%" PRIx16 ", cluster_id-0x%" PRIx32 ", attribute_id-0x%" PRIx32 "",
+             endpoint_id, cluster_id, attribute_id);
+    latency::scoped_timer timer(latency::OPERATION_NVS_STORE, endpoint_id, cluster_id);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    // The blob is written once per cluster, when the batch moves to another cluster or ends
+    packed_lock_t lock;
+    return packed_set_val(handle, endpoint_id, cluster_id, attribute_id, &val);
+#else
+    /* Get attribute key */
+    char attribute_key[16] = {0};
+    get_attribute_key(endpoint_id, cluster_id, attribute_id, attribute_key);
+    return nvs_set_val(handle, attribute_key, val);
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+}
+
+esp_err_t end_nvs_batch(nvs_handle_t handle)
+{
+    latency::scoped_timer timer(latency::OPERATION_NVS_COMMIT, latency::k_any_endpoint_id, latency::k_any_cluster_id);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    esp_err_t write_err = ESP_OK;
+    {
+        packed_lock_t lock;
+        write_err = packed_write(handle);
+    }
+    if (write_err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store the attribute blob");
+    }
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    esp_err_t err = nvs_commit(handle);
+    nvs_close(handle);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    err = write_err != ESP_OK ? write_err : err;
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    return err;
 }
 
 esp_err_t erase_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id)
@@ -325,7 +869,29 @@ esp_err_t erase_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
     get_attribute_key(endpoint_id, cluster_id, attribute_id, attribute_key);
     ESP_LOGD(TAG, "Erase attribute in nvs: endpoint_id-0x%" PRIx16 ", cluster_id-0x%" PRIx32 ", attribute_id-0x%" PRIx32 "",
              endpoint_id, cluster_id, attribute_id);
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    esp_err_t err = ESP_OK;
+    {
+        packed_lock_t lock;
+        err = packed_store_val(endpoint_id, cluster_id, attribute_id, nullptr);
+    }
+    // Also erase the value stored with its own key, otherwise the next restore would move it back into the blob
+    esp_err_t key_err = nvs_erase_val(ESP_MATTER_KVS_NAMESPACE, attribute_key);
+    if (key_err != ESP_OK && key_err != ESP_ERR_NVS_NOT_FOUND) {
+        err = err != ESP_OK ? err : key_err;
+    }
+    return err;
+#else
     return nvs_erase_val(ESP_MATTER_KVS_NAMESPACE, attribute_key);
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+}
+
+void discard_nvs_cache()
+{
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+    packed_lock_t lock;
+    packed_reset();
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
 }
 
 } // namespace attribute
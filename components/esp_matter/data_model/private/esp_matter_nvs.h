@@ -16,6 +16,7 @@
 
 #include <esp_err.h>
 #include <esp_matter_attribute_utils.h>
+#include <nvs.h>
 
 namespace esp_matter {
 namespace attribute {
@@ -33,6 +34,22 @@ namespace attribute {
  */
 esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, esp_matter_attr_val_t  &val);
 
+/**
+ * @brief Keeps the NVS namespace of the attributes open for the reads of get_val_from_nvs() until end_nvs_restore(),
+ *        so that restoring the attributes of a whole node does not open and close the namespace for each of them.
+ *        Nothing if a restore is already in progress.
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t begin_nvs_restore();
+
+/**
+ * @brief Closes the NVS namespace opened by begin_nvs_restore(). Nothing if no restore is in progress.
+ *        With the packed cluster storage, the blob of the last restored cluster is written if attributes stored with
+ *        their own key were moved into it.
+ */
+void end_nvs_restore();
+
 /**
  * @brief Stores the attribute value in NVS, it generates the key based on endpoint, cluster, and attribute id.
  *
@@ -44,6 +61,39 @@ esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
  */
 esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, const esp_matter_attr_val_t  &val);
 
+/**
+ * @brief Opens the NVS namespace of the attributes for a batch of stores. The values stored with
+ *        store_val_in_nvs_batch() are committed once by end_nvs_batch().
+ *
+ * @param handle  Output NVS handle of the batch
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t begin_nvs_batch(nvs_handle_t &handle);
+
+/**
+ * @brief Stores the attribute value in an NVS batch, it generates the key based on endpoint, cluster, and attribute id.
+ *        The value is not committed until end_nvs_batch() is called.
+ *
+ * @param handle       NVS handle from begin_nvs_batch()
+ * @param endpoint_id  Endpoint Id
+ * @param cluster_id   Cluster Id
+ * @param attribute_id Attribute Id
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t store_val_in_nvs_batch(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                 const esp_matter_attr_val_t  &val);
+
+/**
+ * @brief Commits the values stored in the NVS batch and closes its handle.
+ *
+ * @param handle  NVS handle from begin_nvs_batch()
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t end_nvs_batch(nvs_handle_t handle);
+
 /**
  * @brief Erases the attribute value in NVS, it generates the key based on endpoint, cluster, and attribute id.
  *
@@ -55,5 +105,11 @@ esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t a
  */
 esp_err_t erase_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id);
 
+/**
+ * @brief Drops the cached attribute blob of CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE without writing it, used
+ *        before the namespace of the attributes is erased. Nothing if the option is disabled.
+ */
+void discard_nvs_cache();
+
 } // namespace attribute
 } // namespace esp_matter
@@ -0,0 +1,186 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_err.h>
+#include <esp_log.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+#include <esp_matter_data_model_priv.h>
+#include <esp_matter_nvs.h>
+#include <esp_matter_nvs_write_back.h>
+
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+
+namespace esp_matter {
+namespace attribute {
+namespace write_back {
+
+static const char *TAG = "mtr_nvs_wb";
+
+namespace {
+struct entry_t {
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    uint32_t attribute_id;
+};
+
+constexpr uint16_t k_queue_size = CONFIG_ESP_MATTER_NVS_WRITE_BACK_QUEUE_SIZE;
+
+entry_t s_queue[k_queue_size];
+uint16_t s_count = 0;
+uint16_t s_batch_depth = 0;
+chip::System::Clock::Timestamp s_flush_deadline;
+} // namespace
+
+static void flush_timer_callback(chip::System::Layer *layer, void *context)
+{
+    flush();
+}
+
+static esp_err_t store_now(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id)
+{
+    attribute_t *attribute = attribute::get(endpoint_id, cluster_id, attribute_id);
+    VerifyOrReturnError(attribute, ESP_ERR_NOT_FOUND);
+    esp_matter_attr_val_t val;
+    VerifyOrReturnError(get_val_internal(attribute, &val) == ESP_OK, ESP_ERR_INVALID_STATE);
+    return store_val_in_nvs(endpoint_id, cluster_id, attribute_id, val);
+}
+
+esp_err_t enqueue(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, uint32_t delay_ms)
+{
+    // The timers can only be used once the Matter stack is started, write the value directly before that.
+    if (!esp_matter::is_started() && s_batch_depth == 0) {
+        return store_now(endpoint_id, cluster_id, attribute_id);
+    }
+
+    bool queued = false;
+    for (uint16_t index = 0; index < s_count; ++index) {
+        if (s_queue[index].endpoint_id == endpoint_id && s_queue[index].cluster_id == cluster_id &&
+                s_queue[index].attribute_id == attribute_id) {
+            queued = true;
+            break;
+        }
+    }
+    if (!queued) {
+        s_queue[s_count++] = {endpoint_id, cluster_id, attribute_id};
+        if (s_count == k_queue_size) {
+            // Size budget reached, no need to wait for the timer
+            return flush();
+        }
+    }
+    // The batch flushes the queue when it ends
+    VerifyOrReturnError(s_batch_depth == 0, ESP_OK);
+
+    auto &system_layer = chip::DeviceLayer::SystemLayer();
+    chip::System::Clock::Timestamp deadline =
+        chip::System::SystemClock().GetMonotonicTimestamp() + chip::System::Clock::Milliseconds32(delay_ms);
+    if (system_layer.IsTimerActive(flush_timer_callback, nullptr) && s_flush_deadline <= deadline) {
+        // An earlier flush is already scheduled and will also write this attribute
+        return ESP_OK;
+    }
+    s_flush_deadline = deadline;
+    CHIP_ERROR err = system_layer.StartTimer(chip::System::Clock::Milliseconds32(delay_ms), flush_timer_callback,
+                                             nullptr);
+    VerifyOrReturnError(err == CHIP_NO_ERROR, ESP_FAIL, ESP_LOGE(TAG, "Failed to start the write-back timer"));
+    return ESP_OK;
+}
+
+void discard(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id)
+{
+    for (uint16_t index = 0; index < s_count; ++index) {
+        if (s_queue[index].endpoint_id == endpoint_id && s_queue[index].cluster_id == cluster_id &&
+                s_queue[index].attribute_id == attribute_id) {
+            // The order of the queue does not matter, move the last entry here
+            s_queue[index] = s_queue[--s_count];
+            return;
+        }
+    }
+}
+
+esp_err_t flush()
+{
+    if (esp_matter::is_started()) {
+        chip::DeviceLayer::SystemLayer().CancelTimer(flush_timer_callback, nullptr);
+    }
+    VerifyOrReturnError(s_count > 0, ESP_OK);
+
+    nvs_handle_t handle;
+    esp_err_t err = begin_nvs_batch(handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open the nvs namespace, dropping %u queued attributes", s_count);
+        s_count = 0;
+        return err;
+    }
+
+    uint16_t stored_count = 0;
+    for (uint16_t index = 0; index < s_count; ++index) {
+        const entry_t &entry = s_queue[index];
+        // The value is read now, so it is the latest one. The attribute might have been destroyed since it was queued.
+        attribute_t *attribute = attribute::get(entry.endpoint_id, entry.cluster_id, entry.attribute_id);
+        esp_matter_attr_val_t val;
+        if (!attribute || get_val_internal(attribute, &val) != ESP_OK) {
+            continue;
+        }
+        esp_err_t store_err = store_val_in_nvs_batch(handle, entry.endpoint_id, entry.cluster_id,
+                                                     entry.attribute_id, val);
+        if (store_err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to store attribute 0x%" PRIx32 " of cluster 0x%" PRIx32 " on endpoint 0x%" PRIx16,
+                     entry.attribute_id, entry.cluster_id, entry.endpoint_id);
+            err = store_err;
+            continue;
+        }
+        stored_count++;
+    }
+    s_count = 0;
+
+    esp_err_t commit_err = end_nvs_batch(handle);
+    ESP_LOGD(TAG, "Stored %u attributes with one commit", stored_count);
+    return err != ESP_OK ? err : commit_err;
+}
+
+void clear()
+{
+    if (esp_matter::is_started()) {
+        chip::DeviceLayer::SystemLayer().CancelTimer(flush_timer_callback, nullptr);
+    }
+    s_count = 0;
+}
+
+void begin_batch()
+{
+    s_batch_depth++;
+}
+
+esp_err_t end_batch()
+{
+    VerifyOrReturnError(s_batch_depth > 0, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "No batch to end"));
+    VerifyOrReturnError(--s_batch_depth == 0, ESP_OK);
+    return flush();
+}
+
+bool in_batch()
+{
+    return s_batch_depth > 0;
+}
+
+uint16_t get_pending_count()
+{
+    return s_count;
+}
+
+} // namespace write_back
+} // namespace attribute
+} // namespace esp_matter
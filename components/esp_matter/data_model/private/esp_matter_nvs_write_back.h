@@ -0,0 +1,90 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace attribute {
+namespace write_back {
+
+/**
+ * @brief Queues the attribute for persistence. The attribute value is read from the data model when the queue is
+ *        flushed, so repeated changes of the same attribute are written once.
+ *
+ * The queue is flushed with one NVS handle and one commit, at most delay_ms after this call or immediately when the
+ * queue is full. It must be called with the Matter stack lock held.
+ *
+ * @param endpoint_id  Endpoint Id
+ * @param cluster_id   Cluster Id
+ * @param attribute_id Attribute Id
+ * @param delay_ms     Maximum time before the attribute value is written to flash
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t enqueue(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, uint32_t delay_ms);
+
+/**
+ * @brief Removes the attribute from the queue, if present. Used when the attribute is destroyed.
+ *
+ * @param endpoint_id  Endpoint Id
+ * @param cluster_id   Cluster Id
+ * @param attribute_id Attribute Id
+ */
+void discard(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id);
+
+/**
+ * @brief Writes all the queued attribute values to flash with one NVS handle and one commit. It must be called with
+ *        the Matter stack lock held.
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t flush();
+
+/**
+ * @brief Drops the queued attributes without writing them, used before the esp_matter namespace is erased. It must
+ *        be called with the Matter stack lock held.
+ */
+void clear();
+
+/**
+ * @brief Starts a batch. Until the matching end_batch(), queued attributes wait for end_batch() instead of a timer.
+ *
+ * Batches can be nested, the queue is flushed when the outermost batch ends. It must be called with the Matter stack
+ * lock held.
+ */
+void begin_batch();
+
+/**
+ * @brief Ends a batch started with begin_batch() and flushes the queue if it was the outermost one.
+ *
+ * @return ESP_OK on success, appropriate error code otherwise
+ */
+esp_err_t end_batch();
+
+/**
+ * @brief Checks whether a batch is in progress.
+ */
+bool in_batch();
+
+/**
+ * @brief Gets the number of attributes waiting in the queue.
+ */
+uint16_t get_pending_count();
+
+} // namespace write_back
+} // namespace attribute
+} // namespace esp_matter
@@ -0,0 +1,176 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_err.h>
+#include <esp_log.h>
+#include <esp_matter_core.h>
+#include <esp_matter_mem.h>
+#include <esp_matter_report_policy.h>
+#include <math.h>
+
+#include <data_model_provider/esp_matter_data_model_provider.h>
+
+#include <app/AttributePathParams.h>
+#include <lib/support/CodeUtils.h>
+#include <platform/CHIPDeviceLayer.h>
+#include <system/SystemClock.h>
+
+namespace esp_matter {
+namespace attribute {
+namespace report_policy {
+
+static const char *TAG = "mtr_report_policy";
+
+struct state_t {
+    report_policy_t policy;
+    uint16_t endpoint_id;
+    uint32_t cluster_id;
+    uint32_t attribute_id;
+    /* Smoothed value of the numeric attributes, the raw value without an EWMA window */
+    float smoothed;
+    /* Smoothed value at the last report, the thresholds are relative to it */
+    float reported;
+    chip::System::Clock::Timestamp last_report_time;
+    bool has_smoothed;
+    bool has_reported;
+    bool has_report_time;
+    bool pending;
+};
+
+static bool get_numeric_val(const esp_matter_attr_val_t &val, float &numeric)
+{
+    switch (val.get_storage_type()) {
+    case ESP_MATTER_VAL_TYPE_UINT8:
+        numeric = val.val.u8;
+        return true;
+    case ESP_MATTER_VAL_TYPE_UINT16:
+        numeric = val.val.u16;
+        return true;
+    case ESP_MATTER_VAL_TYPE_UINT32:
+        numeric = val.val.u32;
+        return true;
+    case ESP_MATTER_VAL_TYPE_UINT64:
+        numeric = val.val.u64;
+        return true;
+    case ESP_MATTER_VAL_TYPE_INT8:
+        numeric = val.val.i8;
+        return true;
+    case ESP_MATTER_VAL_TYPE_INT16:
+        numeric = val.val.i16;
+        return true;
+    case ESP_MATTER_VAL_TYPE_INT32:
+        numeric = val.val.i32;
+        return true;
+    case ESP_MATTER_VAL_TYPE_INT64:
+        numeric = val.val.i64;
+        return true;
+    case ESP_MATTER_VAL_TYPE_FLOAT:
+        numeric = val.val.f;
+        return true;
+    default:
+        break;
+    }
+    return false;
+}
+
+static void mark_reported(state_t *state, chip::System::Clock::Timestamp now)
+{
+    state->reported = state->smoothed;
+    state->has_reported = state->has_smoothed;
+    state->last_report_time = now;
+    state->has_report_time = true;
+}
+
+static void pending_report_timer_callback(chip::System::Layer *layer, void *context)
+{
+    state_t *state = (state_t *)context;
+    state->pending = false;
+    mark_reported(state, chip::System::SystemClock().GetMonotonicTimestamp());
+    data_model::provider::get_instance().Temporary_ReportAttributeChanged(
+        chip::app::AttributePathParams(state->endpoint_id, state->cluster_id, state->attribute_id));
+}
+
+static bool is_significant(state_t *state, const esp_matter_attr_val_t &val)
+{
+    float sample = 0;
+    if (val.is_null() || !get_numeric_val(val, sample)) {
+        // Only the minimum interval applies to the null and non numeric values
+        state->has_smoothed = false;
+        return true;
+    }
+
+    const report_policy_t &policy = state->policy;
+    if (state->has_smoothed && policy.ewma_window > 1) {
+        state->smoothed += (sample - state->smoothed) / policy.ewma_window;
+    } else {
+        state->smoothed = sample;
+    }
+    state->has_smoothed = true;
+    VerifyOrReturnValue(state->has_reported, true);
+
+    float delta = fabsf(state->smoothed - state->reported);
+    if (policy.absolute_delta <= 0 && policy.relative_delta <= 0) {
+        return delta > 0;
+    }
+    return (policy.absolute_delta > 0 && delta >= policy.absolute_delta) ||
+           (policy.relative_delta > 0 && delta >= policy.relative_delta * fabsf(state->reported));
+}
+
+state_t *create(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, const report_policy_t &policy)
+{
+    state_t *state = (state_t *)esp_matter_mem_calloc(1, sizeof(state_t));
+    VerifyOrReturnValue(state, nullptr, ESP_LOGE(TAG, "Couldn't allocate the report policy"));
+    state->policy = policy;
+    state->endpoint_id = endpoint_id;
+    state->cluster_id = cluster_id;
+    state->attribute_id = attribute_id;
+    return state;
+}
+
+void destroy(state_t *state)
+{
+    VerifyOrReturn(state);
+    if (state->pending && esp_matter::is_started()) {
+        chip::DeviceLayer::SystemLayer().CancelTimer(pending_report_timer_callback, state);
+    }
+    esp_matter_mem_free(state);
+}
+
+bool should_report(state_t *state, const esp_matter_attr_val_t &val)
+{
+    VerifyOrReturnValue(state, true);
+    VerifyOrReturnValue(is_significant(state, val), false);
+    // The pending report will carry this value too
+    VerifyOrReturnValue(!state->pending, false);
+
+    chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    chip::System::Clock::Timestamp min_interval = chip::System::Clock::Milliseconds32(state->policy.min_interval_ms);
+    if (state->has_report_time && now < state->last_report_time + min_interval) {
+        auto remaining = std::chrono::duration_cast<chip::System::Clock::Timeout>(state->last_report_time + min_interval -
+                                                                                 now);
+        CHIP_ERROR err = chip::DeviceLayer::SystemLayer().StartTimer(remaining, pending_report_timer_callback, state);
+        if (err == CHIP_NO_ERROR) {
+            state->pending = true;
+            return false;
+        }
+        // Better early than never
+        ESP_LOGE(TAG, "Failed to start the report timer, reporting now");
+    }
+    mark_reported(state, now);
+    return true;
+}
+
+} // namespace report_policy
+} // namespace attribute
+} // namespace esp_matter
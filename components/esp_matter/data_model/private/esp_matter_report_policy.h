@@ -0,0 +1,62 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_matter_attribute_utils.h>
+#include <esp_matter_data_model.h>
+
+namespace esp_matter {
+namespace attribute {
+namespace report_policy {
+
+/** Reporting state of an attribute with a report policy */
+struct state_t;
+
+/**
+ * @brief Allocates the reporting state of an attribute. The first change after this call is always reported.
+ *
+ * @param endpoint_id  Endpoint Id of the attribute
+ * @param cluster_id   Cluster Id of the attribute
+ * @param attribute_id Attribute Id of the attribute
+ * @param policy       Report policy
+ *
+ * @return The state, or NULL if there is not enough memory
+ */
+state_t *create(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id, const report_policy_t &policy);
+
+/**
+ * @brief Cancels the pending report, if any, and frees the state. It must be called with the Matter stack lock held.
+ *
+ * @param state State returned by create(), can be NULL
+ */
+void destroy(state_t *state);
+
+/**
+ * @brief Decides whether the new value of the attribute is reported now. It must be called with the Matter stack
+ *        lock held, after the value is stored.
+ *
+ * A change that passes the thresholds within the minimum interval of the previous report is not reported now, a
+ * timer reports the latest value when the interval expires.
+ *
+ * @param state State returned by create()
+ * @param val   New value of the attribute
+ *
+ * @return true if the change has to be reported now
+ */
+bool should_report(state_t *state, const esp_matter_attr_val_t &val);
+
+} // namespace report_policy
+} // namespace attribute
+} // namespace esp_matter
@@ -13,7 +13,7 @@
 // limitations under the License.
 
 #pragma once
-#include <esp_matter_mem.h>
+#include <esp_matter_arena.h>
 #include <type_traits>
 
 namespace esp_matter {
@@ -83,7 +83,7 @@ void SinglyLinkedList<T>::remove(T **head, T *target)
     }
     if (*p != nullptr) {
         *p = target->next;
-        free(target);
+        arena::free(target, sizeof(T));
     }
 }
 
@@ -93,7 +93,7 @@ void SinglyLinkedList<T>::delete_list(T **head)
     T *current = *head;
     while (current) {
         T *next = current->next;
-        free(current);
+        arena::free(current, sizeof(T));
         current = next;
     }
     *head = nullptr;
@@ -0,0 +1,151 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <esp_err.h>
+#include <esp_matter_mem.h>
+#include <type_traits>
+
+namespace esp_matter {
+
+/**
+ * @brief Secondary lookup index for the data model lists.
+ *
+ * Keeps (key, pointer) pairs sorted by key in a contiguous array so that a lookup is a binary search instead of a
+ * linked list walk. The index does not own the pointed-to nodes, the linked lists stay the owners and keep the
+ * creation order used for iteration.
+ *
+ * The struct is zero-initialized friendly, so it can be embedded in the data model structures allocated with
+ * esp_matter_mem_calloc(). Call clear() before freeing the structure which embeds it.
+ */
+template <typename K, typename T>
+struct SortedIndex {
+    static_assert(std::is_integral<K>::value, "K must be an integral type");
+
+    struct entry_t {
+        K key;
+        T *value;
+    };
+
+    entry_t *entries;
+    uint16_t count;
+    uint16_t capacity;
+
+    /**
+     * @brief Inserts a (key, value) pair. If the key already exists its value is replaced.
+     *
+     * @return ESP_OK on success, ESP_ERR_NO_MEM if the index could not be grown.
+     */
+    esp_err_t insert(K key, T *value);
+
+    /**
+     * @brief Removes the entry with the given key, if present.
+     */
+    void remove(K key);
+
+    /**
+     * @brief Finds the value for the given key.
+     *
+     * @return Pointer to the value, or nullptr if the key is not present.
+     */
+    T *find(K key) const;
+
+    /**
+     * @brief Releases the index storage.
+     */
+    void clear();
+
+private:
+    // Entries are added in small chunks as most clusters only have a handful of attributes.
+    static constexpr uint16_t k_grow_step = 4;
+
+    // Returns the position of the first entry whose key is not less than the given key.
+    uint16_t lower_bound(K key) const;
+};
+
+template <typename K, typename T>
+uint16_t SortedIndex<K, T>::lower_bound(K key) const
+{
+    uint16_t low = 0;
+    uint16_t high = count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (entries[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+template <typename K, typename T>
+esp_err_t SortedIndex<K, T>::insert(K key, T *value)
+{
+    uint16_t pos = lower_bound(key);
+    if (pos < count && entries[pos].key == key) {
+        entries[pos].value = value;
+        return ESP_OK;
+    }
+    if (count == UINT16_MAX) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (count == capacity) {
+        uint16_t new_capacity = (capacity > UINT16_MAX - k_grow_step) ? UINT16_MAX : capacity + k_grow_step;
+        entry_t *new_entries = (entry_t *)esp_matter_mem_realloc(entries, new_capacity * sizeof(entry_t));
+        if (!new_entries) {
+            return ESP_ERR_NO_MEM;
+        }
+        entries = new_entries;
+        capacity = new_capacity;
+    }
+    memmove(&entries[pos + 1], &entries[pos], (count - pos) * sizeof(entry_t));
+    entries[pos].key = key;
+    entries[pos].value = value;
+    count++;
+    return ESP_OK;
+}
+
+template <typename K, typename T>
+void SortedIndex<K, T>::remove(K key)
+{
+    uint16_t pos = lower_bound(key);
+    if (pos < count && entries[pos].key == key) {
+        memmove(&entries[pos], &entries[pos + 1], (count - pos - 1) * sizeof(entry_t));
+        count--;
+    }
+}
+
+template <typename K, typename T>
+T *SortedIndex<K, T>::find(K key) const
+{
+    uint16_t pos = lower_bound(key);
+    if (pos < count && entries[pos].key == key) {
+        return entries[pos].value;
+    }
+    return nullptr;
+}
+
+template <typename K, typename T>
+void SortedIndex<K, T>::clear()
+{
+    esp_matter_mem_free(entries);
+    entries = nullptr;
+    count = 0;
+    capacity = 0;
+}
+
+} // namespace esp_matter
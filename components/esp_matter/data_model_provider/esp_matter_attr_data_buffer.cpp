@@ -16,11 +16,34 @@
 #include <esp_matter_attribute_utils.h>
 #include <esp_matter_mem.h>
 
+#include <lib/core/CHIPEncoding.h>
 #include <lib/support/CodeUtils.h>
 
 namespace esp_matter {
 namespace data_model {
 
+void attribute_data_decode_buffer::set_ember_view(uint16_t prefix, uint32_t prefix_size, uint32_t len)
+{
+    if (prefix_size == sizeof(uint8_t)) {
+        m_scratch[0] = (uint8_t)prefix;
+    } else {
+        chip::Encoding::LittleEndian::Put16(m_scratch.data(), prefix);
+    }
+    m_ember_view = m_scratch.SubSpan(0, prefix_size + len);
+}
+
+uint8_t *attribute_data_decode_buffer::get_string_buffer(uint32_t len, uint32_t prefix_size, uint32_t null_reserve)
+{
+    if (m_scratch.size() < prefix_size + len + null_reserve) {
+        // The allocated buffer will be freed in destructor
+        uint8_t *buf = (uint8_t *)esp_matter_mem_calloc(len + null_reserve, sizeof(uint8_t));
+        m_allocated = buf != nullptr;
+        return buf;
+    }
+    set_ember_view((uint16_t)len, prefix_size, len);
+    return m_scratch.data() + prefix_size;
+}
+
 CHIP_ERROR attribute_data_decode_buffer::Decode(chip::TLV::TLVReader &reader)
 {
     switch (m_attr_val.get_storage_type()) {
@@ -96,46 +119,52 @@ CHIP_ERROR attribute_data_decode_buffer::Decode(chip::TLV::TLVReader &reader)
         break;
     case ESP_MATTER_VAL_TYPE_CHAR_STRING:
     case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING: {
+        uint32_t prefix_size = (m_attr_val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ? 1 : 2);
         if (reader.GetType() == chip::TLV::kTLVType_Null) {
             m_attr_val.val.a.b = nullptr;
             m_attr_val.val.a.s = (m_attr_val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ? 0xFF : 0xFFFF);
             m_attr_val.val.a.t = m_attr_val.val.a.s;
+            if (m_scratch.size() >= prefix_size) {
+                set_ember_view(m_attr_val.val.a.s, prefix_size, 0);
+            }
             break;
         }
         uint32_t len = reader.GetLength();
         if (len > 0xFF && m_attr_val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING) {
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
-        // The allocated buffer will be freed in destructor
-        m_attr_val.val.a.b = (uint8_t *)esp_matter_mem_calloc(len + 1, sizeof(char));
+        m_attr_val.val.a.b = get_string_buffer(len, prefix_size, 1);
         if (!m_attr_val.val.a.b) {
             return CHIP_ERROR_NO_MEMORY;
         }
         ReturnErrorOnFailure(reader.GetString((char *)m_attr_val.val.a.b, len + 1));
         m_attr_val.val.a.s = len;
-        m_attr_val.val.a.t = len + (m_attr_val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ? 1 : 2);
+        m_attr_val.val.a.t = len + prefix_size;
         break;
     }
     case ESP_MATTER_VAL_TYPE_OCTET_STRING:
     case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING: {
+        uint32_t prefix_size = (m_attr_val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ? 1 : 2);
         if (reader.GetType() == chip::TLV::kTLVType_Null) {
             m_attr_val.val.a.b = nullptr;
             m_attr_val.val.a.s = (m_attr_val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ? 0xFF : 0xFFFF);
             m_attr_val.val.a.t = m_attr_val.val.a.s;
+            if (m_scratch.size() >= prefix_size) {
+                set_ember_view(m_attr_val.val.a.s, prefix_size, 0);
+            }
             break;
         }
         uint32_t len = reader.GetLength();
         if (len > 0xFF && m_attr_val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING) {
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
-        // The allocated buffer will be freed in destructor
-        m_attr_val.val.a.b = (uint8_t *)esp_matter_mem_calloc(len, sizeof(uint8_t));
+        m_attr_val.val.a.b = get_string_buffer(len, prefix_size, 0);
         if (!m_attr_val.val.a.b) {
             return CHIP_ERROR_NO_MEMORY;
         }
         ReturnErrorOnFailure(reader.GetBytes(m_attr_val.val.a.b, len));
         m_attr_val.val.a.s = len;
-        m_attr_val.val.a.t = len + (m_attr_val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ? 1 : 2);
+        m_attr_val.val.a.t = len + prefix_size;
         break;
     }
     default:
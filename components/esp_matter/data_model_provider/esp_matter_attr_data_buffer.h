@@ -46,15 +46,21 @@ public:
         m_attr_val.val = esp_matter_val(nullptr);
     }
 
+    /** Decode the strings into `scratch` when they fit, with no allocation
+     *
+     * The string is stored after a length prefix, in the ember format: `get_ember_view()` returns the prefixed value
+     * and `get_attr_val()` points after the prefix. The scratch must outlive the decoded value.
+     */
+    attribute_data_decode_buffer(esp_matter_val_type_t attr_val_type, chip::MutableByteSpan scratch)
+        : attribute_data_decode_buffer(attr_val_type)
+    {
+        m_scratch = scratch;
+    }
+
     ~attribute_data_decode_buffer()
     {
-        if (m_attr_val.type == ESP_MATTER_VAL_TYPE_OCTET_STRING ||
-                m_attr_val.type == ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING ||
-                m_attr_val.type == ESP_MATTER_VAL_TYPE_CHAR_STRING ||
-                m_attr_val.type == ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING) {
-            if (m_attr_val.val.a.b) {
-                esp_matter_mem_free(m_attr_val.val.a.b);
-            }
+        if (m_allocated) {
+            esp_matter_mem_free(m_attr_val.val.a.b);
         }
     }
 
@@ -63,10 +69,25 @@ public:
         return m_attr_val;
     }
 
+    /** Get the decoded string in the ember format, length prefix included
+     *
+     * @return an empty span if the value is not a string or was not decoded into the scratch buffer.
+     */
+    chip::MutableByteSpan get_ember_view() const
+    {
+        return m_ember_view;
+    }
+
     CHIP_ERROR Decode(chip::TLV::TLVReader &reader);
 
 private:
+    uint8_t *get_string_buffer(uint32_t len, uint32_t prefix_size, uint32_t null_reserve);
+    void set_ember_view(uint16_t prefix, uint32_t prefix_size, uint32_t len);
+
     esp_matter_attr_val_t m_attr_val;
+    chip::MutableByteSpan m_scratch;
+    chip::MutableByteSpan m_ember_view;
+    bool m_allocated = false;
 };
 } // namespace data_model
 } // namespace esp_matter
@@ -18,10 +18,13 @@
 #include <esp_matter_data_model_utils.h>
 #endif // CONFIG_ESP_MATTER_ENABLE_GENERATED_DATA_MODEL
 #include <esp_matter_cluster.h>
+#include <esp_matter_cluster_metadata.h>
 #include <esp_matter_data_model.h>
 #include <esp_matter_data_model_priv.h>
 #include <esp_matter_data_model_provider.h>
 #include <esp_matter_attr_data_buffer.h>
+#include <esp_matter_latency.h>
+#include <esp_matter_mem.h>
 
 #include <access/Privilege.h>
 #include <app-common/zap-generated/cluster-objects.h>
@@ -43,7 +46,9 @@
 #include <app/persistence/AttributePersistenceProviderInstance.h>
 #include <app/persistence/DefaultAttributePersistenceProvider.h>
 #include <cstring>
+#include <new>
 
+#include "esp_matter_access_privilege_table.h"
 #include "esp_matter_attr_val_ember_buffer.h"
 
 using namespace chip;
@@ -77,28 +82,37 @@ private:
 
 namespace {
 
+// The value is passed in the ember format: `ember_view` if the decoder already built it, a temporary buffer otherwise
 Status ClusterPreAttributeChanged(const chip::app::ConcreteAttributePath  &attributePath, esp_matter::cluster_t *cluster,
-                                  const esp_matter_attr_val_t &val)
+                                  const esp_matter_attr_val_t &val, chip::MutableByteSpan ember_view)
 {
+    esp_matter::cluster::function_pre_attribute_change_t f =
+        (esp_matter::cluster::function_pre_attribute_change_t)esp_matter::cluster::get_function(
+            cluster, esp_matter::CLUSTER_FLAG_PRE_ATTRIBUTE_CHANGED_FUNCTION);
+    if (f == nullptr) {
+        return Status::Success;
+    }
     uint8_t attributeType = get_ember_attr_type_from_val_type(val.type);
+    if (!ember_view.empty()) {
+        return f(attributePath, attributeType, ember_view.size(), ember_view.data());
+    }
     uint16_t valueSize = get_ember_attr_size_from_val(val);
+    // The numeric values fit on the stack, only the strings decoded on the heap need a buffer
+    uint8_t numericBuffer[sizeof(esp_matter_val_t)] = { 0 };
     Platform::ScopedMemoryBuffer<uint8_t> emberBuffer;
-    emberBuffer.Calloc(valueSize);
-    if (!emberBuffer.Get()) {
-        return Status::ResourceExhausted;
+    uint8_t *emberData = numericBuffer;
+    if (valueSize > sizeof(numericBuffer)) {
+        emberBuffer.Calloc(valueSize);
+        if (!emberBuffer.Get()) {
+            return Status::ResourceExhausted;
+        }
+        emberData = emberBuffer.Get();
     }
-    Status status = build_ember_buffer_from_attr_val(val, emberBuffer.Get(), valueSize);
+    Status status = build_ember_buffer_from_attr_val(val, emberData, valueSize);
     if (status != Status::Success) {
         return status;
     }
-    esp_matter::cluster::function_pre_attribute_change_t f =
-        (esp_matter::cluster::function_pre_attribute_change_t)esp_matter::cluster::get_function(
-            cluster, esp_matter::CLUSTER_FLAG_PRE_ATTRIBUTE_CHANGED_FUNCTION);
-
-    if (f != nullptr) {
-        status = f(attributePath, attributeType, valueSize, emberBuffer.Get());
-    }
-    return status;
+    return f(attributePath, attributeType, valueSize, emberData);
 }
 
 /// Attempts to read via an attribute access interface (AAI)
@@ -166,6 +180,8 @@ constexpr chip::Access::Privilege kPrivilege[] = GENERATED_ACCESS_READ_ATTRIBUTE
 static_assert(MATTER_ARRAY_SIZE(kCluster) == MATTER_ARRAY_SIZE(kAttribute) &&
               MATTER_ARRAY_SIZE(kAttribute) == MATTER_ARRAY_SIZE(kPrivilege),
               "Generated parallel arrays must be same size");
+constexpr esp_matter::data_model::AccessPrivilegeTable<MATTER_ARRAY_SIZE(kCluster)> kTable(
+    kCluster, kAttribute, kPrivilege);
 } // namespace GeneratedAccessReadAttribute
 #endif
 
@@ -177,6 +193,8 @@ constexpr chip::Access::Privilege kPrivilege[] = GENERATED_ACCESS_WRITE_ATTRIBUT
 static_assert(MATTER_ARRAY_SIZE(kCluster) == MATTER_ARRAY_SIZE(kAttribute) &&
               MATTER_ARRAY_SIZE(kAttribute) == MATTER_ARRAY_SIZE(kPrivilege),
               "Generated parallel arrays must be same size");
+constexpr esp_matter::data_model::AccessPrivilegeTable<MATTER_ARRAY_SIZE(kCluster)> kTable(
+    kCluster, kAttribute, kPrivilege);
 } // namespace GeneratedAccessWriteAttribute
 #endif
 
@@ -188,6 +206,8 @@ constexpr chip::Access::Privilege kPrivilege[] = GENERATED_ACCESS_INVOKE_COMMAND
 static_assert(MATTER_ARRAY_SIZE(kCluster) == MATTER_ARRAY_SIZE(kCommand) &&
               MATTER_ARRAY_SIZE(kCommand) == MATTER_ARRAY_SIZE(kPrivilege),
               "Generated parallel arrays must be same size");
+constexpr esp_matter::data_model::AccessPrivilegeTable<MATTER_ARRAY_SIZE(kCluster)> kTable(
+    kCluster, kCommand, kPrivilege);
 } // namespace GeneratedAccessInvokeCommand
 #endif
 
@@ -199,6 +219,8 @@ constexpr chip::Access::Privilege kPrivilege[] = GENERATED_ACCESS_READ_EVENT__PR
 static_assert(MATTER_ARRAY_SIZE(kCluster) == MATTER_ARRAY_SIZE(kEvent) &&
               MATTER_ARRAY_SIZE(kEvent) == MATTER_ARRAY_SIZE(kPrivilege),
               "Generated parallel arrays must be same size");
+constexpr esp_matter::data_model::AccessPrivilegeTable<MATTER_ARRAY_SIZE(kCluster)> kTable(
+    kCluster, kEvent, kPrivilege);
 } // namespace GeneratedAccessReadEvent
 #endif
 
@@ -206,76 +228,40 @@ chip::Access::Privilege MatterGetAccessPrivilegeForReadAttribute(ClusterId clust
 {
 #ifdef GENERATED_ACCESS_READ_ATTRIBUTE__CLUSTER
     using namespace GeneratedAccessReadAttribute;
-    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kCluster); ++i) {
-        if (kCluster[i] == cluster && kAttribute[i] == attribute) {
-            return kPrivilege[i];
-        }
-    }
-#endif
+    return kTable.find(cluster, attribute, chip::Access::Privilege::kView);
+#else
     return chip::Access::Privilege::kView;
+#endif
 }
 
 chip::Access::Privilege MatterGetAccessPrivilegeForWriteAttribute(ClusterId cluster, AttributeId attribute)
 {
 #ifdef GENERATED_ACCESS_WRITE_ATTRIBUTE__CLUSTER
     using namespace GeneratedAccessWriteAttribute;
-    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kCluster); ++i) {
-        if (kCluster[i] == cluster && kAttribute[i] == attribute) {
-            return kPrivilege[i];
-        }
-    }
-#endif
+    return kTable.find(cluster, attribute, chip::Access::Privilege::kOperate);
+#else
     return chip::Access::Privilege::kOperate;
+#endif
 }
 
 chip::Access::Privilege MatterGetAccessPrivilegeForInvokeCommand(ClusterId cluster, CommandId command)
 {
 #ifdef GENERATED_ACCESS_INVOKE_COMMAND__CLUSTER
     using namespace GeneratedAccessInvokeCommand;
-    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kCluster); ++i) {
-        if (kCluster[i] == cluster && kCommand[i] == command) {
-            return kPrivilege[i];
-        }
-    }
-#endif
+    return kTable.find(cluster, command, chip::Access::Privilege::kOperate);
+#else
     return chip::Access::Privilege::kOperate;
+#endif
 }
 
 chip::Access::Privilege MatterGetAccessPrivilegeForReadEvent(ClusterId cluster, EventId event)
 {
 #ifdef GENERATED_ACCESS_READ_EVENT__CLUSTER
     using namespace GeneratedAccessReadEvent;
-    for (size_t i = 0; i < MATTER_ARRAY_SIZE(kCluster); ++i) {
-        if (kCluster[i] == cluster && kEvent[i] == event) {
-            return kPrivilege[i];
-        }
-    }
-#endif
+    return kTable.find(cluster, event, chip::Access::Privilege::kView);
+#else
     return chip::Access::Privilege::kView;
-}
-
-size_t get_command_count(esp_matter::cluster_t *cluster, uint8_t flag)
-{
-    size_t ret = 0;
-    esp_matter::command_t *command = esp_matter::command::get_first(cluster);
-    while (command) {
-        if (esp_matter::command::get_flags(command) & flag) {
-            ret++;
-        }
-        command = esp_matter::command::get_next(command);
-    }
-    return ret;
-}
-
-size_t get_attribute_count(esp_matter::cluster_t *cluster)
-{
-    size_t ret = 0;
-    esp_matter::attribute_t *attribute = esp_matter::attribute::get_first(cluster);
-    while (attribute) {
-        ret++;
-        attribute = esp_matter::attribute::get_next(attribute);
-    }
-    return ret;
+#endif
 }
 
 DefaultAttributePersistenceProvider gDefaultAttributePersistence;
@@ -321,6 +307,7 @@ CHIP_ERROR provider::Shutdown()
 
 ActionReturnStatus provider::ReadAttribute(const ReadAttributeRequest &request, AttributeValueEncoder &encoder)
 {
+    latency::scoped_timer timer(latency::OPERATION_READ_ATTRIBUTE, request.path.mEndpointId, request.path.mClusterId);
     if (auto *cluster = mRegistry.Get(request.path); cluster != nullptr) {
         return cluster->ReadAttribute(request, encoder);
     }
@@ -344,6 +331,7 @@ ActionReturnStatus provider::ReadAttribute(const ReadAttributeRequest &request,
 
 ActionReturnStatus provider::WriteAttribute(const WriteAttributeRequest &request, AttributeValueDecoder &decoder)
 {
+    latency::scoped_timer timer(latency::OPERATION_WRITE_ATTRIBUTE, request.path.mEndpointId, request.path.mClusterId);
     attribute_t *attribute =
         attribute::get(request.path.mEndpointId, request.path.mClusterId, request.path.mAttributeId);
 
@@ -358,7 +346,9 @@ ActionReturnStatus provider::WriteAttribute(const WriteAttributeRequest &request
     TLV::TLVReader reader_copy;
     reader_copy.Init(accessor.GetReader());
     AttributeValueDecoder decoder_copy(reader_copy, decoder.GetSubjectDescriptor());
-    attribute_data_decode_buffer data_buffer(current_val_type);
+    // The strings which fit are decoded on the stack, in the ember format expected by the pre-change function
+    uint8_t scratch[CONFIG_ESP_MATTER_ATTRIBUTE_BUFFER_LARGEST];
+    attribute_data_decode_buffer data_buffer(current_val_type, chip::MutableByteSpan(scratch));
     if (decoder_copy.Decode(data_buffer) == CHIP_NO_ERROR) {
         new_val = data_buffer.get_attr_val();
         // PRE_UPDATE callback
@@ -414,7 +404,7 @@ ActionReturnStatus provider::WriteAttribute(const WriteAttributeRequest &request
         return Protocols::InteractionModel::Status::Failure;
     }
     // Use set_val_internal with call_callbacks=false since we already called PRE_UPDATE
-    status = ClusterPreAttributeChanged(request.path, cluster, new_val);
+    status = ClusterPreAttributeChanged(request.path, cluster, new_val, data_buffer.get_ember_view());
     if (status != Status::Success) {
         return status;
     }
@@ -462,6 +452,7 @@ std::optional<ActionReturnStatus> provider::InvokeCommand(const InvokeRequest &r
                                                           chip::TLV::TLVReader &input_arguments,
                                                           CommandHandler *handler)
 {
+    latency::scoped_timer timer(latency::OPERATION_INVOKE_COMMAND, request.path.mEndpointId, request.path.mClusterId);
     if (auto *cluster = mRegistry.Get(request.path); cluster != nullptr) {
         return cluster->InvokeCommand(request, input_arguments, handler);
     }
@@ -587,6 +578,106 @@ CHIP_ERROR provider::EventInfo(const ConcreteEventPath &path, EventEntry &eventI
     return CHIP_NO_ERROR;
 }
 
+static constexpr AttributeId k_global_attributes_not_in_metadata[] = {
+    Clusters::Globals::Attributes::AttributeList::Id, Clusters::Globals::Attributes::AcceptedCommandList::Id,
+    Clusters::Globals::Attributes::GeneratedCommandList::Id
+};
+
+static constexpr size_t k_global_attributes_count =
+    sizeof(k_global_attributes_not_in_metadata) / sizeof(k_global_attributes_not_in_metadata[0]);
+
+// The entries are placed right after the metadata_cache_t header, keep each array aligned for the next one.
+static_assert(sizeof(cluster::metadata_cache_t) % alignof(AttributeEntry) == 0, "AttributeEntry misaligned");
+static_assert(sizeof(AttributeEntry) % alignof(AcceptedCommandEntry) == 0, "AcceptedCommandEntry misaligned");
+static_assert(sizeof(AcceptedCommandEntry) % alignof(CommandId) == 0, "CommandId misaligned");
+
+static AttributeEntry make_attribute_entry(ClusterId cluster_id, attribute_t *attribute)
+{
+    uint32_t id = attribute::get_id(attribute);
+    uint16_t flags = attribute::get_flags(attribute);
+    chip::BitFlags<DataModel::AttributeQualityFlags> attr_quality_flags;
+    // TODO Array
+    attr_quality_flags.Set(DataModel::AttributeQualityFlags::kTimed, flags & ATTRIBUTE_FLAG_MUST_USE_TIMED_WRITE);
+    chip::Access::Privilege read_privilege = MatterGetAccessPrivilegeForReadAttribute(cluster_id, id);
+    auto write_privilege = (flags & ATTRIBUTE_FLAG_WRITABLE)
+                           ? std::make_optional(MatterGetAccessPrivilegeForWriteAttribute(cluster_id, id))
+                           : std::nullopt;
+    return AttributeEntry(id, attr_quality_flags, read_privilege, write_privilege);
+}
+
+static AcceptedCommandEntry make_accepted_command_entry(ClusterId cluster_id, CommandId command_id)
+{
+    BitMask<DataModel::CommandQualityFlags> quality_flags;
+    quality_flags
+    .Set(DataModel::CommandQualityFlags::kFabricScoped, CommandIsFabricScoped(cluster_id, command_id))
+    .Set(DataModel::CommandQualityFlags::kTimed, CommandNeedsTimedInvoke(cluster_id, command_id))
+    .Set(DataModel::CommandQualityFlags::kLargeMessage, CommandHasLargePayload(cluster_id, command_id));
+    return AcceptedCommandEntry(command_id, quality_flags,
+                                MatterGetAccessPrivilegeForInvokeCommand(cluster_id, command_id));
+}
+
+/* Builds the metadata snapshot of the cluster on its first query. The quality flags and privileges are looked up once
+ * here, the provider calls then only copy the prebuilt entries until an attribute or a command of the cluster changes. */
+static cluster::metadata_cache_t *get_or_build_metadata_cache(cluster_t *cluster, ClusterId cluster_id)
+{
+    cluster::metadata_cache_t *cache = cluster::get_metadata_cache(cluster);
+    VerifyOrReturnValue(cache == nullptr, cache);
+
+    // There are three attributes(Attributes, AcceptedCommands, and GeneratedCommands) which are not
+    // in esp_matter data model metadata;
+    size_t attribute_count = k_global_attributes_count;
+    for (attribute_t *attribute = attribute::get_first(cluster); attribute; attribute = attribute::get_next(attribute)) {
+        attribute_count++;
+    }
+    size_t accepted_count = 0;
+    size_t generated_count = 0;
+    for (command_t *command = command::get_first(cluster); command; command = command::get_next(command)) {
+        uint16_t flags = command::get_flags(command);
+        accepted_count += (flags & COMMAND_FLAG_ACCEPTED) ? 1 : 0;
+        generated_count += (flags & COMMAND_FLAG_GENERATED) ? 1 : 0;
+    }
+
+    size_t size = sizeof(cluster::metadata_cache_t) + attribute_count * sizeof(AttributeEntry) +
+                  accepted_count * sizeof(AcceptedCommandEntry) + generated_count * sizeof(CommandId);
+    cache = (cluster::metadata_cache_t *)esp_matter_mem_calloc(1, size);
+    VerifyOrReturnValue(cache, nullptr, ESP_LOGE(TAG, "Couldn't allocate the metadata of cluster 0x%08" PRIX32,
+                                                 cluster_id));
+    AttributeEntry *attributes = reinterpret_cast<AttributeEntry *>(cache + 1);
+    AcceptedCommandEntry *accepted_commands = reinterpret_cast<AcceptedCommandEntry *>(attributes + attribute_count);
+    CommandId *generated_commands = reinterpret_cast<CommandId *>(accepted_commands + accepted_count);
+
+    size_t index = 0;
+    for (attribute_t *attribute = attribute::get_first(cluster); attribute; attribute = attribute::get_next(attribute)) {
+        new (&attributes[index++]) AttributeEntry(make_attribute_entry(cluster_id, attribute));
+    }
+    // Append the three Global attributes
+    for (size_t global_index = 0; global_index < k_global_attributes_count; ++global_index) {
+        new (&attributes[index++]) AttributeEntry(k_global_attributes_not_in_metadata[global_index],
+                                                  chip::BitFlags<DataModel::AttributeQualityFlags>(),
+                                                  chip::Access::Privilege::kView, std::nullopt);
+    }
+
+    size_t accepted_index = 0;
+    size_t generated_index = 0;
+    for (command_t *command = command::get_first(cluster); command; command = command::get_next(command)) {
+        uint16_t flags = command::get_flags(command);
+        CommandId command_id = command::get_id(command);
+        if (flags & COMMAND_FLAG_ACCEPTED) {
+            new (&accepted_commands[accepted_index++]) AcceptedCommandEntry(
+                make_accepted_command_entry(cluster_id, command_id));
+        }
+        if (flags & COMMAND_FLAG_GENERATED) {
+            generated_commands[generated_index++] = command_id;
+        }
+    }
+
+    cache->attributes = Span<const AttributeEntry>(attributes, attribute_count);
+    cache->accepted_commands = Span<const AcceptedCommandEntry>(accepted_commands, accepted_count);
+    cache->generated_commands = Span<const CommandId>(generated_commands, generated_count);
+    cluster::set_metadata_cache(cluster, cache);
+    return cache;
+}
+
 CHIP_ERROR provider::GeneratedCommands(const ConcreteClusterPath &path, ReadOnlyBufferBuilder<CommandId> &builder)
 {
     if (auto *cluster = mRegistry.Get(path); cluster != nullptr) {
@@ -596,16 +687,9 @@ CHIP_ERROR provider::GeneratedCommands(const ConcreteClusterPath &path, ReadOnly
     VerifyOrReturnValue(status == Protocols::InteractionModel::Status::Success,
                         CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(status));
     cluster_t *cluster = cluster::get(path.mEndpointId, path.mClusterId);
-    size_t count = get_command_count(cluster, COMMAND_FLAG_GENERATED);
-    ReturnErrorOnFailure(builder.EnsureAppendCapacity(count));
-    command_t *command = command::get_first(cluster);
-    while (command) {
-        if (command::get_flags(command) & COMMAND_FLAG_GENERATED) {
-            ReturnErrorOnFailure(builder.Append(command::get_id(command)));
-        }
-        command = command::get_next(command);
-    }
-    return CHIP_NO_ERROR;
+    cluster::metadata_cache_t *cache = get_or_build_metadata_cache(cluster, path.mClusterId);
+    VerifyOrReturnError(cache, CHIP_ERROR_NO_MEMORY);
+    return builder.AppendElements(cache->generated_commands);
 }
 
 CHIP_ERROR provider::AcceptedCommands(const ConcreteClusterPath &path,
@@ -627,35 +711,11 @@ CHIP_ERROR provider::AcceptedCommands(const ConcreteClusterPath &path,
     }
     // If we cannot get AcceptedCommands array from CommandHandlerinterface, get it from esp_matter data model.
     cluster_t *cluster = cluster::get(path.mEndpointId, path.mClusterId);
-    size_t count = get_command_count(cluster, COMMAND_FLAG_ACCEPTED);
-    ReturnErrorOnFailure(builder.EnsureAppendCapacity(count));
-    command_t *command = command::get_first(cluster);
-    while (command) {
-        if (command::get_flags(command) & COMMAND_FLAG_ACCEPTED) {
-            uint32_t command_id = command::get_id(command);
-            BitMask<DataModel::CommandQualityFlags> quality_flags;
-            quality_flags
-            .Set(DataModel::CommandQualityFlags::kFabricScoped, CommandIsFabricScoped(path.mClusterId, command_id))
-            .Set(DataModel::CommandQualityFlags::kTimed, CommandNeedsTimedInvoke(path.mClusterId, command_id))
-            .Set(DataModel::CommandQualityFlags::kLargeMessage,
-                 CommandHasLargePayload(path.mClusterId, command_id));
-            AcceptedCommandEntry entry(command_id, quality_flags,
-                                       MatterGetAccessPrivilegeForInvokeCommand(path.mClusterId, command_id));
-            ReturnErrorOnFailure(builder.Append(entry));
-        }
-        command = command::get_next(command);
-    }
-    return CHIP_NO_ERROR;
+    cluster::metadata_cache_t *cache = get_or_build_metadata_cache(cluster, path.mClusterId);
+    VerifyOrReturnError(cache, CHIP_ERROR_NO_MEMORY);
+    return builder.AppendElements(cache->accepted_commands);
 }
 
-static constexpr AttributeId k_global_attributes_not_in_metadata[] = {
-    Clusters::Globals::Attributes::AttributeList::Id, Clusters::Globals::Attributes::AcceptedCommandList::Id,
-    Clusters::Globals::Attributes::GeneratedCommandList::Id
-};
-
-static constexpr size_t k_global_attributes_count =
-    sizeof(k_global_attributes_not_in_metadata) / sizeof(k_global_attributes_not_in_metadata[0]);
-
 CHIP_ERROR provider::Attributes(const ConcreteClusterPath &path, ReadOnlyBufferBuilder<AttributeEntry> &builder)
 {
     if (auto *cluster = mRegistry.Get(path); cluster != nullptr) {
@@ -665,34 +725,9 @@ CHIP_ERROR provider::Attributes(const ConcreteClusterPath &path, ReadOnlyBufferB
     VerifyOrReturnValue(status == Protocols::InteractionModel::Status::Success,
                         CHIP_ERROR_IM_GLOBAL_STATUS_VALUE(status));
     cluster_t *cluster = cluster::get(path.mEndpointId, path.mClusterId);
-    size_t count = get_attribute_count(cluster);
-    // There are three attributes(Attributes, AcceptedCommands, and GeneratedCommands) which are not
-    // in esp_matter data model metadata;
-    ReturnErrorOnFailure(builder.EnsureAppendCapacity(count + k_global_attributes_count));
-    attribute_t *attribute = attribute::get_first(cluster);
-    while (attribute) {
-        uint32_t id = attribute::get_id(attribute);
-        uint16_t flags = attribute::get_flags(attribute);
-        chip::BitFlags<DataModel::AttributeQualityFlags> attr_quality_flags;
-        // TODO Array
-        attr_quality_flags.Set(DataModel::AttributeQualityFlags::kTimed, flags & ATTRIBUTE_FLAG_MUST_USE_TIMED_WRITE);
-        chip::Access::Privilege read_privilege = MatterGetAccessPrivilegeForReadAttribute(path.mClusterId, id);
-        auto write_privilege = (flags & ATTRIBUTE_FLAG_WRITABLE)
-                               ? std::make_optional(MatterGetAccessPrivilegeForWriteAttribute(path.mClusterId, id))
-                               : std::nullopt;
-        AttributeEntry entry(id, attr_quality_flags, read_privilege, write_privilege);
-        ReturnErrorOnFailure(builder.Append(entry));
-        attribute = attribute::get_next(attribute);
-    }
-    // Append the three Global attributes
-    for (size_t index = 0; index < k_global_attributes_count; ++index) {
-        AttributeEntry entry(k_global_attributes_not_in_metadata[index],
-                             chip::BitFlags<DataModel::AttributeQualityFlags>(), chip::Access::Privilege::kView,
-                             std::nullopt);
-        ReturnErrorOnFailure(builder.Append(entry));
-    }
-
-    return CHIP_NO_ERROR;
+    cluster::metadata_cache_t *cache = get_or_build_metadata_cache(cluster, path.mClusterId);
+    VerifyOrReturnError(cache, CHIP_ERROR_NO_MEMORY);
+    return builder.AppendElements(cache->attributes);
 }
 
 void provider::Temporary_ReportAttributeChanged(const AttributePathParams &path)
@@ -707,6 +742,29 @@ void provider::Temporary_ReportAttributeChanged(const AttributePathParams &path)
     mContext->dataModelChangeListener.MarkDirty(path);
 }
 
+void provider::ReportAttributesChanged(const AttributeChange *changes, size_t count)
+{
+    VerifyOrReturn(changes != nullptr);
+    for (size_t index = 0; index < count; ++index) {
+        const ConcreteAttributePath &path = changes[index].path;
+        bool version_increased = false;
+        for (size_t previous = 0; previous < index && !version_increased; ++previous) {
+            version_increased = changes[previous].path.mEndpointId == path.mEndpointId &&
+                                changes[previous].path.mClusterId == path.mClusterId;
+        }
+        if (!version_increased) {
+            cluster_t *cluster = cluster::get(path.mEndpointId, path.mClusterId);
+            if (cluster) {
+                cluster::increase_data_version(cluster);
+            }
+        }
+        if (changes[index].report) {
+            mContext->dataModelChangeListener.MarkDirty(
+                AttributePathParams(path.mEndpointId, path.mClusterId, path.mAttributeId));
+        }
+    }
+}
+
 Status provider::CheckDataModelPath(EndpointId endpointId)
 {
     endpoint_t *endpoint = endpoint::get(endpointId);
@@ -101,6 +101,16 @@ public:
 
     void Temporary_ReportAttributeChanged(const AttributePathParams &path) override;
 
+    // An attribute changed by a batch, its report might be held back by the report policy of the attribute
+    struct AttributeChange {
+        ConcreteAttributePath path;
+        bool report;
+    };
+
+    // Increases the data version of each changed cluster once however many of its attributes changed, reported or
+    // not, and marks the reported attributes dirty.
+    void ReportAttributesChanged(const AttributeChange *changes, size_t count);
+
 private:
     Status CheckDataModelPath(EndpointId endpointId);
     Status CheckDataModelPath(const ConcreteClusterPath &path);
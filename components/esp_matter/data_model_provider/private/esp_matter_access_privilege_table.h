@@ -0,0 +1,87 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <access/Privilege.h>
+#include <lib/core/DataModelTypes.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esp_matter {
+namespace data_model {
+
+/**
+ * @brief Access privilege table sorted by (cluster id, element id).
+ *
+ * The generated access tables (GENERATED_ACCESS_*) are parallel arrays in no particular order. This table is built
+ * from them at compile time, sorted by the combined key, so that a lookup is a binary search over a table placed in
+ * flash instead of a linear scan.
+ */
+template <size_t N>
+struct AccessPrivilegeTable {
+    uint64_t keys[N];
+    chip::Access::Privilege privileges[N];
+
+    template <typename Id>
+    constexpr AccessPrivilegeTable(const chip::ClusterId (&clusters)[N], const Id (&ids)[N],
+                                   const chip::Access::Privilege (&entry_privileges)[N])
+        : keys()
+        , privileges()
+    {
+        // Insertion sort, the generated tables are mostly ordered by cluster already
+        for (size_t index = 0; index < N; ++index) {
+            uint64_t key = make_key(clusters[index], ids[index]);
+            size_t pos = index;
+            while (pos > 0 && keys[pos - 1] > key) {
+                keys[pos] = keys[pos - 1];
+                privileges[pos] = privileges[pos - 1];
+                --pos;
+            }
+            keys[pos] = key;
+            privileges[pos] = entry_privileges[index];
+        }
+    }
+
+    /**
+     * @brief Finds the privilege of the element.
+     *
+     * @return The privilege in the table, or default_privilege if the element is not in the table.
+     */
+    constexpr chip::Access::Privilege find(chip::ClusterId cluster, uint32_t id,
+                                           chip::Access::Privilege default_privilege) const
+    {
+        uint64_t key = make_key(cluster, id);
+        size_t low = 0;
+        size_t high = N;
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (keys[mid] < key) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return (low < N && keys[low] == key) ? privileges[low] : default_privilege;
+    }
+
+    static constexpr uint64_t make_key(chip::ClusterId cluster, uint32_t id)
+    {
+        return (static_cast<uint64_t>(cluster) << 32) | id;
+    }
+};
+
+} // namespace data_model
+} // namespace esp_matter
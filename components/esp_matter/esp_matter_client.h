@@ -208,7 +208,7 @@ public:
 
     CHIP_ERROR EncodeTo(chip::TLV::TLVWriter  &writer, chip::TLV::Tag tag) const override
     {
-        if (json_to_tlv(m_json_str, writer, tag) != ESP_OK) {
+        if (json_to_tlv_stream(m_json_str, strlen(m_json_str), writer, tag) != ESP_OK) {
             return CHIP_ERROR_INTERNAL;
         }
         return CHIP_NO_ERROR;
@@ -15,6 +15,7 @@
 #include <esp_check.h>
 #include <esp_log.h>
 #include <esp_matter.h>
+#include <esp_matter_boot_profile.h>
 #include <esp_matter_core.h>
 #include <esp_matter_icd_configuration.h>
 #include <esp_matter_test_event_trigger.h>
@@ -27,6 +28,7 @@
 #include <esp_matter_ota.h>
 #ifdef CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
 #include <esp_matter_nvs.h>
+#include <esp_matter_nvs_write_back.h>
 #include <data_model_provider/esp_matter_data_model_provider.h>
 #include <esp_matter_data_model_priv.h>
 #else
@@ -220,7 +222,10 @@ static void esp_matter_chip_init_task(intptr_t context)
     if (ret != CHIP_NO_ERROR) {
         ESP_LOGE(TAG, "Failed to add fabric delegate, err:%" CHIP_ERROR_FORMAT, ret.Format());
     }
-    ret = chip::Server::GetInstance().Init(initParams);
+    {
+        boot_profile::scoped_phase phase(boot_profile::PHASE_SERVER_INIT);
+        ret = chip::Server::GetInstance().Init(initParams);
+    }
     if (ret != CHIP_NO_ERROR) {
         ESP_LOGE(TAG, "Failed to init server instance, err:%" CHIP_ERROR_FORMAT, ret.Format());
     }
@@ -263,6 +268,7 @@ static void device_callback_internal(const ChipDeviceEvent * event, intptr_t arg
         break;
 #ifdef CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER
     case chip::DeviceLayer::DeviceEventType::kDnssdInitialized:
+        boot_profile::end(boot_profile::PHASE_DNSSD_READY);
         esp_matter_ota_requestor_start();
         /* Initialize binding manager */
         client::binding_manager_init();
@@ -369,6 +375,13 @@ esp_err_t set_server_init_params(chip::CommonCaseDeviceServerInitParams *server_
 esp_err_t start(event_callback_t callback, intptr_t callback_arg)
 {
     VerifyOrReturnError(!esp_matter_started, ESP_ERR_INVALID_STATE, ESP_LOGE(TAG, "esp_matter has started"));
+    boot_profile::end(boot_profile::PHASE_NODE_BUILD);
+    boot_profile::begin(boot_profile::PHASE_CHIP_INIT);
+    boot_profile::begin(boot_profile::PHASE_DNSSD_READY);
+#if defined(CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER) && defined(CONFIG_ESP_MATTER_ENABLE_DATA_MODEL)
+    // The data model is built, the attributes created from now on are restored one by one
+    attribute::end_nvs_restore();
+#endif
     esp_err_t err = esp_event_loop_create_default();
 
     // In case create event loop returns ESP_ERR_INVALID_STATE it is not necessary to fail startup
@@ -383,6 +396,7 @@ esp_err_t start(event_callback_t callback, intptr_t callback_arg)
 
     err = chip_init(callback, callback_arg);
     VerifyOrReturnError(err == ESP_OK, err, ESP_LOGE(TAG, "Error initializing matter"));
+    boot_profile::end(boot_profile::PHASE_CHIP_INIT);
 #if CHIP_DEVICE_CONFIG_ENABLE_THREAD
 #if defined(CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER) && defined(CONFIG_ESP_MATTER_ENABLE_OPENTHREAD)
     // If Thread is Provisioned, publish the dns service
@@ -402,7 +416,9 @@ esp_err_t start(event_callback_t callback, intptr_t callback_arg)
     if (err == ESP_ERR_NVS_NOT_FOUND) {
         err = node::store_min_unused_endpoint_id();
     }
+    attribute::schedule_background_restore();
 #endif // defined(CONFIG_ESP_MATTER_ENABLE_MATTER_SERVER) && defined(CONFIG_ESP_MATTER_ENABLE_DATA_MODEL)
+    boot_profile::log();
     return err;
 }
 
@@ -412,6 +428,12 @@ esp_err_t factory_reset()
 #ifdef CONFIG_ESP_MATTER_ENABLE_DATA_MODEL
     node_t *node = node::get();
     if (node) {
+        /* Drop the queued attribute values, so that they are not stored after the namespace is erased. */
+        {
+            lock::ScopedChipStackLock lock(portMAX_DELAY);
+            attribute::write_back::clear();
+        }
+        attribute::discard_nvs_cache();
         /* ESP Matter data model is used. Erase all the data that we have added in nvs. */
         nvs_handle_t handle;
         err = nvs_open_from_partition(ESP_MATTER_NVS_PART_NAME, ESP_MATTER_KVS_NAMESPACE, NVS_READWRITE, &handle);
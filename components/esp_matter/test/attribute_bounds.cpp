@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC09;
+
+static cluster_t *create_bounds_cluster(node_t *node, endpoint_t **endpoint)
+{
+    *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(*endpoint);
+    cluster_t *cluster = cluster::create(*endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    return cluster;
+}
+
+TEST_CASE("constant bounds clamp and validate the value", "[bounds]")
+{
+    node_t *node = test::get_or_create_node();
+    endpoint_t *endpoint = nullptr;
+    cluster_t *cluster = create_bounds_cluster(node, &endpoint);
+
+    attribute_t *level = attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_WRITABLE, esp_matter_uint8(10));
+    TEST_ASSERT_NOT_NULL(level);
+    TEST_ASSERT_EQUAL(ESP_OK, (attribute::add_bounds<uint8_t, 1, 5>(level)));
+
+    // The current value is clamped to the maximum
+    esp_matter_attr_val_t val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(level, &val));
+    TEST_ASSERT_EQUAL_UINT8(5, val.val.u8);
+
+    val = esp_matter_uint8(3);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(level, &val, false));
+    val = esp_matter_uint8(6);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::set_val(level, &val, false));
+    val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::set_val(level, &val, false));
+
+    esp_matter_attr_bounds_t bounds;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_bounds(level, &bounds));
+    TEST_ASSERT_EQUAL(ESP_MATTER_VAL_TYPE_UINT8, bounds.min.type);
+    TEST_ASSERT_EQUAL_UINT8(1, bounds.min.val.u8);
+    TEST_ASSERT_EQUAL_UINT8(5, bounds.max.val.u8);
+
+    // The same range on a nullable enum uses the same storage type, null stays valid. The generated code of the
+    // nullable enums already added bounds of the exact attribute type, this only moves them to flash.
+    attribute_t *mode = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_WRITABLE | ATTRIBUTE_FLAG_NULLABLE,
+                                          esp_matter_nullable_enum8(nullable<uint8_t>()));
+    TEST_ASSERT_NOT_NULL(mode);
+    TEST_ASSERT_EQUAL(ESP_OK, (attribute::add_bounds<uint8_t, 1, 5>(mode)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(mode, &val));
+    TEST_ASSERT_TRUE(val.is_null());
+    val = esp_matter_nullable_enum8(4);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(mode, &val, false));
+    val = esp_matter_nullable_enum8(9);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::set_val(mode, &val, false));
+    val = esp_matter_nullable_enum8(nullable<uint8_t>());
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(mode, &val, false));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("bounds of another storage type are rejected", "[bounds]")
+{
+    node_t *node = test::get_or_create_node();
+    endpoint_t *endpoint = nullptr;
+    cluster_t *cluster = create_bounds_cluster(node, &endpoint);
+
+    attribute_t *temperature = attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_WRITABLE, esp_matter_int16(2000));
+    TEST_ASSERT_NOT_NULL(temperature);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, (attribute::add_bounds<uint16_t, 0, 100>(temperature)));
+    TEST_ASSERT_FALSE(attribute::get_flags(temperature) & ATTRIBUTE_FLAG_MIN_MAX);
+
+    // Copied bounds are replaced by constant ones
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::add_bounds(temperature, esp_matter_int16(-500), esp_matter_int16(500)));
+    esp_matter_attr_val_t val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(temperature, &val));
+    TEST_ASSERT_EQUAL_INT16(500, val.val.i16);
+    TEST_ASSERT_EQUAL(ESP_OK, (attribute::add_bounds<int16_t, -27315, 32767>(temperature)));
+    val = esp_matter_int16(-27316);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::set_val(temperature, &val, false));
+    val = esp_matter_int16(2500);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(temperature, &val, false));
+
+    // Copied bounds still need the exact type of the attribute, the sub type of an enum included
+    attribute_t *direction = attribute::create(cluster, 0x0002, ATTRIBUTE_FLAG_NONE, esp_matter_enum8(5));
+    TEST_ASSERT_NOT_NULL(direction);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::add_bounds(direction, esp_matter_uint8(0), esp_matter_uint8(1)));
+    TEST_ASSERT_FALSE(attribute::get_flags(direction) & ATTRIBUTE_FLAG_MIN_MAX);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(direction, &val));
+    TEST_ASSERT_EQUAL_UINT8(5, val.val.u8);
+
+    attribute_t *name = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_NONE, esp_matter_char_str(nullptr, 0), 16);
+    TEST_ASSERT_NOT_NULL(name);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, (attribute::add_bounds<uint8_t, 0, 1>(name)));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
@@ -11,6 +11,10 @@
 
 #include "common.h"
 
+namespace esp_matter::attribute {
+esp_err_t get_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val);
+} // namespace esp_matter::attribute
+
 using namespace esp_matter;
 using namespace chip::app::Clusters;
 
@@ -319,6 +323,22 @@ TEST_CASE("get_val uint16", "[get_val][internal_managed][uint16]")
     teardown_for_get_val();
 }
 
+TEST_CASE("get_val uint16 - attribute handle", "[get_val][internal_managed][uint16]")
+{
+    setup_for_get_val();
+
+    // The path of an internally managed attribute is recovered from its handle
+    attribute_t *attr = attribute::get(root_endpoint_id, BasicInformation::Id, BasicInformation::Attributes::VendorID::Id);
+    TEST_ASSERT_NOT_NULL(attr);
+    esp_matter_attr_val_t val;
+    esp_err_t err = attribute::get_val(attr, &val);
+    TEST_ASSERT_EQUAL(ESP_OK, err);
+    TEST_ASSERT_EQUAL(ESP_MATTER_VAL_TYPE_UINT16, val.type);
+    TEST_ASSERT_EQUAL(CONFIG_DEVICE_VENDOR_ID, val.val.u16);
+
+    teardown_for_get_val();
+}
+
 TEST_CASE("get_val uint32 - SoftwareVersion", "[get_val][internal_managed][uint32]")
 {
     setup_for_get_val();
@@ -358,6 +378,92 @@ TEST_CASE("get_val bool - SupportsConcurrentConnection", "[get_val][internal_man
     teardown_for_get_val();
 }
 
+// Strings - ESP Matter Managed
+
+TEST_CASE("get_val char_string - served from storage", "[get_val][esp_matter_managed][char_string]")
+{
+    setup_for_get_val();
+
+    // Custom cluster without server cluster instance or AttributeAccessInterface, so get_val reads the storage
+    constexpr uint32_t k_custom_cluster_id = 0xFFF1FC02;
+    constexpr uint32_t k_label_attribute_id = 0x0000;
+    cluster_t *cluster = cluster::get(test_endpoint, k_custom_cluster_id);
+    if (!cluster) {
+        cluster = cluster::create(test_endpoint, k_custom_cluster_id, CLUSTER_FLAG_SERVER);
+        TEST_ASSERT_NOT_NULL(cluster);
+        char label[] = "label";
+        attribute_t *attr = attribute::create(cluster, k_label_attribute_id, ATTRIBUTE_FLAG_WRITABLE,
+                                              esp_matter_char_str(label, strlen(label)), 16);
+        TEST_ASSERT_NOT_NULL(attr);
+    }
+
+    esp_matter_attr_val_t val;
+    esp_err_t err = attribute::get_val(test_endpoint_id, k_custom_cluster_id, k_label_attribute_id, &val);
+    TEST_ASSERT_EQUAL(ESP_OK, err);
+    TEST_ASSERT_EQUAL(ESP_MATTER_VAL_TYPE_CHAR_STRING, val.type);
+    TEST_ASSERT_EQUAL(5, val.val.a.s);
+    TEST_ASSERT_EQUAL_STRING("label", val.val.a.b);
+
+    // The returned buffer is a copy owned by the caller
+    attribute_t *attr = attribute::get(test_endpoint_id, k_custom_cluster_id, k_label_attribute_id);
+    esp_matter_attr_val_t stored_val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_internal(attr, &stored_val));
+    TEST_ASSERT_NOT_EQUAL(stored_val.val.a.b, val.val.a.b);
+    free(val.val.a.b);
+
+    teardown_for_get_val();
+}
+
+TEST_CASE("get_val_span char_string - lends the stored value", "[get_val][esp_matter_managed][char_string]")
+{
+    setup_for_get_val();
+
+    constexpr uint32_t k_custom_cluster_id = 0xFFF1FC02;
+    constexpr uint32_t k_location_attribute_id = 0x0001;
+    cluster_t *cluster = cluster::get(test_endpoint, k_custom_cluster_id);
+    if (!cluster) {
+        cluster = cluster::create(test_endpoint, k_custom_cluster_id, CLUSTER_FLAG_SERVER);
+        TEST_ASSERT_NOT_NULL(cluster);
+    }
+    attribute_t *attr = attribute::get(cluster, k_location_attribute_id);
+    if (!attr) {
+        char location[] = "XX";
+        attr = attribute::create(cluster, k_location_attribute_id, ATTRIBUTE_FLAG_WRITABLE,
+                                 esp_matter_char_str(location, strlen(location)), 64);
+        TEST_ASSERT_NOT_NULL(attr);
+    }
+
+    chip::CharSpan span;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_span(attr, span));
+    TEST_ASSERT_TRUE(span.data_equal(chip::CharSpan::fromCharString("XX")));
+
+    // A value longer than the inline buffer moves to a heap buffer, a shorter one then reuses it
+    char long_location[] = "a location longer than the inline buffer";
+    esp_matter_attr_val_t val = esp_matter_char_str(long_location, strlen(long_location));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(attr, &val));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_span(attr, span));
+    TEST_ASSERT_TRUE(span.data_equal(chip::CharSpan::fromCharString(long_location)));
+    const char *heap_buffer = span.data();
+
+    char short_location[] = "YY";
+    val = esp_matter_char_str(short_location, strlen(short_location));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(attr, &val));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_span(attr, span));
+    TEST_ASSERT_TRUE(span.data_equal(chip::CharSpan::fromCharString("YY")));
+    TEST_ASSERT_EQUAL_PTR(heap_buffer, span.data());
+
+    // The stored value stays null terminated for get_val()
+    esp_matter_attr_val_t copy;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(attr, &copy));
+    TEST_ASSERT_EQUAL_STRING("YY", copy.val.a.b);
+    free(copy.val.a.b);
+
+    chip::ByteSpan bytes;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::get_val_span(attr, bytes));
+
+    teardown_for_get_val();
+}
+
 // Strings - Internally Managed
 
 TEST_CASE("get_val char_string", "[get_val][internal_managed][char_string]")
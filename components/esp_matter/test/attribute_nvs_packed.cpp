@@ -0,0 +1,226 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_mem.h>
+#include <nvs.h>
+
+#include <lib/support/Base64.h>
+
+#include "cluster_lifecycle_common.h"
+
+#if CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
+
+namespace esp_matter::attribute {
+esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                           esp_matter_attr_val_t &val);
+esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                           const esp_matter_attr_val_t &val);
+esp_err_t begin_nvs_batch(nvs_handle_t &handle);
+esp_err_t store_val_in_nvs_batch(nvs_handle_t handle, uint16_t endpoint_id, uint32_t cluster_id,
+                                 uint32_t attribute_id, const esp_matter_attr_val_t &val);
+esp_err_t end_nvs_batch(nvs_handle_t handle);
+esp_err_t erase_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id);
+void discard_nvs_cache();
+} // namespace esp_matter::attribute
+
+using namespace esp_matter;
+
+static constexpr uint16_t k_endpoint_id = 0xFFF0;
+static constexpr uint32_t k_cluster_id = 0xFFF1FC10;
+static constexpr uint32_t k_other_cluster_id = 0xFFF1FC11;
+static constexpr uint32_t k_attribute_count = 3;
+
+static void erase_clusters()
+{
+    test::get_or_create_node();
+    for (uint32_t cluster_id : {k_cluster_id, k_other_cluster_id}) {
+        for (uint32_t attribute_id = 0; attribute_id < k_attribute_count; ++attribute_id) {
+            attribute::erase_val_in_nvs(k_endpoint_id, cluster_id, attribute_id);
+        }
+    }
+}
+
+static uint8_t read_u8(uint32_t cluster_id, uint32_t attribute_id)
+{
+    esp_matter_attr_val_t val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_from_nvs(k_endpoint_id, cluster_id, attribute_id, val));
+    return val.val.u8;
+}
+
+// The key of a value stored with its own key, as before the packed storage
+static void get_attribute_key(uint32_t cluster_id, uint32_t attribute_id, char *attribute_key)
+{
+    uint8_t encode_buf[10] = {0};
+    char base64_str[17] = {0};
+    uint16_t endpoint_id = k_endpoint_id;
+    memcpy(&encode_buf[0], &endpoint_id, sizeof(endpoint_id));
+    memcpy(&encode_buf[2], &cluster_id, sizeof(cluster_id));
+    memcpy(&encode_buf[6], &attribute_id, sizeof(attribute_id));
+    chip::Base64Encode(encode_buf, 10, base64_str);
+    strncpy(attribute_key, base64_str, 14);
+    attribute_key[14] = 0;
+}
+
+static void store_legacy_u8(uint32_t cluster_id, uint32_t attribute_id, uint8_t value)
+{
+    char attribute_key[16] = {0};
+    get_attribute_key(cluster_id, attribute_id, attribute_key);
+    nvs_handle_t handle;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open_from_partition(CONFIG_ESP_MATTER_NVS_PART_NAME, "esp_matter_kvs", NVS_READWRITE,
+                                                      &handle));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_set_u8(handle, attribute_key, value));
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_commit(handle));
+    nvs_close(handle);
+}
+
+static esp_err_t read_legacy_u8(uint32_t cluster_id, uint32_t attribute_id, uint8_t &value)
+{
+    char attribute_key[16] = {0};
+    get_attribute_key(cluster_id, attribute_id, attribute_key);
+    nvs_handle_t handle;
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_open_from_partition(CONFIG_ESP_MATTER_NVS_PART_NAME, "esp_matter_kvs", NVS_READONLY,
+                                                      &handle));
+    esp_err_t err = nvs_get_u8(handle, attribute_key, &value);
+    nvs_close(handle);
+    return err;
+}
+
+TEST_CASE("packed attributes are read back with their type", "[nvs_packed]")
+{
+    erase_clusters();
+    const char *label = "packed label";
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 0, esp_matter_uint8(42)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 1, esp_matter_int16(-1234)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 2,
+                                                         esp_matter_char_str((char *)label, strlen(label))));
+    // Rewriting a record keeps the other ones
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 0, esp_matter_uint8(43)));
+
+    // Read from flash, not from the cached blob
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL_UINT8(43, read_u8(k_cluster_id, 0));
+    esp_matter_attr_val_t val = esp_matter_int16(0);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 1, val));
+    TEST_ASSERT_EQUAL_INT16(-1234, val.val.i16);
+    val = esp_matter_char_str(nullptr, 0);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 2, val));
+    TEST_ASSERT_EQUAL(strlen(label), val.val.a.s);
+    TEST_ASSERT_EQUAL_MEMORY(label, val.val.a.b, val.val.a.s);
+    esp_matter_mem_free(val.val.a.b);
+
+    // A record is not read with another type
+    val = esp_matter_uint16(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_TYPE_MISMATCH, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 0, val));
+
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::erase_val_in_nvs(k_endpoint_id, k_cluster_id, 0));
+    val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 0, val));
+    erase_clusters();
+}
+
+TEST_CASE("packed cluster is written when another cluster is loaded", "[nvs_packed]")
+{
+    erase_clusters();
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 0, esp_matter_uint8(1)));
+
+    // The batch switches between the clusters, each switch writes the blob of the previous one
+    nvs_handle_t handle;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::begin_nvs_batch(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_cluster_id, 0,
+                                                                esp_matter_uint8(2)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_other_cluster_id, 0,
+                                                                esp_matter_uint8(3)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_cluster_id, 1,
+                                                                esp_matter_uint8(4)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::end_nvs_batch(handle));
+
+    // A read of another cluster evicts the loaded one
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL_UINT8(2, read_u8(k_cluster_id, 0));
+    TEST_ASSERT_EQUAL_UINT8(3, read_u8(k_other_cluster_id, 0));
+    TEST_ASSERT_EQUAL_UINT8(4, read_u8(k_cluster_id, 1));
+    erase_clusters();
+}
+
+TEST_CASE("packed cluster is kept dirty when its write fails", "[nvs_packed]")
+{
+    erase_clusters();
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(k_endpoint_id, k_cluster_id, 0, esp_matter_uint8(1)));
+
+    // A value larger than the NVS partition makes the write of the blob fail
+    constexpr uint16_t k_large_len = 60000;
+    uint8_t *large = (uint8_t *)esp_matter_mem_calloc(1, k_large_len);
+    TEST_ASSERT_NOT_NULL(large);
+    nvs_handle_t handle;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::begin_nvs_batch(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_cluster_id, 0,
+                                                                esp_matter_uint8(2)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_cluster_id, 1,
+                                                                esp_matter_long_octet_str(large, k_large_len)));
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, attribute::end_nvs_batch(handle));
+    esp_matter_mem_free(large);
+
+    // The changes of the failed write are still pending and written with the next one
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::erase_val_in_nvs(k_endpoint_id, k_cluster_id, 1));
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL_UINT8(2, read_u8(k_cluster_id, 0));
+    erase_clusters();
+}
+
+TEST_CASE("attributes stored with their own key are moved into the packed cluster", "[nvs_packed]")
+{
+    erase_clusters();
+    store_legacy_u8(k_cluster_id, 0, 7);
+    store_legacy_u8(k_cluster_id, 1, 8);
+    TEST_ASSERT_EQUAL_UINT8(7, read_u8(k_cluster_id, 0));
+    TEST_ASSERT_EQUAL_UINT8(8, read_u8(k_cluster_id, 1));
+    // The keys are kept until the blob of the cluster is written, once for both attributes
+    uint8_t legacy_val = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, read_legacy_u8(k_cluster_id, 0, legacy_val));
+    TEST_ASSERT_EQUAL_UINT8(7, legacy_val);
+
+    // A read of another cluster writes the blob and erases the keys
+    esp_matter_attr_val_t val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(k_endpoint_id, k_other_cluster_id, 0, val));
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, read_legacy_u8(k_cluster_id, 0, legacy_val));
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, read_legacy_u8(k_cluster_id, 1, legacy_val));
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL_UINT8(7, read_u8(k_cluster_id, 0));
+    TEST_ASSERT_EQUAL_UINT8(8, read_u8(k_cluster_id, 1));
+
+    // A blob dropped before it is written keeps the keys, the value is moved again by the next read
+    store_legacy_u8(k_cluster_id, 2, 6);
+    TEST_ASSERT_EQUAL_UINT8(6, read_u8(k_cluster_id, 2));
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL(ESP_OK, read_legacy_u8(k_cluster_id, 2, legacy_val));
+    TEST_ASSERT_EQUAL_UINT8(6, read_u8(k_cluster_id, 2));
+
+    // An erase removes the value stored with its own key as well, it is not moved back by the next read
+    store_legacy_u8(k_cluster_id, 0, 9);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::erase_val_in_nvs(k_endpoint_id, k_cluster_id, 0));
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, read_legacy_u8(k_cluster_id, 0, legacy_val));
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 0, val));
+    erase_clusters();
+}
+
+TEST_CASE("discarded packed cluster is not written", "[nvs_packed]")
+{
+    erase_clusters();
+    nvs_handle_t handle;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::begin_nvs_batch(handle));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs_batch(handle, k_endpoint_id, k_cluster_id, 0,
+                                                                esp_matter_uint8(5)));
+    // As in a factory reset, the pending blob is dropped before the namespace is erased
+    attribute::discard_nvs_cache();
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::end_nvs_batch(handle));
+    esp_matter_attr_val_t val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(k_endpoint_id, k_cluster_id, 0, val));
+}
+
+#endif // CONFIG_ESP_MATTER_NVS_PACKED_CLUSTER_STORAGE
@@ -0,0 +1,113 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+
+#include "cluster_lifecycle_common.h"
+
+namespace esp_matter::attribute {
+esp_err_t set_val_internal(attribute_t *attribute, esp_matter_attr_val_t *val, bool call_callbacks);
+esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                           esp_matter_attr_val_t &val);
+esp_err_t erase_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id);
+namespace write_back {
+void clear();
+uint16_t get_pending_count();
+} // namespace write_back
+} // namespace esp_matter::attribute
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC03;
+static constexpr uint32_t k_attribute_count = 4;
+
+TEST_CASE("deferred attributes are written together on flush", "[nvs_write_back]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+
+    attribute_t *attributes[k_attribute_count];
+    for (uint32_t index = 0; index < k_attribute_count; ++index) {
+        attribute::erase_val_in_nvs(endpoint_id, k_cluster_id, index);
+        attributes[index] = attribute::create(cluster, index, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint8(0));
+        TEST_ASSERT_NOT_NULL(attributes[index]);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_deferred_persistence(attributes[index]));
+        attribute::erase_val_in_nvs(endpoint_id, k_cluster_id, index);
+    }
+
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        // Change every attribute several times, only the last value of each has to be written
+        for (uint8_t value = 1; value <= 10; ++value) {
+            for (uint32_t index = 0; index < k_attribute_count; ++index) {
+                esp_matter_attr_val_t val = esp_matter_uint8(value + index);
+                TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val_internal(attributes[index], &val, false));
+            }
+        }
+    }
+
+    // Nothing is written before the persistence time expires
+    esp_matter_attr_val_t nvs_val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(endpoint_id, k_cluster_id, 0, nvs_val));
+
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::flush_deferred_persistence());
+    for (uint32_t index = 0; index < k_attribute_count; ++index) {
+        nvs_val = esp_matter_uint8(0);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_from_nvs(endpoint_id, k_cluster_id, index, nvs_val));
+        TEST_ASSERT_EQUAL_UINT8(10 + index, nvs_val.val.u8);
+    }
+
+    // A destroyed attribute is dropped from the queue and its value is not written back
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        esp_matter_attr_val_t val = esp_matter_uint8(42);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val_internal(attributes[0], &val, false));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::flush_deferred_persistence());
+    nvs_val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(endpoint_id, k_cluster_id, 0, nvs_val));
+}
+
+TEST_CASE("cleared deferred attributes are not written", "[nvs_write_back]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    attribute_t *attribute = attribute::create(cluster, 0, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint8(0));
+    TEST_ASSERT_NOT_NULL(attribute);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_deferred_persistence(attribute));
+    attribute::erase_val_in_nvs(endpoint_id, k_cluster_id, 0);
+
+    // The factory reset drops the queue instead of writing values which are erased right after
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        esp_matter_attr_val_t val = esp_matter_uint8(7);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val_internal(attribute, &val, false));
+        TEST_ASSERT_EQUAL(1, attribute::write_back::get_pending_count());
+        attribute::write_back::clear();
+        TEST_ASSERT_EQUAL(0, attribute::write_back::get_pending_count());
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::flush_deferred_persistence());
+    esp_matter_attr_val_t nvs_val = esp_matter_uint8(0);
+    TEST_ASSERT_EQUAL(ESP_ERR_NVS_NOT_FOUND, attribute::get_val_from_nvs(endpoint_id, k_cluster_id, 0, nvs_val));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
@@ -306,3 +306,79 @@ TEST_CASE("update and report both store the value correctly", "[update][report_p
 
     teardown_for_update_report();
 }
+
+// ============================================================
+// attribute::batch tests
+// ============================================================
+
+static chip::DataVersion get_cluster_data_version(uint32_t cluster_id)
+{
+    chip::DataVersion data_version = 0;
+    cluster_t *cluster = cluster::get(test_endpoint_id, cluster_id);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_EQUAL(ESP_OK, cluster::get_data_version(cluster, data_version));
+    return data_version;
+}
+
+TEST_CASE("batch update applies every value with one data version increase per cluster", "[report][batch]")
+{
+    setup_for_update_report();
+
+    esp_matter_attr_val_t off = esp_matter_attr_val(false);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::update(test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &off));
+    chip::DataVersion on_off_version = get_cluster_data_version(OnOff::Id);
+    chip::DataVersion level_version = get_cluster_data_version(LevelControl::Id);
+
+    attribute::batch::entry_t entries[] = {
+        {test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, esp_matter_attr_val(true)},
+        {test_endpoint_id, LevelControl::Id, LevelControl::Attributes::CurrentLevel::Id,
+         esp_matter_attr_val(nullable<uint8_t>(120))},
+        {test_endpoint_id, LevelControl::Id, LevelControl::Attributes::OnLevel::Id,
+         esp_matter_attr_val(nullable<uint8_t>(60))},
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::batch::update(entries, sizeof(entries) / sizeof(entries[0])));
+
+    esp_matter_attr_val_t retrieved;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &retrieved));
+    TEST_ASSERT_EQUAL(true, retrieved.val.b);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(test_endpoint_id, LevelControl::Id,
+                                                 LevelControl::Attributes::CurrentLevel::Id, &retrieved));
+    TEST_ASSERT_EQUAL(120, retrieved.val.u8);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(test_endpoint_id, LevelControl::Id,
+                                                 LevelControl::Attributes::OnLevel::Id, &retrieved));
+    TEST_ASSERT_EQUAL(60, retrieved.val.u8);
+
+    TEST_ASSERT_NOT_EQUAL(on_off_version, get_cluster_data_version(OnOff::Id));
+    // Two attributes of the level control cluster changed, its data version is increased once
+    TEST_ASSERT_EQUAL(level_version + 1, get_cluster_data_version(LevelControl::Id));
+
+    teardown_for_update_report();
+}
+
+TEST_CASE("batch update applies nothing if one value is invalid", "[report][batch][invalid]")
+{
+    setup_for_update_report();
+
+    esp_matter_attr_val_t off = esp_matter_attr_val(false);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::update(test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &off));
+    reset_callback_records();
+
+    attribute::batch::entry_t entries[] = {
+        {test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, esp_matter_attr_val(true)},
+        // Wrong value type
+        {test_endpoint_id, LevelControl::Id, LevelControl::Attributes::CurrentLevel::Id, esp_matter_attr_val(true)},
+    };
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::batch::update(entries, sizeof(entries) / sizeof(entries[0])));
+
+    esp_matter_attr_val_t retrieved;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(test_endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &retrieved));
+    TEST_ASSERT_EQUAL(false, retrieved.val.b);
+    TEST_ASSERT_FALSE(cb_pre_update.called);
+
+    attribute::batch::entry_t missing[] = {
+        {test_endpoint_id, OnOff::Id, chip::kInvalidAttributeId, esp_matter_attr_val(true)},
+    };
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, attribute::batch::report(missing, 1));
+
+    teardown_for_update_report();
+}
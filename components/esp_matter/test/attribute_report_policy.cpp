@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model_provider.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <app/AttributePathParams.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC06;
+static constexpr uint32_t k_measured_value_id = 0x0000;
+static constexpr uint32_t k_tolerance_id = 0x0003;
+static constexpr uint32_t k_sample_count = 200;
+// Temperature in 0.01 degree, as in the Temperature Measurement cluster
+static constexpr int16_t k_base_temperature = 2000;
+
+namespace esp_matter {
+namespace attribute {
+bool should_report_change(attribute_t *attribute);
+} // namespace attribute
+} // namespace esp_matter
+
+static chip::DataVersion get_data_version(cluster_t *cluster)
+{
+    chip::DataVersion version;
+    TEST_ASSERT_EQUAL(ESP_OK, cluster::get_data_version(cluster, version));
+    return version;
+}
+
+static int16_t get_noisy_sample(uint32_t index)
+{
+    // +/- 0.2 degree of sensor noise
+    static const int16_t k_noise[] = { 0, 12, -8, 20, -15, 5, -20, 9, -3, 17 };
+    return k_base_temperature + k_noise[index % (sizeof(k_noise) / sizeof(k_noise[0]))];
+}
+
+static uint32_t feed_samples(attribute_t *attribute, cluster_t *cluster, uint16_t endpoint_id, int16_t offset,
+                             uint32_t sample_count = k_sample_count)
+{
+    chip::DataVersion initial_version = get_data_version(cluster);
+    uint32_t report_count = 0;
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+    for (uint32_t index = 0; index < sample_count; ++index) {
+        // Same steps as attribute::report(), counting the changes that are reported now
+        esp_matter_attr_val_t val = esp_matter_nullable_int16((int16_t)(get_noisy_sample(index) + offset));
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(attribute, &val));
+        if (attribute::should_report_change(attribute)) {
+            report_count++;
+            data_model::provider::get_instance().Temporary_ReportAttributeChanged(
+                chip::app::AttributePathParams(endpoint_id, k_cluster_id, k_measured_value_id));
+        }
+    }
+    // Every change increases the data version once, whether it is reported now or not
+    TEST_ASSERT_EQUAL_UINT32(sample_count, get_data_version(cluster) - initial_version);
+    return report_count;
+}
+
+static attribute_t *create_measured_value(node_t *node, endpoint_t **endpoint)
+{
+    *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(*endpoint);
+    cluster_t *cluster = cluster::create(*endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    attribute_t *attribute = attribute::create(cluster, k_measured_value_id, ATTRIBUTE_FLAG_NULLABLE,
+                                               esp_matter_nullable_int16(nullable<int16_t>()));
+    TEST_ASSERT_NOT_NULL(attribute);
+    return attribute;
+}
+
+TEST_CASE("report policy thresholds filter sensor noise", "[report_policy]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = nullptr;
+    attribute_t *attribute = create_measured_value(node, &endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::get(endpoint, k_cluster_id);
+
+    // Without policy every change of the noisy value is reported
+    uint32_t unfiltered_reports = feed_samples(attribute, cluster, endpoint_id, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(k_sample_count / 2, unfiltered_reports);
+
+    attribute::report_policy_t policy = {};
+    policy.absolute_delta = 50; // 0.5 degree
+    policy.ewma_window = 4;
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_report_policy(attribute, &policy));
+    }
+    // The first change after the policy is set is reported, the noise is not
+    uint32_t filtered_reports = feed_samples(attribute, cluster, endpoint_id, 0);
+    TEST_ASSERT_EQUAL_UINT32(1, filtered_reports);
+
+    // A real step of 0.6 degree is reported once, when the average moved by 0.5 degree
+    uint32_t step_reports = feed_samples(attribute, cluster, endpoint_id, 60);
+    TEST_ASSERT_EQUAL_UINT32(1, step_reports);
+
+    // The value is still stored, only its report is suppressed
+    esp_matter_attr_val_t val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint_id, k_cluster_id, k_measured_value_id, &val));
+    TEST_ASSERT_EQUAL_INT16(get_noisy_sample(k_sample_count - 1) + 60, val.val.i16);
+
+    // A filtered change made with report() still increases the data version
+    chip::DataVersion initial_version = get_data_version(cluster);
+    val = esp_matter_nullable_int16((int16_t)(get_noisy_sample(0) + 60));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::report(endpoint_id, k_cluster_id, k_measured_value_id, &val));
+    TEST_ASSERT_EQUAL_UINT32(1, get_data_version(cluster) - initial_version);
+
+    // A change to null is always significant
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        val = esp_matter_nullable_int16(nullable<int16_t>());
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(attribute, &val));
+        TEST_ASSERT_TRUE(attribute::should_report_change(attribute));
+    }
+
+    printf("samples: %" PRIu32 ", reports without policy: %" PRIu32 ", with policy: %" PRIu32 "\n", k_sample_count,
+           unfiltered_reports, filtered_reports);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("report policy minimum interval delays the latest value", "[report_policy]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = nullptr;
+    attribute_t *attribute = create_measured_value(node, &endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::get(endpoint, k_cluster_id);
+
+    attribute::report_policy_t policy = {};
+    policy.min_interval_ms = 3000;
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_report_policy(attribute, &policy));
+    }
+
+    // The first change is reported at once, the next ones wait for the end of the interval
+    uint32_t reports = feed_samples(attribute, cluster, endpoint_id, 0, 20);
+    TEST_ASSERT_EQUAL_UINT32(1, reports);
+    // The delayed report of the latest value increases the data version once more
+    chip::DataVersion version = get_data_version(cluster);
+    vTaskDelay(pdMS_TO_TICKS(policy.min_interval_ms + 200));
+    TEST_ASSERT_EQUAL_UINT32(1, get_data_version(cluster) - version);
+
+    // Removing the policy reports every change again
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_report_policy(attribute, nullptr));
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(k_sample_count / 2, feed_samples(attribute, cluster, endpoint_id, 0));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("report policy held back change of a batch increases the data version once", "[report_policy][batch]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = nullptr;
+    attribute_t *attribute = create_measured_value(node, &endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::get(endpoint, k_cluster_id);
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, k_tolerance_id, ATTRIBUTE_FLAG_NONE, esp_matter_uint16(0)));
+
+    attribute::report_policy_t policy = {};
+    policy.min_interval_ms = 1000;
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_report_policy(attribute, &policy));
+    }
+    esp_matter_attr_val_t val = esp_matter_nullable_int16(k_base_temperature);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::report(endpoint_id, k_cluster_id, k_measured_value_id, &val));
+
+    // The measured value is held back by the interval, the tolerance is reported, the cluster changed once
+    chip::DataVersion version = get_data_version(cluster);
+    attribute::batch::entry_t entries[] = {
+        {endpoint_id, k_cluster_id, k_measured_value_id, esp_matter_nullable_int16((int16_t)(k_base_temperature + 100))},
+        {endpoint_id, k_cluster_id, k_tolerance_id, esp_matter_uint16(10)},
+    };
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::batch::report(entries, sizeof(entries) / sizeof(entries[0])));
+    TEST_ASSERT_EQUAL_UINT32(1, get_data_version(cluster) - version);
+
+    // The delayed report of the measured value is sent before the endpoint is destroyed
+    vTaskDelay(pdMS_TO_TICKS(policy.min_interval_ms + 200));
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
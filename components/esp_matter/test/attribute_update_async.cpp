@@ -0,0 +1,141 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC05;
+static constexpr uint32_t k_level_attribute_id = 0x0000;
+static constexpr uint32_t k_name_attribute_id = 0x0001;
+
+static attribute::async_stats_t get_async_stats()
+{
+    attribute::async_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_async_stats(&stats));
+    return stats;
+}
+
+static uint32_t get_processed_count(const attribute::async_stats_t &stats)
+{
+    return stats.applied + stats.coalesced + stats.dropped;
+}
+
+static void wait_for_processed(uint32_t processed_count)
+{
+    for (int retry = 0; retry < 100; ++retry) {
+        if (get_processed_count(get_async_stats()) >= processed_count) {
+            return;
+        }
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    TEST_FAIL_MESSAGE("The queued updates were not applied");
+}
+
+static endpoint_t *create_test_endpoint(node_t *node)
+{
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, k_level_attribute_id, ATTRIBUTE_FLAG_NONE, esp_matter_uint16(0)));
+    char name[] = "";
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, k_name_attribute_id, ATTRIBUTE_FLAG_NONE,
+                                           esp_matter_char_str(name, 0), 32));
+    return endpoint;
+}
+
+TEST_CASE("update_async coalesces updates of the same attribute", "[update_async]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = create_test_endpoint(node);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    attribute::async_stats_t before = get_async_stats();
+
+    {
+        // The Matter thread cannot drain the queue while the lock is held
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        for (uint16_t level = 1; level <= 10; ++level) {
+            esp_matter_attr_val_t val = esp_matter_uint16(level);
+            TEST_ASSERT_EQUAL(ESP_OK, attribute::update_async(endpoint_id, k_cluster_id, k_level_attribute_id, &val));
+        }
+        // The string is copied, the caller buffer can be reused right away
+        char name[] = "sensor";
+        esp_matter_attr_val_t val = esp_matter_char_str(name, strlen(name));
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::update_async(endpoint_id, k_cluster_id, k_name_attribute_id, &val));
+        memset(name, 0, sizeof(name));
+    }
+    wait_for_processed(get_processed_count(before) + 11);
+
+    attribute::async_stats_t after = get_async_stats();
+    TEST_ASSERT_EQUAL_UINT32(before.enqueued + 11, after.enqueued);
+    TEST_ASSERT_EQUAL_UINT32(before.coalesced + 9, after.coalesced);
+    TEST_ASSERT_EQUAL_UINT32(before.applied + 2, after.applied);
+    TEST_ASSERT_EQUAL_UINT32(before.dropped, after.dropped);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT16(11, after.high_watermark);
+
+    esp_matter_attr_val_t val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint_id, k_cluster_id, k_level_attribute_id, &val));
+    TEST_ASSERT_EQUAL_UINT16(10, val.val.u16);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint_id, k_cluster_id, k_name_attribute_id, &val));
+    TEST_ASSERT_EQUAL_STRING("sensor", (const char *)val.val.a.b);
+    free(val.val.a.b);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("update_async rejects updates when the queue is full", "[update_async]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = create_test_endpoint(node);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    attribute::async_stats_t before = get_async_stats();
+
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        for (uint16_t level = 1; level <= before.capacity; ++level) {
+            esp_matter_attr_val_t val = esp_matter_uint16(level);
+            TEST_ASSERT_EQUAL(ESP_OK, attribute::update_async(endpoint_id, k_cluster_id, k_level_attribute_id, &val));
+        }
+        TEST_ASSERT_EQUAL_UINT16(before.capacity, get_async_stats().depth);
+        esp_matter_attr_val_t val = esp_matter_uint16(0);
+        TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, attribute::update_async(endpoint_id, k_cluster_id, k_level_attribute_id,
+                                                                  &val));
+    }
+    wait_for_processed(get_processed_count(before) + before.capacity + 1);
+
+    attribute::async_stats_t after = get_async_stats();
+    TEST_ASSERT_EQUAL_UINT32(before.dropped + 1, after.dropped);
+    TEST_ASSERT_EQUAL_UINT16(0, after.depth);
+    esp_matter_attr_val_t val;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint_id, k_cluster_id, k_level_attribute_id, &val));
+    TEST_ASSERT_EQUAL_UINT16(before.capacity, val.val.u16);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("update_async drops updates of unknown attributes", "[update_async]")
+{
+    test::get_or_create_node();
+    test::start_matter_if_needed();
+    attribute::async_stats_t before = get_async_stats();
+
+    esp_matter_attr_val_t val = esp_matter_uint16(1);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::update_async(0xFFFE, k_cluster_id, k_level_attribute_id, &val));
+    wait_for_processed(get_processed_count(before) + 1);
+    TEST_ASSERT_EQUAL_UINT32(before.dropped + 1, get_async_stats().dropped);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::update_async(0, k_cluster_id, k_level_attribute_id, nullptr));
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <unity.h>
+#include <esp_matter_attr_data_buffer.h>
+#include <lib/core/TLV.h>
+
+using esp_matter::data_model::attribute_data_decode_buffer;
+
+static constexpr size_t k_tlv_buffer_size = 512;
+
+struct encoded_value_t {
+    uint8_t buffer[k_tlv_buffer_size];
+    chip::TLV::TLVReader reader;
+};
+
+static void encode_string(encoded_value_t &encoded, const char *str)
+{
+    chip::TLV::TLVWriter writer;
+    writer.Init(encoded.buffer, sizeof(encoded.buffer));
+    TEST_ASSERT_TRUE(writer.PutString(chip::TLV::AnonymousTag(), str) == CHIP_NO_ERROR);
+    encoded.reader.Init(encoded.buffer, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(encoded.reader.Next() == CHIP_NO_ERROR);
+}
+
+static void encode_bytes(encoded_value_t &encoded, const uint8_t *bytes, uint32_t len)
+{
+    chip::TLV::TLVWriter writer;
+    writer.Init(encoded.buffer, sizeof(encoded.buffer));
+    TEST_ASSERT_TRUE(writer.PutBytes(chip::TLV::AnonymousTag(), bytes, len) == CHIP_NO_ERROR);
+    encoded.reader.Init(encoded.buffer, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(encoded.reader.Next() == CHIP_NO_ERROR);
+}
+
+static void encode_null(encoded_value_t &encoded)
+{
+    chip::TLV::TLVWriter writer;
+    writer.Init(encoded.buffer, sizeof(encoded.buffer));
+    TEST_ASSERT_TRUE(writer.PutNull(chip::TLV::AnonymousTag()) == CHIP_NO_ERROR);
+    encoded.reader.Init(encoded.buffer, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(encoded.reader.Next() == CHIP_NO_ERROR);
+}
+
+TEST_CASE("strings are decoded into the scratch buffer in the ember format", "[write_decode]")
+{
+    encoded_value_t encoded;
+    encode_string(encoded, "kitchen");
+    uint8_t scratch[32];
+    attribute_data_decode_buffer data_buffer(ESP_MATTER_VAL_TYPE_CHAR_STRING, chip::MutableByteSpan(scratch));
+    TEST_ASSERT_TRUE(data_buffer.Decode(encoded.reader) == CHIP_NO_ERROR);
+
+    // The value points after the length prefix, still terminated for the callbacks reading a C string
+    esp_matter_attr_val_t &val = data_buffer.get_attr_val();
+    TEST_ASSERT_EQUAL_PTR(scratch + 1, val.val.a.b);
+    TEST_ASSERT_EQUAL_UINT16(7, val.val.a.s);
+    TEST_ASSERT_EQUAL_STRING("kitchen", (const char *)val.val.a.b);
+
+    chip::MutableByteSpan ember_view = data_buffer.get_ember_view();
+    TEST_ASSERT_EQUAL_PTR(scratch, ember_view.data());
+    TEST_ASSERT_EQUAL(8, ember_view.size());
+    TEST_ASSERT_EQUAL_UINT8(7, ember_view[0]);
+}
+
+TEST_CASE("long strings have a two bytes prefix", "[write_decode]")
+{
+    const uint8_t bytes[] = { 0x01, 0x02, 0x03 };
+    encoded_value_t encoded;
+    encode_bytes(encoded, bytes, sizeof(bytes));
+    uint8_t scratch[32];
+    attribute_data_decode_buffer data_buffer(ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING, chip::MutableByteSpan(scratch));
+    TEST_ASSERT_TRUE(data_buffer.Decode(encoded.reader) == CHIP_NO_ERROR);
+
+    esp_matter_attr_val_t &val = data_buffer.get_attr_val();
+    TEST_ASSERT_EQUAL_PTR(scratch + 2, val.val.a.b);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(bytes, val.val.a.b, sizeof(bytes));
+    chip::MutableByteSpan ember_view = data_buffer.get_ember_view();
+    TEST_ASSERT_EQUAL(2 + sizeof(bytes), ember_view.size());
+    TEST_ASSERT_EQUAL_UINT8(sizeof(bytes), ember_view[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, ember_view[1]);
+}
+
+TEST_CASE("strings larger than the scratch buffer are allocated", "[write_decode]")
+{
+    char str[64];
+    memset(str, 'a', sizeof(str) - 1);
+    str[sizeof(str) - 1] = 0;
+    encoded_value_t encoded;
+    encode_string(encoded, str);
+    uint8_t scratch[16];
+    attribute_data_decode_buffer data_buffer(ESP_MATTER_VAL_TYPE_CHAR_STRING, chip::MutableByteSpan(scratch));
+    TEST_ASSERT_TRUE(data_buffer.Decode(encoded.reader) == CHIP_NO_ERROR);
+
+    esp_matter_attr_val_t &val = data_buffer.get_attr_val();
+    TEST_ASSERT_TRUE(val.val.a.b < scratch || val.val.a.b >= scratch + sizeof(scratch));
+    TEST_ASSERT_EQUAL_STRING(str, (const char *)val.val.a.b);
+    TEST_ASSERT_TRUE(data_buffer.get_ember_view().empty());
+}
+
+TEST_CASE("null strings have the null length prefix", "[write_decode]")
+{
+    encoded_value_t encoded;
+    encode_null(encoded);
+    uint8_t scratch[16];
+    attribute_data_decode_buffer data_buffer(ESP_MATTER_VAL_TYPE_OCTET_STRING, chip::MutableByteSpan(scratch));
+    TEST_ASSERT_TRUE(data_buffer.Decode(encoded.reader) == CHIP_NO_ERROR);
+
+    esp_matter_attr_val_t &val = data_buffer.get_attr_val();
+    TEST_ASSERT_NULL(val.val.a.b);
+    TEST_ASSERT_EQUAL_UINT16(0xFF, val.val.a.s);
+    chip::MutableByteSpan ember_view = data_buffer.get_ember_view();
+    TEST_ASSERT_EQUAL(1, ember_view.size());
+    TEST_ASSERT_EQUAL_UINT8(0xFF, ember_view[0]);
+}
+
+TEST_CASE("numeric values have no ember view", "[write_decode]")
+{
+    chip::TLV::TLVWriter writer;
+    encoded_value_t encoded;
+    writer.Init(encoded.buffer, sizeof(encoded.buffer));
+    TEST_ASSERT_TRUE(writer.Put(chip::TLV::AnonymousTag(), (uint16_t)300) == CHIP_NO_ERROR);
+    encoded.reader.Init(encoded.buffer, writer.GetLengthWritten());
+    TEST_ASSERT_TRUE(encoded.reader.Next() == CHIP_NO_ERROR);
+
+    uint8_t scratch[16];
+    attribute_data_decode_buffer data_buffer(ESP_MATTER_VAL_TYPE_UINT16, chip::MutableByteSpan(scratch));
+    TEST_ASSERT_TRUE(data_buffer.Decode(encoded.reader) == CHIP_NO_ERROR);
+    TEST_ASSERT_EQUAL_UINT16(300, data_buffer.get_attr_val().val.u16);
+    TEST_ASSERT_TRUE(data_buffer.get_ember_view().empty());
+}
@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_boot_profile.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+
+#include "cluster_lifecycle_common.h"
+
+namespace esp_matter::attribute {
+esp_err_t store_val_in_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                           const esp_matter_attr_val_t &val);
+esp_err_t get_val_from_nvs(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                           esp_matter_attr_val_t &val);
+} // namespace esp_matter::attribute
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC0A;
+
+#if CONFIG_ESP_MATTER_BOOT_PROFILE
+TEST_CASE("boot profile records the phases", "[boot]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    // The node was built and the stack started before
+    boot_profile::phase_stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, boot_profile::get(boot_profile::PHASE_NODE_BUILD, &stats));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(stats.start_us, stats.end_us);
+    TEST_ASSERT_EQUAL(ESP_OK, boot_profile::get(boot_profile::PHASE_SERVER_INIT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(1, stats.count);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, stats.total_us);
+
+    // The init callbacks of the endpoints created after the start are counted too
+    TEST_ASSERT_EQUAL(ESP_OK, boot_profile::get(boot_profile::PHASE_PLUGIN_INIT, &stats));
+    uint32_t count = stats.count;
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::enable(endpoint));
+    TEST_ASSERT_EQUAL(ESP_OK, boot_profile::get(boot_profile::PHASE_PLUGIN_INIT, &stats));
+    TEST_ASSERT_EQUAL_UINT32(count + 1, stats.count);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+#endif // CONFIG_ESP_MATTER_BOOT_PROFILE
+
+#if CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
+static void wait_for_restore(attribute_t *attribute)
+{
+    for (int retry = 0; retry < 100 && attribute::is_restore_pending(attribute); ++retry) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+    }
+    TEST_ASSERT_FALSE(attribute::is_restore_pending(attribute));
+}
+
+TEST_CASE("attributes of background clusters are restored after creation", "[boot]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_background_restore(k_cluster_id));
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(endpoint_id, k_cluster_id, 0x0000, esp_matter_uint32(42)));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(endpoint_id, k_cluster_id, 0x0001, esp_matter_uint32(42)));
+
+    attribute_t *restored = nullptr;
+    attribute_t *updated = nullptr;
+    esp_matter_attr_val_t val = esp_matter_uint32(0);
+    {
+        // The restore runs on the Matter thread, it waits for the lock
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+        TEST_ASSERT_NOT_NULL(cluster);
+        restored = attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint32(1));
+        updated = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint32(1));
+        TEST_ASSERT_NOT_NULL(restored);
+        TEST_ASSERT_NOT_NULL(updated);
+
+        TEST_ASSERT_TRUE(attribute::is_restore_pending(restored));
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(restored, &val));
+        TEST_ASSERT_EQUAL_UINT32(1, val.val.u32);
+
+        // A value set before the restore is newer than the stored one
+        val = esp_matter_uint32(7);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(updated, &val, false));
+        TEST_ASSERT_FALSE(attribute::is_restore_pending(updated));
+    }
+
+    wait_for_restore(restored);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(restored, &val));
+    TEST_ASSERT_EQUAL_UINT32(42, val.val.u32);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(updated, &val));
+    TEST_ASSERT_EQUAL_UINT32(7, val.val.u32);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("background restore of several clusters stores the missing defaults", "[boot]")
+{
+    static constexpr uint32_t k_cluster_ids[] = { 0xFFF1FC0C, 0xFFF1FC0D };
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    attribute_t *restored[2] = {};
+    attribute_t *missing[2] = {};
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        for (size_t index = 0; index < 2; ++index) {
+            uint32_t cluster_id = k_cluster_ids[index];
+            TEST_ASSERT_EQUAL(ESP_OK, attribute::set_background_restore(cluster_id));
+            // Only the first attribute of each cluster has a stored value
+            TEST_ASSERT_EQUAL(ESP_OK, attribute::store_val_in_nvs(endpoint_id, cluster_id, 0x0000,
+                                                                  esp_matter_uint32(40 + index)));
+            cluster_t *cluster = cluster::create(endpoint, cluster_id, CLUSTER_FLAG_SERVER);
+            TEST_ASSERT_NOT_NULL(cluster);
+            restored[index] = attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint32(1));
+            missing[index] = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_NONVOLATILE, esp_matter_uint32(2));
+            TEST_ASSERT_NOT_NULL(restored[index]);
+            TEST_ASSERT_NOT_NULL(missing[index]);
+        }
+    }
+
+    // Both clusters are restored by the same steps, through the shared restore handle
+    for (size_t index = 0; index < 2; ++index) {
+        wait_for_restore(restored[index]);
+        wait_for_restore(missing[index]);
+    }
+    for (size_t index = 0; index < 2; ++index) {
+        uint32_t cluster_id = k_cluster_ids[index];
+        esp_matter_attr_val_t val = esp_matter_uint32(0);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(restored[index], &val));
+        TEST_ASSERT_EQUAL_UINT32(40 + index, val.val.u32);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(missing[index], &val));
+        TEST_ASSERT_EQUAL_UINT32(2, val.val.u32);
+
+        // The default value of the attribute that was not found is stored, as without the background restore
+        esp_matter_attr_val_t stored = esp_matter_uint32(0);
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val_from_nvs(endpoint_id, cluster_id, 0x0001, stored));
+        TEST_ASSERT_EQUAL_UINT32(2, stored.val.u32);
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+#endif // CONFIG_ESP_MATTER_NVS_BACKGROUND_RESTORE_CLUSTER_COUNT > 0
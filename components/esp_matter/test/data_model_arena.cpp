@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+#include <esp_matter_data_model_arena.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_iterations = 20;
+
+static arena::stats_t get_arena_stats()
+{
+    arena::stats_t stats;
+    TEST_ASSERT_EQUAL(ESP_OK, arena::get_stats(&stats));
+    return stats;
+}
+
+TEST_CASE("destroyed endpoint nodes are released and reused", "[arena]")
+{
+    node_t *node = test::get_or_create_node();
+    arena::stats_t before = get_arena_stats();
+
+    endpoint::extended_color_light::config_t light_config;
+    endpoint_t *light = endpoint::extended_color_light::create(node, &light_config, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(light);
+    arena::stats_t created = get_arena_stats();
+    TEST_ASSERT_GREATER_THAN_UINT32(before.node_count, created.node_count);
+    TEST_ASSERT_GREATER_THAN_UINT32(before.node_bytes, created.node_bytes);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, light));
+    arena::stats_t destroyed = get_arena_stats();
+    TEST_ASSERT_EQUAL_UINT32(before.node_count, destroyed.node_count);
+    TEST_ASSERT_EQUAL_UINT32(before.node_bytes, destroyed.node_bytes);
+
+    // The same endpoint again fits in the nodes freed above, no new slab is needed
+    light = endpoint::extended_color_light::create(node, &light_config, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(light);
+    TEST_ASSERT_EQUAL_UINT32(destroyed.slab_count, get_arena_stats().slab_count);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, light));
+}
+
+TEST_CASE("data model traversal cost", "[arena][benchmark]")
+{
+    node_t *node = test::get_or_create_node();
+    endpoint::extended_color_light::config_t light_config;
+    endpoint_t *light = endpoint::extended_color_light::create(node, &light_config, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(light);
+
+    uint32_t attribute_count = 0;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+        for (endpoint_t *endpoint = endpoint::get_first(node); endpoint; endpoint = endpoint::get_next(endpoint)) {
+            for (cluster_t *cluster = cluster::get_first(endpoint); cluster; cluster = cluster::get_next(cluster)) {
+                for (attribute_t *attribute = attribute::get_first(cluster); attribute;
+                        attribute = attribute::get_next(attribute)) {
+                    attribute_count++;
+                }
+            }
+        }
+    }
+    int64_t elapsed_us = esp_timer_get_time() - start;
+    arena::stats_t stats = get_arena_stats();
+    printf("attributes: %" PRIu32 ", us per walk: %" PRId64 ", nodes: %" PRIu32 " (%" PRIu32 " bytes), slabs: %" PRIu32
+           " (%" PRIu32 " bytes)\n", attribute_count / k_iterations, elapsed_us / k_iterations, stats.node_count,
+           stats.node_bytes, stats.slab_count, stats.slab_bytes);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, light));
+}
+
+typedef endpoint_t *(*create_device_t)(node_t *node);
+
+template <typename config_t, endpoint_t *(*create)(node_t *, config_t *, uint8_t, void *)>
+static endpoint_t *create_device(node_t *node)
+{
+    config_t config;
+    return create(node, &config, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+}
+
+static void report_device_ram(node_t *node, const char *name, create_device_t create)
+{
+    arena::stats_t before = get_arena_stats();
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    endpoint_t *endpoint = create(node);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    arena::stats_t created = get_arena_stats();
+    size_t free_created = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+
+    uint32_t attribute_count = 0;
+    uint32_t managed_attribute_count = 0;
+    uint32_t command_count = 0;
+    for (cluster_t *cluster = cluster::get_first(endpoint); cluster; cluster = cluster::get_next(cluster)) {
+        for (attribute_t *attribute = attribute::get_first(cluster); attribute;
+                attribute = attribute::get_next(attribute)) {
+            attribute_count++;
+            if (!(attribute::get_flags(attribute) & ATTRIBUTE_FLAG_MANAGED_INTERNALLY)) {
+                managed_attribute_count++;
+            }
+        }
+        for (command_t *command = command::get_first(cluster); command; command = command::get_next(command)) {
+            command_count++;
+        }
+    }
+    // Bytes no longer in RAM on 32-bit targets: the id, flags and callback of each command are in its descriptor in
+    // flash, the endpoint and cluster ids of each attribute managed by esp-matter come from its parent cluster
+    uint32_t saved_bytes = command_count * 8 + managed_attribute_count * 4;
+    printf("%s: nodes: %" PRIu32 " bytes, heap: %u bytes, attributes: %" PRIu32 " (%" PRIu32 " esp-matter managed), "
+           "commands: %" PRIu32 ", saved: ~%" PRIu32 " bytes\n", name, created.node_bytes - before.node_bytes,
+           (unsigned)(free_before - free_created), attribute_count, managed_attribute_count, command_count,
+           saved_bytes);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("data model RAM per device type", "[arena][benchmark]")
+{
+    node_t *node = test::get_or_create_node();
+    report_device_ram(node, "on_off_light",
+                      create_device<endpoint::on_off_light::config_t, endpoint::on_off_light::create>);
+    report_device_ram(node, "dimmable_light",
+                      create_device<endpoint::dimmable_light::config_t, endpoint::dimmable_light::create>);
+    report_device_ram(node, "extended_color_light",
+                      create_device<endpoint::extended_color_light::config_t, endpoint::extended_color_light::create>);
+    report_device_ram(node, "temperature_sensor",
+                      create_device<endpoint::temperature_sensor::config_t, endpoint::temperature_sensor::create>);
+}
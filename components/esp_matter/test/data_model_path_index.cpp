@@ -0,0 +1,134 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_timer.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+
+#include "cluster_lifecycle_common.h"
+
+namespace esp_matter::attribute {
+esp_err_t destroy(cluster_t *cluster, attribute_t *attribute);
+} // namespace esp_matter::attribute
+
+namespace esp_matter::command {
+esp_err_t destroy(cluster_t *cluster, command_t *command);
+} // namespace esp_matter::command
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC01;
+static constexpr uint32_t k_attribute_count = 16;
+static constexpr uint32_t k_lookup_iterations = 2000;
+
+static endpoint_t *create_indexed_endpoint(node_t *node)
+{
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    // Create the attributes in reverse order so the index has to keep them sorted.
+    for (uint32_t index = k_attribute_count; index > 0; --index) {
+        TEST_ASSERT_NOT_NULL(attribute::create(cluster, index, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(index)));
+    }
+    return endpoint;
+}
+
+TEST_CASE("path index finds endpoint, cluster and attribute", "[path_index]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = create_indexed_endpoint(node);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+
+    TEST_ASSERT_EQUAL_PTR(endpoint, endpoint::get(endpoint_id));
+    cluster_t *cluster = cluster::get(endpoint_id, k_cluster_id);
+    TEST_ASSERT_NOT_NULL(cluster);
+    for (uint32_t index = 1; index <= k_attribute_count; ++index) {
+        attribute_t *attribute = attribute::get(endpoint_id, k_cluster_id, index);
+        TEST_ASSERT_NOT_NULL(attribute);
+        TEST_ASSERT_EQUAL_UINT32(index, attribute::get_id(attribute));
+    }
+    TEST_ASSERT_NULL(attribute::get(endpoint_id, k_cluster_id, k_attribute_count + 1));
+
+    // The index is kept in sync when an attribute and a cluster are destroyed
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::destroy(cluster, attribute::get(cluster, 1)));
+    TEST_ASSERT_NULL(attribute::get(cluster, 1));
+    TEST_ASSERT_NOT_NULL(attribute::get(cluster, 2));
+    TEST_ASSERT_EQUAL(ESP_OK, cluster::destroy(cluster));
+    TEST_ASSERT_NULL(cluster::get(endpoint_id, k_cluster_id));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+    TEST_ASSERT_NULL(endpoint::get(endpoint_id));
+}
+
+TEST_CASE("path index dispatches accepted commands", "[path_index]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    // A generated command with the id of an accepted one must not be found by the dispatch lookup
+    TEST_ASSERT_NOT_NULL(command::create(cluster, 0x02, COMMAND_FLAG_GENERATED, nullptr));
+    for (uint32_t command_id = 4; command_id > 0; --command_id) {
+        TEST_ASSERT_NOT_NULL(command::create(cluster, command_id, COMMAND_FLAG_ACCEPTED, nullptr));
+    }
+
+    for (uint32_t command_id = 1; command_id <= 4; ++command_id) {
+        command_t *command = command::get(cluster, command_id, COMMAND_FLAG_ACCEPTED);
+        TEST_ASSERT_NOT_NULL(command);
+        TEST_ASSERT_EQUAL_UINT32(command_id, command::get_id(command));
+        TEST_ASSERT_TRUE(command::get_flags(command) & COMMAND_FLAG_ACCEPTED);
+    }
+    TEST_ASSERT_NULL(command::get(cluster, 0x05, COMMAND_FLAG_ACCEPTED));
+    command_t *generated = command::get(cluster, 0x02, COMMAND_FLAG_GENERATED);
+    TEST_ASSERT_NOT_NULL(generated);
+    TEST_ASSERT_EQUAL_UINT16(COMMAND_FLAG_GENERATED, command::get_flags(generated));
+
+    // Destroying the generated command keeps the accepted one indexed
+    TEST_ASSERT_EQUAL(ESP_OK, command::destroy(cluster, generated));
+    TEST_ASSERT_NOT_NULL(command::get(cluster, 0x02, COMMAND_FLAG_ACCEPTED));
+    TEST_ASSERT_EQUAL(ESP_OK, command::destroy(cluster, command::get(cluster, 0x02, COMMAND_FLAG_ACCEPTED)));
+    TEST_ASSERT_NULL(command::get(cluster, 0x02, COMMAND_FLAG_ACCEPTED));
+    TEST_ASSERT_NOT_NULL(command::get(cluster, 0x03, COMMAND_FLAG_ACCEPTED));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("path index lookup cost versus endpoint count", "[path_index][benchmark]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    uint16_t available = CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT - endpoint::get_count(node);
+    TEST_ASSERT_GREATER_THAN(0, available);
+    endpoint_t *endpoints[CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT] = {};
+
+    printf("endpoints, ns per attribute::get(endpoint_id, cluster_id, attribute_id)\n");
+    for (uint16_t count = 0; count < available; ++count) {
+        endpoints[count] = create_indexed_endpoint(node);
+        // Lookup the most recently created endpoint, this was the worst case for the linked list walk.
+        uint16_t endpoint_id = endpoint::get_id(endpoints[count]);
+        int64_t start = esp_timer_get_time();
+        for (uint32_t iteration = 0; iteration < k_lookup_iterations; ++iteration) {
+            uint32_t attribute_id = (iteration % k_attribute_count) + 1;
+            TEST_ASSERT_NOT_NULL(attribute::get(endpoint_id, k_cluster_id, attribute_id));
+        }
+        int64_t elapsed_us = esp_timer_get_time() - start;
+        printf("%u, %" PRId64 "\n", endpoint::get_count(node), (elapsed_us * 1000) / k_lookup_iterations);
+    }
+
+    for (uint16_t count = 0; count < available; ++count) {
+        TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoints[count]));
+    }
+}
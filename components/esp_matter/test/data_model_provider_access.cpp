@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_timer.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_data_model.h>
+#include <esp_matter_data_model_provider.h>
+
+#include <app/data-model-provider/MetadataTypes.h>
+#include <lib/support/ReadOnlyBuffer.h>
+#include <lib/support/Span.h>
+#include <private/esp_matter_cluster_metadata.h>
+#include <private/esp_matter_data_model_priv.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+using namespace chip::app::Clusters;
+using chip::app::ConcreteClusterPath;
+using chip::app::DataModel::AcceptedCommandEntry;
+using chip::app::DataModel::AttributeEntry;
+
+static constexpr uint32_t k_iterations = 20;
+
+static std::optional<AttributeEntry> find_attribute_entry(uint16_t endpoint_id, uint32_t cluster_id,
+                                                          uint32_t attribute_id)
+{
+    chip::ReadOnlyBufferBuilder<AttributeEntry> builder;
+    TEST_ASSERT_TRUE(data_model::provider::get_instance()
+                     .Attributes(ConcreteClusterPath(endpoint_id, cluster_id), builder) == CHIP_NO_ERROR);
+    for (const AttributeEntry &entry : builder.TakeBuffer()) {
+        if (entry.attributeId == attribute_id) {
+            return entry;
+        }
+    }
+    return std::nullopt;
+}
+
+TEST_CASE("provider reports the generated access privileges", "[provider_access]")
+{
+    test::get_or_create_node();
+    test::start_matter_if_needed();
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+
+    std::optional<AttributeEntry> acl = find_attribute_entry(0, AccessControl::Id, AccessControl::Attributes::Acl::Id);
+    TEST_ASSERT_TRUE(acl.has_value());
+    TEST_ASSERT_TRUE(acl->GetReadPrivilege() == chip::Access::Privilege::kAdminister);
+
+    std::optional<AttributeEntry> node_label =
+        find_attribute_entry(0, BasicInformation::Id, BasicInformation::Attributes::NodeLabel::Id);
+    TEST_ASSERT_TRUE(node_label.has_value());
+    TEST_ASSERT_TRUE(node_label->GetReadPrivilege() == chip::Access::Privilege::kView);
+    TEST_ASSERT_TRUE(node_label->GetWritePrivilege() == chip::Access::Privilege::kManage);
+}
+
+static bool has_accepted_command(uint16_t endpoint_id, uint32_t cluster_id, uint32_t command_id)
+{
+    chip::ReadOnlyBufferBuilder<AcceptedCommandEntry> builder;
+    TEST_ASSERT_TRUE(data_model::provider::get_instance()
+                     .AcceptedCommands(ConcreteClusterPath(endpoint_id, cluster_id), builder) == CHIP_NO_ERROR);
+    for (const AcceptedCommandEntry &entry : builder.TakeBuffer()) {
+        if (entry.commandId == command_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_CASE("provider metadata follows attribute and command changes", "[provider_access]")
+{
+    static constexpr uint32_t k_cluster_id = 0xFFF1FC04;
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_NONE, esp_matter_uint8(0)));
+
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_TRUE(find_attribute_entry(endpoint_id, k_cluster_id, 0x0000).has_value());
+        TEST_ASSERT_FALSE(find_attribute_entry(endpoint_id, k_cluster_id, 0x0001).has_value());
+        TEST_ASSERT_FALSE(has_accepted_command(endpoint_id, k_cluster_id, 0x00));
+
+        // The metadata built by the queries above must not hide the new elements
+        attribute_t *attribute = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_WRITABLE, esp_matter_uint8(0));
+        TEST_ASSERT_NOT_NULL(attribute);
+        command_t *command = command::create(cluster, 0x00, COMMAND_FLAG_ACCEPTED, nullptr);
+        TEST_ASSERT_NOT_NULL(command);
+        std::optional<AttributeEntry> entry = find_attribute_entry(endpoint_id, k_cluster_id, 0x0001);
+        TEST_ASSERT_TRUE(entry.has_value());
+        TEST_ASSERT_TRUE(entry->GetWritePrivilege().has_value());
+        TEST_ASSERT_TRUE(has_accepted_command(endpoint_id, k_cluster_id, 0x00));
+
+        TEST_ASSERT_EQUAL(ESP_OK, attribute::destroy(cluster, attribute));
+        TEST_ASSERT_EQUAL(ESP_OK, command::destroy(cluster, command));
+        TEST_ASSERT_FALSE(find_attribute_entry(endpoint_id, k_cluster_id, 0x0001).has_value());
+        TEST_ASSERT_FALSE(has_accepted_command(endpoint_id, k_cluster_id, 0x00));
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("provider metadata stays valid until the Matter event ends", "[provider_access]")
+{
+    static constexpr uint32_t k_cluster_id = 0xFFF1FC05;
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_NONE, esp_matter_uint8(0)));
+
+    {
+        // Holding the lock keeps the Matter context from running, as during a provider call
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        TEST_ASSERT_TRUE(find_attribute_entry(endpoint_id, k_cluster_id, 0x0000).has_value());
+        cluster::metadata_cache_t *cache = cluster::get_metadata_cache(cluster);
+        TEST_ASSERT_NOT_NULL(cache);
+        size_t attribute_count = cache->attributes.size();
+
+        cluster::invalidate_metadata_cache(cluster);
+        TEST_ASSERT_NULL(cluster::get_metadata_cache(cluster));
+        // The dropped snapshot is freed from the Matter context, so it is still readable here
+        TEST_ASSERT_EQUAL(attribute_count, cache->attributes.size());
+        bool found = false;
+        for (const AttributeEntry &entry : cache->attributes) {
+            found = found || entry.attributeId == 0x0000;
+        }
+        TEST_ASSERT_TRUE(found);
+    }
+    // Let the Matter context free the dropped snapshot
+    vTaskDelay(pdMS_TO_TICKS(50));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+TEST_CASE("provider metadata cost for the whole node", "[provider_access][benchmark]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+
+    endpoint::extended_color_light::config_t light_config;
+    endpoint_t *light = endpoint::extended_color_light::create(node, &light_config, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(light);
+
+    uint32_t cluster_count = 0;
+    int64_t elapsed_us = 0;
+    {
+        lock::ScopedChipStackLock lock(portMAX_DELAY);
+        auto &provider = data_model::provider::get_instance();
+        for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+            // Same walk as a wildcard read of the node: every attribute and command of every cluster
+            int64_t start = esp_timer_get_time();
+            for (endpoint_t *endpoint = endpoint::get_first(node); endpoint; endpoint = endpoint::get_next(endpoint)) {
+                uint16_t endpoint_id = endpoint::get_id(endpoint);
+                for (cluster_t *cluster = cluster::get_first(endpoint); cluster; cluster = cluster::get_next(cluster)) {
+                    if (!(cluster::get_flags(cluster) & CLUSTER_FLAG_SERVER)) {
+                        continue;
+                    }
+                    ConcreteClusterPath path(endpoint_id, cluster::get_id(cluster));
+                    chip::ReadOnlyBufferBuilder<AttributeEntry> attributes;
+                    chip::ReadOnlyBufferBuilder<AcceptedCommandEntry> commands;
+                    TEST_ASSERT_TRUE(provider.Attributes(path, attributes) == CHIP_NO_ERROR);
+                    TEST_ASSERT_TRUE(provider.AcceptedCommands(path, commands) == CHIP_NO_ERROR);
+                    if (iteration == 0) {
+                        cluster_count++;
+                    }
+                }
+            }
+            elapsed_us += esp_timer_get_time() - start;
+        }
+    }
+    printf("clusters: %" PRIu32 ", us per node walk: %" PRId64 "\n", cluster_count, elapsed_us / k_iterations);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, light));
+}
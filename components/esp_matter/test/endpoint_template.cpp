@@ -0,0 +1,150 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstring>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+
+#include "cluster_lifecycle_common.h"
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC0A;
+static constexpr uint32_t k_other_cluster_id = 0xFFF1FC0B;
+static constexpr uint32_t k_device_type_id = 0xFFF10001;
+static constexpr uint32_t k_command_id = 0x0001;
+static constexpr uint32_t k_dynamic_command_id = 0x0002;
+static constexpr uint32_t k_event_id = 0x0000;
+
+static esp_err_t template_command_callback(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
+                                           void *opaque_ptr)
+{
+    return ESP_OK;
+}
+
+static esp_err_t template_user_callback(const ConcreteCommandPath &command_path, TLVReader &tlv_data,
+                                        void *opaque_ptr)
+{
+    return ESP_OK;
+}
+
+static endpoint_t *create_template_source(node_t *node)
+{
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::add_device_type(endpoint, k_device_type_id, 2));
+
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    attribute_t *level = attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_WRITABLE, esp_matter_uint8(3));
+    TEST_ASSERT_NOT_NULL(level);
+    TEST_ASSERT_EQUAL(ESP_OK, (attribute::add_bounds<uint8_t, 1, 5>(level)));
+    attribute_t *temperature = attribute::create(cluster, 0x0001, ATTRIBUTE_FLAG_NONE, esp_matter_int16(100));
+    TEST_ASSERT_NOT_NULL(temperature);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::add_bounds(temperature, esp_matter_int16(-500), esp_matter_int16(500)));
+    const char *label = "a label longer than the inline buffer";
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, 0x0002, ATTRIBUTE_FLAG_WRITABLE,
+                                           esp_matter_char_str((char *)label, strlen(label)), 64));
+
+    command_t *command = command::create<k_command_id, COMMAND_FLAG_ACCEPTED, template_command_callback>(cluster);
+    TEST_ASSERT_NOT_NULL(command);
+    command::set_user_callback(command, template_user_callback);
+    TEST_ASSERT_NOT_NULL(command::create(cluster, k_dynamic_command_id, COMMAND_FLAG_ACCEPTED,
+                                         template_command_callback));
+    TEST_ASSERT_NOT_NULL(event::create(cluster, k_event_id));
+    return endpoint;
+}
+
+TEST_CASE("endpoint template creates the clusters of the source endpoint", "[template]")
+{
+    node_t *node = test::get_or_create_node();
+    endpoint_t *source = create_template_source(node);
+    endpoint_template_t *endpoint_template = endpoint::capture_template(source);
+    TEST_ASSERT_NOT_NULL(endpoint_template);
+
+    // The template does not depend on the source endpoint, nor on its heap bounds
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, source));
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::apply_template(endpoint, endpoint_template));
+
+    TEST_ASSERT_EQUAL(1, endpoint::get_device_type_count(endpoint));
+    uint32_t device_type_id = 0;
+    uint8_t device_type_version = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::get_device_type_at_index(endpoint, 0, device_type_id, device_type_version));
+    TEST_ASSERT_EQUAL_UINT32(k_device_type_id, device_type_id);
+    TEST_ASSERT_EQUAL_UINT8(2, device_type_version);
+
+    cluster_t *cluster = cluster::get(endpoint, k_cluster_id);
+    TEST_ASSERT_NOT_NULL(cluster);
+    esp_matter_attr_val_t val;
+    attribute_t *level = attribute::get(cluster, 0x0000);
+    TEST_ASSERT_NOT_NULL(level);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(level, &val));
+    TEST_ASSERT_EQUAL_UINT8(3, val.val.u8);
+    val = esp_matter_uint8(6);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, attribute::set_val(level, &val, false));
+
+    attribute_t *temperature = attribute::get(cluster, 0x0001);
+    TEST_ASSERT_NOT_NULL(temperature);
+    TEST_ASSERT_TRUE(attribute::get_flags(temperature) & ATTRIBUTE_FLAG_MIN_MAX);
+    esp_matter_attr_bounds_t bounds;
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_bounds(temperature, &bounds));
+    TEST_ASSERT_EQUAL_INT16(-500, bounds.min.val.i16);
+    TEST_ASSERT_EQUAL_INT16(500, bounds.max.val.i16);
+
+    attribute_t *label = attribute::get(cluster, 0x0002);
+    TEST_ASSERT_NOT_NULL(label);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(label, &val));
+    TEST_ASSERT_EQUAL(strlen("a label longer than the inline buffer"), val.val.a.s);
+    TEST_ASSERT_EQUAL_MEMORY("a label longer than the inline buffer", val.val.a.b, val.val.a.s);
+
+    command_t *command = command::get(cluster, k_command_id, COMMAND_FLAG_ACCEPTED);
+    TEST_ASSERT_NOT_NULL(command);
+    TEST_ASSERT_EQUAL_PTR(template_user_callback, command::get_user_callback(command));
+    TEST_ASSERT_NOT_NULL(command::get(cluster, k_dynamic_command_id, COMMAND_FLAG_ACCEPTED));
+    TEST_ASSERT_NOT_NULL(event::get(cluster, k_event_id));
+
+    // The values of the endpoints built from the template are their own
+    val = esp_matter_uint8(4);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(level, &val, false));
+    endpoint_t *other = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(other);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::apply_template(other, endpoint_template));
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(attribute::get(cluster::get(other, k_cluster_id), 0x0000), &val));
+    TEST_ASSERT_EQUAL_UINT8(3, val.val.u8);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, other));
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy_template(endpoint_template));
+}
+
+TEST_CASE("endpoint template keeps the clusters the endpoint already has", "[template]")
+{
+    node_t *node = test::get_or_create_node();
+    endpoint_t *source = create_template_source(node);
+    endpoint_template_t *endpoint_template = endpoint::capture_template(source);
+    TEST_ASSERT_NOT_NULL(endpoint_template);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, source));
+
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::add_device_type(endpoint, k_device_type_id, 2));
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_NOT_NULL(cluster::create(endpoint, k_other_cluster_id, CLUSTER_FLAG_SERVER));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::apply_template(endpoint, endpoint_template));
+    TEST_ASSERT_EQUAL(1, endpoint::get_device_type_count(endpoint));
+    TEST_ASSERT_EQUAL_PTR(cluster, cluster::get(endpoint, k_cluster_id));
+    TEST_ASSERT_NULL(attribute::get(cluster, 0x0000));
+    TEST_ASSERT_NOT_NULL(cluster::get(endpoint, k_other_cluster_id));
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy_template(endpoint_template));
+}
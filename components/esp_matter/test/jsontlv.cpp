@@ -6,6 +6,9 @@
 
 #include <cJSON.h>
 #include <esp_err.h>
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+#include <inttypes.h>
 #include <json_to_tlv.h>
 #include <lib/core/TLV.h>
 #include <string.h>
@@ -72,6 +75,50 @@ static void expect_json_to_tlv_failure(const char *input_json)
 
     esp_err_t err = esp_matter::json_to_tlv(input_json, writer, chip::TLV::AnonymousTag());
     TEST_ASSERT_TRUE(err != ESP_OK);
+
+    writer.Init(buffer, sizeof(buffer));
+    err = esp_matter::json_to_tlv_stream(input_json, strlen(input_json), writer, chip::TLV::AnonymousTag());
+    TEST_ASSERT_TRUE(err != ESP_OK);
+}
+
+// Checks that the streaming converters give the TLV and the text of the cJSON ones
+static void expect_stream_matches(const char *input_json, const esp_matter::tlv_to_json_options &options)
+{
+    uint8_t tree_tlv[k_tlv_buffer_size] = { 0 };
+    chip::TLV::TLVWriter writer;
+    writer.Init(tree_tlv, sizeof(tree_tlv));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::json_to_tlv(input_json, writer, chip::TLV::AnonymousTag()));
+    uint32_t tree_tlv_len = writer.GetLengthWritten();
+
+    uint8_t stream_tlv[k_tlv_buffer_size] = { 0 };
+    writer.Init(stream_tlv, sizeof(stream_tlv));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::json_to_tlv_stream(input_json, strlen(input_json), writer,
+                                                              chip::TLV::AnonymousTag()));
+    TEST_ASSERT_EQUAL_UINT32(tree_tlv_len, writer.GetLengthWritten());
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(tree_tlv, stream_tlv, tree_tlv_len);
+
+    chip::TLV::TLVReader reader;
+    reader.Init(tree_tlv, tree_tlv_len);
+    cJSON *json = nullptr;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::tlv_to_json(reader, &json, options));
+    char *tree_printed = cJSON_PrintUnformatted(json);
+    TEST_ASSERT_NOT_NULL(tree_printed);
+
+    char stream_printed[k_tlv_buffer_size];
+    size_t stream_printed_len = 0;
+    reader.Init(tree_tlv, tree_tlv_len);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::tlv_to_json(reader, stream_printed, sizeof(stream_printed),
+                                                      &stream_printed_len, options));
+    TEST_ASSERT_EQUAL_STRING(tree_printed, stream_printed);
+    TEST_ASSERT_EQUAL(strlen(tree_printed), stream_printed_len);
+
+    cJSON_free(tree_printed);
+    cJSON_Delete(json);
+}
+
+static void expect_stream_matches(const char *input_json)
+{
+    expect_stream_matches(input_json, esp_matter::tlv_to_json_options {});
 }
 
 TEST_CASE("jsontlv roundtrip scalar values", "[jsontlv][roundtrip]")
@@ -253,3 +300,194 @@ TEST_CASE("jsontlv rejects invalid numeric boundaries", "[jsontlv][invalid]")
     expect_json_to_tlv_failure(R"({"1:U32":1.5})");
     expect_json_to_tlv_failure(R"({"1:I32":2147483648})");
 }
+
+TEST_CASE("jsontlv streaming converters match the cJSON ones", "[jsontlv][stream]")
+{
+    expect_stream_matches(R"({"5:STR":"chip","2:I16":-1234,"4:BOOL":true,"1:U8":42,"3:NULL":null})");
+    expect_stream_matches(R"({"2:OBJ":{"4:BOOL":false,"1:U8":7},"1:ARR-U8":[3,1,2]})");
+    expect_stream_matches(R"({"1:BYT":"AQID","2:FP":"INF","3:DFP":"-INF","4:FP":1.5,"5:DFP":0.1})");
+    expect_stream_matches(R"({"1:I64":"-1234567890123456789","2:U64":"12345678901234567890","3:I32":-2147483648})");
+    expect_stream_matches(R"({"9:OBJ":{"3:STR":"c","1:STR":"a","2:STR":"b"},"2:U8":2,"1:U8":1,"7:ARR-STR":[]})");
+    expect_stream_matches(R"({"2:ARR-OBJ":[{"2:U8":2,"1:U8":1},{"1:U8":3}],"1:ARR-?":[]})");
+    expect_stream_matches(" { \"1:STR\" : \"a\\\"b\\\\c\\n\\u00e9\\ud83d\\ude00\\u0001\" } ");
+
+    esp_matter::tlv_to_json_options options;
+    options.human_readable_bytes = true;
+    expect_stream_matches(R"({"1:BYT":"bWF0dGVyMV8y","2:BYT":"AQID","3:BYT":""})", options);
+}
+
+static esp_err_t count_chunk(const char *chunk, size_t len, void *ctx)
+{
+    TEST_ASSERT_TRUE(len > 0 && len <= 128);
+    size_t *total_len = static_cast<size_t *>(ctx);
+    *total_len += len;
+    return ESP_OK;
+}
+
+static esp_err_t reject_chunk(const char *chunk, size_t len, void *ctx)
+{
+    return ESP_FAIL;
+}
+
+TEST_CASE("jsontlv streams long payloads in chunks", "[jsontlv][stream]")
+{
+    // 300 bytes encoded in base64, longer than a chunk
+    char input_json[512] = R"({"1:BYT":")";
+    size_t input_len = strlen(input_json);
+    for (int i = 0; i < 100; ++i) {
+        memcpy(&input_json[input_len], "AQID", 4);
+        input_len += 4;
+    }
+    strcpy(&input_json[input_len], R"("})");
+    expect_stream_matches(input_json);
+
+    uint8_t tlv[k_tlv_buffer_size] = { 0 };
+    chip::TLV::TLVWriter writer;
+    writer.Init(tlv, sizeof(tlv));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::json_to_tlv_stream(input_json, strlen(input_json), writer,
+                                                              chip::TLV::AnonymousTag()));
+
+    chip::TLV::TLVReader reader;
+    reader.Init(tlv, writer.GetLengthWritten());
+    size_t total_len = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter::tlv_to_json_stream(reader, count_chunk, &total_len, {}));
+    TEST_ASSERT_EQUAL(strlen(input_json), total_len);
+
+    reader.Init(tlv, writer.GetLengthWritten());
+    TEST_ASSERT_EQUAL(ESP_FAIL, esp_matter::tlv_to_json_stream(reader, reject_chunk, nullptr, {}));
+
+    // The buffer is left empty when the text does not fit
+    char printed[64];
+    size_t printed_len = 1;
+    reader.Init(tlv, writer.GetLengthWritten());
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, esp_matter::tlv_to_json(reader, printed, sizeof(printed), &printed_len, {}));
+    TEST_ASSERT_EQUAL_STRING("", printed);
+    TEST_ASSERT_EQUAL(0, printed_len);
+}
+
+TEST_CASE("jsontlv stream rejects malformed json", "[jsontlv][invalid]")
+{
+    expect_json_to_tlv_failure(R"({"1:U8":1,})");
+    expect_json_to_tlv_failure(R"({"1:U8":1)");
+    expect_json_to_tlv_failure(R"({"1:STR":"abc})");
+    expect_json_to_tlv_failure(R"({"1:ARR-U8":[1,2})");
+    expect_json_to_tlv_failure(R"({"1:STR":"\x"})");
+    expect_json_to_tlv_failure("[1]");
+
+    // Nesting is bounded by the stream converter
+    char input_json[40 * 8 + 3] = "{";
+    for (int i = 0; i < 40; ++i) {
+        strcat(input_json, R"("1:OBJ":{)");
+    }
+    for (int i = 0; i < 41; ++i) {
+        strcat(input_json, "}");
+    }
+    uint8_t buffer[k_tlv_buffer_size] = { 0 };
+    chip::TLV::TLVWriter writer;
+    writer.Init(buffer, sizeof(buffer));
+    TEST_ASSERT_TRUE(esp_matter::json_to_tlv_stream(input_json, strlen(input_json), writer,
+                                                    chip::TLV::AnonymousTag()) != ESP_OK);
+}
+
+static size_t s_cjson_in_use;
+static size_t s_cjson_peak;
+
+static void *counting_malloc(size_t size)
+{
+    size_t *block = static_cast<size_t *>(malloc(sizeof(size_t) + size));
+    if (!block) {
+        return nullptr;
+    }
+    *block = size;
+    s_cjson_in_use += size;
+    s_cjson_peak = s_cjson_in_use > s_cjson_peak ? s_cjson_in_use : s_cjson_peak;
+    return block + 1;
+}
+
+static void counting_free(void *ptr)
+{
+    if (ptr) {
+        size_t *block = static_cast<size_t *>(ptr) - 1;
+        s_cjson_in_use -= *block;
+        free(block);
+    }
+}
+
+static size_t s_stream_min_free;
+
+static esp_err_t sample_heap_chunk(const char *chunk, size_t len, void *ctx)
+{
+    size_t free_size = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    s_stream_min_free = free_size < s_stream_min_free ? free_size : s_stream_min_free;
+    return ESP_OK;
+}
+
+TEST_CASE("jsontlv streaming cost versus cJSON", "[jsontlv][benchmark]")
+{
+    static constexpr uint32_t k_iterations = 20;
+    // A scan result of fifteen networks, as received by the controller
+    char input_json[1536] = R"({"0:U8":0,"2:ARR-OBJ":[)";
+    for (int i = 0; i < 15; ++i) {
+        strcat(input_json, R"({"5:I8":-33,"4:U8":0,"3:U16":1,"2:BYT":"yH9UcuKw","1:BYT":"bWF0dGVyMV8y"},)");
+    }
+    input_json[strlen(input_json) - 1] = 0;
+    strcat(input_json, "]}");
+    size_t input_len = strlen(input_json);
+
+    uint8_t tlv[k_tlv_buffer_size] = { 0 };
+    chip::TLV::TLVWriter writer;
+    chip::TLV::TLVReader reader;
+
+    cJSON_Hooks hooks = { counting_malloc, counting_free };
+    cJSON_InitHooks(&hooks);
+    s_cjson_peak = 0;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+        writer.Init(tlv, sizeof(tlv));
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter::json_to_tlv(input_json, writer, chip::TLV::AnonymousTag()));
+    }
+    int64_t tree_encode_us = (esp_timer_get_time() - start) / k_iterations;
+    size_t tree_encode_peak = s_cjson_peak;
+    uint32_t tlv_len = writer.GetLengthWritten();
+
+    s_cjson_peak = 0;
+    start = esp_timer_get_time();
+    for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+        reader.Init(tlv, tlv_len);
+        cJSON *json = nullptr;
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter::tlv_to_json(reader, &json));
+        char *printed = cJSON_PrintUnformatted(json);
+        TEST_ASSERT_NOT_NULL(printed);
+        cJSON_free(printed);
+        cJSON_Delete(json);
+    }
+    int64_t tree_decode_us = (esp_timer_get_time() - start) / k_iterations;
+    size_t tree_decode_peak = s_cjson_peak;
+    cJSON_InitHooks(nullptr);
+
+    size_t free_before = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    start = esp_timer_get_time();
+    for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+        writer.Init(tlv, sizeof(tlv));
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter::json_to_tlv_stream(input_json, input_len, writer,
+                                                                  chip::TLV::AnonymousTag()));
+    }
+    int64_t stream_encode_us = (esp_timer_get_time() - start) / k_iterations;
+    TEST_ASSERT_EQUAL_UINT32(tlv_len, writer.GetLengthWritten());
+
+    s_stream_min_free = free_before;
+    start = esp_timer_get_time();
+    for (uint32_t iteration = 0; iteration < k_iterations; ++iteration) {
+        reader.Init(tlv, tlv_len);
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter::tlv_to_json_stream(reader, sample_heap_chunk, nullptr, {}));
+    }
+    int64_t stream_decode_us = (esp_timer_get_time() - start) / k_iterations;
+
+    printf("json: %u bytes, tlv: %" PRIu32 " bytes\n", (unsigned)input_len, tlv_len);
+    printf("json_to_tlv: cJSON %" PRId64 " us, %u bytes peak, stream %" PRId64 " us\n", tree_encode_us,
+           (unsigned)tree_encode_peak, stream_encode_us);
+    printf("tlv_to_json: cJSON %" PRId64 " us, %u bytes peak, stream %" PRId64 " us, %u bytes peak\n", tree_decode_us,
+           (unsigned)tree_decode_peak, stream_decode_us, (unsigned)(free_before - s_stream_min_free));
+    // The text is built in the chunk buffer on the stack
+    TEST_ASSERT_EQUAL(free_before, s_stream_min_free);
+}
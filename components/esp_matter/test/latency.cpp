@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_latency.h>
+
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC08;
+
+static void record_locked(latency::operation_t operation, uint32_t cluster_id, uint32_t latency_us)
+{
+    if (!esp_matter::is_started()) {
+        latency::record(operation, 1, cluster_id, latency_us);
+        return;
+    }
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+    latency::record(operation, 1, cluster_id, latency_us);
+}
+
+static bool find_histogram(latency::operation_t operation, uint32_t cluster_id, latency::histogram_t *histogram)
+{
+    size_t capacity = latency::get_capacity();
+    latency::histogram_t *histograms = (latency::histogram_t *)calloc(capacity, sizeof(latency::histogram_t));
+    TEST_ASSERT_NOT_NULL(histograms);
+    size_t count = latency::get_histograms(histograms, capacity);
+    bool found = false;
+    for (size_t index = 0; index < count; ++index) {
+        if (histograms[index].operation == operation && histograms[index].cluster_id == cluster_id) {
+            *histogram = histograms[index];
+            found = true;
+            break;
+        }
+    }
+    free(histograms);
+    return found;
+}
+
+TEST_CASE("latency histogram counts and percentiles", "[latency]")
+{
+    latency::reset();
+    // 90 fast calls and 10 slow ones
+    for (int index = 0; index < 90; ++index) {
+        record_locked(latency::OPERATION_WRITE_ATTRIBUTE, k_cluster_id, 100);
+    }
+    for (int index = 0; index < 10; ++index) {
+        record_locked(latency::OPERATION_WRITE_ATTRIBUTE, k_cluster_id, 5000);
+    }
+    record_locked(latency::OPERATION_READ_ATTRIBUTE, k_cluster_id, 0);
+
+    latency::histogram_t histogram;
+    TEST_ASSERT_TRUE(find_histogram(latency::OPERATION_WRITE_ATTRIBUTE, k_cluster_id, &histogram));
+    TEST_ASSERT_EQUAL_UINT32(100, histogram.count);
+    TEST_ASSERT_EQUAL_UINT32(5000, histogram.max_us);
+    TEST_ASSERT_EQUAL_UINT64(90 * 100 + 10 * 5000, histogram.total_us);
+    // 100 us is in [64, 127], 5000 us in [4096, 8191]
+    TEST_ASSERT_EQUAL_UINT32(90, histogram.buckets[7]);
+    TEST_ASSERT_EQUAL_UINT32(10, histogram.buckets[13]);
+    TEST_ASSERT_EQUAL_UINT32(127, latency::get_percentile_us(histogram, 50));
+    TEST_ASSERT_EQUAL_UINT32(127, latency::get_percentile_us(histogram, 90));
+    TEST_ASSERT_EQUAL_UINT32(5000, latency::get_percentile_us(histogram, 99));
+
+    TEST_ASSERT_TRUE(find_histogram(latency::OPERATION_READ_ATTRIBUTE, k_cluster_id, &histogram));
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.count);
+    TEST_ASSERT_EQUAL_UINT32(1, histogram.buckets[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, latency::get_percentile_us(histogram, 99));
+
+    latency::reset();
+    TEST_ASSERT_FALSE(find_histogram(latency::OPERATION_WRITE_ATTRIBUTE, k_cluster_id, &histogram));
+}
+
+TEST_CASE("latency histograms overflow per operation", "[latency]")
+{
+    latency::reset();
+    size_t capacity = latency::get_capacity();
+    for (uint32_t index = 0; index < capacity + 4; ++index) {
+        record_locked(latency::OPERATION_INVOKE_COMMAND, k_cluster_id + index, 10);
+    }
+    // Once the table is full, the new clusters are counted with their operation
+    record_locked(latency::OPERATION_NVS_STORE, k_cluster_id + capacity + 4, 10);
+
+    latency::histogram_t histogram;
+    TEST_ASSERT_TRUE(find_histogram(latency::OPERATION_INVOKE_COMMAND, latency::k_any_cluster_id, &histogram));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(5, histogram.count);
+    TEST_ASSERT_EQUAL_STRING("invoke", latency::get_operation_name(histogram.operation));
+    TEST_ASSERT_TRUE(find_histogram(latency::OPERATION_NVS_STORE, latency::k_any_cluster_id, &histogram));
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(1, histogram.count);
+    TEST_ASSERT_FALSE(find_histogram(latency::OPERATION_COUNT, latency::k_any_cluster_id, &histogram));
+    latency::reset();
+}
+
+#endif // CONFIG_ESP_MATTER_LATENCY_STATS
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_core.h>
+#include <esp_matter_trace.h>
+
+#include "cluster_lifecycle_common.h"
+
+#if CONFIG_ESP_MATTER_TRACE
+
+using namespace esp_matter;
+
+static constexpr uint32_t k_cluster_id = 0xFFF1FC07;
+
+static size_t read_trace(trace::record_t **records)
+{
+    *records = (trace::record_t *)calloc(trace::get_capacity(), sizeof(trace::record_t));
+    TEST_ASSERT_NOT_NULL(*records);
+    return trace::read(*records, trace::get_capacity());
+}
+
+TEST_CASE("trace keeps the latest records in order", "[trace]")
+{
+    trace::clear();
+    size_t capacity = trace::get_capacity();
+    TEST_ASSERT_GREATER_THAN(0, capacity);
+
+    // Twice the capacity of one ring, the oldest records are overwritten
+    for (uint32_t index = 0; index < capacity * 2; ++index) {
+        trace::record(trace::EVENT_COMMAND, 1, k_cluster_id, index, 0, 0, ESP_OK, trace::begin());
+    }
+
+    trace::record_t *records = nullptr;
+    size_t count = read_trace(&records);
+    TEST_ASSERT_GREATER_THAN(0, count);
+    TEST_ASSERT_LESS_OR_EQUAL(capacity, count);
+    TEST_ASSERT_EQUAL_UINT32(capacity * 2 - 1, records[count - 1].id);
+    for (size_t index = 1; index < count; ++index) {
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(records[index - 1].timestamp_us, records[index].timestamp_us);
+    }
+    free(records);
+
+    trace::clear();
+    TEST_ASSERT_EQUAL(0, trace::read(nullptr, 0));
+    trace::record_t record;
+    TEST_ASSERT_EQUAL(0, trace::read(&record, 1));
+}
+
+TEST_CASE("trace records attribute updates", "[trace]")
+{
+    node_t *node = test::get_or_create_node();
+    test::start_matter_if_needed();
+    endpoint_t *endpoint = endpoint::create(node, ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(endpoint);
+    uint16_t endpoint_id = endpoint::get_id(endpoint);
+    cluster_t *cluster = cluster::create(endpoint, k_cluster_id, CLUSTER_FLAG_SERVER);
+    TEST_ASSERT_NOT_NULL(cluster);
+    TEST_ASSERT_NOT_NULL(attribute::create(cluster, 0x0000, ATTRIBUTE_FLAG_NONE, esp_matter_uint32(0)));
+
+    trace::clear();
+    esp_matter_attr_val_t val = esp_matter_uint32(0x12345678);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::report(endpoint_id, k_cluster_id, 0x0000, &val));
+
+    trace::record_t *records = nullptr;
+    size_t count = read_trace(&records);
+    TEST_ASSERT_EQUAL(1, count);
+    TEST_ASSERT_EQUAL_UINT8(trace::EVENT_ATTRIBUTE_UPDATE, records[0].event);
+    TEST_ASSERT_EQUAL_UINT16(endpoint_id, records[0].endpoint_id);
+    TEST_ASSERT_EQUAL_UINT32(k_cluster_id, records[0].cluster_id);
+    TEST_ASSERT_EQUAL_UINT32(0x0000, records[0].id);
+    TEST_ASSERT_EQUAL_UINT8(ESP_MATTER_VAL_TYPE_UINT32, records[0].val_type);
+    TEST_ASSERT_EQUAL_HEX32(0x12345678, records[0].value);
+    TEST_ASSERT_EQUAL(ESP_OK, records[0].err);
+    free(records);
+
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, endpoint));
+}
+
+#endif // CONFIG_ESP_MATTER_TRACE
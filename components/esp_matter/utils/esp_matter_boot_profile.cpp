@@ -0,0 +1,113 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_log.h>
+#include <esp_matter_boot_profile.h>
+#include <inttypes.h>
+
+#if CONFIG_ESP_MATTER_BOOT_PROFILE
+#include <esp_timer.h>
+#endif
+
+namespace esp_matter {
+namespace boot_profile {
+
+static const char *TAG = "boot_profile";
+
+#if CONFIG_ESP_MATTER_BOOT_PROFILE
+namespace {
+struct phase_state_t {
+    int64_t current_start_us; /* 0 when the phase is not running */
+    phase_stats_t stats;
+};
+
+phase_state_t s_phases[PHASE_COUNT];
+} // namespace
+
+void begin(phase_t phase)
+{
+    if (phase >= PHASE_COUNT) {
+        return;
+    }
+    phase_state_t &state = s_phases[phase];
+    state.current_start_us = esp_timer_get_time();
+    if (state.stats.count++ == 0) {
+        state.stats.start_us = (uint32_t)state.current_start_us;
+    }
+}
+
+void end(phase_t phase)
+{
+    if (phase >= PHASE_COUNT || s_phases[phase].current_start_us == 0) {
+        return;
+    }
+    phase_state_t &state = s_phases[phase];
+    int64_t now_us = esp_timer_get_time();
+    state.stats.total_us += (uint32_t)(now_us - state.current_start_us);
+    state.stats.end_us = (uint32_t)now_us;
+    state.current_start_us = 0;
+}
+
+esp_err_t get(phase_t phase, phase_stats_t *stats)
+{
+    if (phase >= PHASE_COUNT || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    *stats = s_phases[phase].stats;
+    return ESP_OK;
+}
+#else
+esp_err_t get(phase_t phase, phase_stats_t *stats)
+{
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif // CONFIG_ESP_MATTER_BOOT_PROFILE
+
+const char *get_phase_name(uint8_t phase)
+{
+    switch (phase) {
+    case PHASE_NODE_BUILD:
+        return "node-build";
+    case PHASE_NVS_RESTORE:
+        return "nvs-restore";
+    case PHASE_BACKGROUND_RESTORE:
+        return "background-restore";
+    case PHASE_PLUGIN_INIT:
+        return "plugin-init";
+    case PHASE_SERVER_INIT:
+        return "server-init";
+    case PHASE_CHIP_INIT:
+        return "chip-init";
+    case PHASE_DNSSD_READY:
+        return "dnssd-ready";
+    default:
+        break;
+    }
+    return "other";
+}
+
+void log()
+{
+    for (uint8_t phase = 0; phase < PHASE_COUNT; ++phase) {
+        phase_stats_t stats;
+        if (get((phase_t)phase, &stats) != ESP_OK || stats.count == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%s: %" PRIu32 " us in %" PRIu32 " call(s), from %" PRIu32 " to %" PRIu32 " us after boot",
+                 get_phase_name(phase), stats.total_us, stats.count, stats.start_us, stats.end_us);
+    }
+}
+
+} // namespace boot_profile
+} // namespace esp_matter
@@ -0,0 +1,123 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <sdkconfig.h>
+#include <stdint.h>
+
+namespace esp_matter {
+namespace boot_profile {
+
+/** Boot phase */
+typedef enum : uint8_t {
+    /** From `node::create()` to `esp_matter::start()`, the endpoints created by the application included */
+    PHASE_NODE_BUILD = 0,
+    /** Restore of the non-volatile attributes when they are created, part of the node build */
+    PHASE_NVS_RESTORE,
+    /** Restore of the non-volatile attributes of the clusters restored in the background */
+    PHASE_BACKGROUND_RESTORE,
+    /** Init callbacks of the clusters: delegate, plugin server, initialization callback and init function */
+    PHASE_PLUGIN_INIT,
+    /** `chip::Server::Init()` */
+    PHASE_SERVER_INIT,
+    /** From `esp_matter::start()` to the initialization of the Matter stack, the server init included */
+    PHASE_CHIP_INIT,
+    /** From `esp_matter::start()` to the DNS-SD initialization, after which the node is advertised */
+    PHASE_DNSSD_READY,
+    PHASE_COUNT,
+} phase_t;
+
+/** Timing of a boot phase, all the times in us */
+typedef struct {
+    /** Time since boot of the first start of the phase */
+    uint32_t start_us;
+    /** Time since boot of the last end of the phase */
+    uint32_t end_us;
+    /** Sum of the durations, the phases like the NVS restore are entered many times */
+    uint32_t total_us;
+    /** Number of times the phase was entered, 0 if it was not reached */
+    uint32_t count;
+} phase_stats_t;
+
+/** Check whether the boot phase timing is built in (`CONFIG_ESP_MATTER_BOOT_PROFILE`) */
+constexpr bool is_enabled()
+{
+#if CONFIG_ESP_MATTER_BOOT_PROFILE
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if CONFIG_ESP_MATTER_BOOT_PROFILE
+/** Mark the start of a phase. A phase is entered by one task at a time, its `end()` may be called by another one.
+ *
+ * @param[in] phase Phase.
+ */
+void begin(phase_t phase);
+
+/** Mark the end of a phase, nothing if the phase has not started
+ *
+ * @param[in] phase Phase.
+ */
+void end(phase_t phase);
+#else
+inline void begin(phase_t phase)
+{
+}
+
+inline void end(phase_t phase)
+{
+}
+#endif
+
+/** Times a phase from its construction to its destruction, nothing without `CONFIG_ESP_MATTER_BOOT_PROFILE` */
+class scoped_phase {
+public:
+    scoped_phase(phase_t phase) : m_phase(phase)
+    {
+        begin(m_phase);
+    }
+
+    ~scoped_phase()
+    {
+        end(m_phase);
+    }
+
+    scoped_phase(const scoped_phase &) = delete;
+    scoped_phase &operator=(const scoped_phase &) = delete;
+
+private:
+    phase_t m_phase;
+};
+
+/** Get the timing of a phase
+ *
+ * @param[in] phase Phase.
+ * @param[out] stats Timing of the phase.
+ *
+ * @return ESP_OK on success, ESP_ERR_NOT_SUPPORTED without `CONFIG_ESP_MATTER_BOOT_PROFILE`.
+ */
+esp_err_t get(phase_t phase, phase_stats_t *stats);
+
+/** Get the name of a phase */
+const char *get_phase_name(uint8_t phase);
+
+/** Log the timing of the phases which were reached */
+void log();
+
+} // namespace boot_profile
+} // namespace esp_matter
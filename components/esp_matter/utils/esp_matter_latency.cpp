@@ -0,0 +1,190 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_latency.h>
+
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+#include <esp_matter_core.h>
+#include <string.h>
+#endif
+
+namespace esp_matter {
+namespace latency {
+
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+namespace {
+constexpr size_t k_histogram_count = CONFIG_ESP_MATTER_LATENCY_STATS_HISTOGRAM_COUNT;
+
+histogram_t s_histograms[k_histogram_count];
+/* Operations of the clusters that do not fit in the table, one histogram per operation */
+histogram_t s_overflow[OPERATION_COUNT];
+size_t s_histogram_count = 0;
+size_t s_last_index = 0;
+} // namespace
+
+static size_t get_bucket(uint32_t latency_us)
+{
+    size_t bucket = latency_us == 0 ? 0 : 32 - __builtin_clz(latency_us);
+    return bucket < k_bucket_count ? bucket : k_bucket_count - 1;
+}
+
+static histogram_t *find_or_add(operation_t operation, uint16_t endpoint_id, uint32_t cluster_id)
+{
+#if !CONFIG_ESP_MATTER_LATENCY_STATS_PER_ENDPOINT
+    endpoint_id = k_any_endpoint_id;
+#endif
+    // The same path is usually recorded several times in a row, by the provider and then by the callbacks
+    histogram_t *last = &s_histograms[s_last_index];
+    if (s_last_index < s_histogram_count && last->operation == operation && last->cluster_id == cluster_id &&
+        last->endpoint_id == endpoint_id) {
+        return last;
+    }
+    for (size_t index = 0; index < s_histogram_count; ++index) {
+        histogram_t &histogram = s_histograms[index];
+        if (histogram.operation == operation && histogram.cluster_id == cluster_id &&
+            histogram.endpoint_id == endpoint_id) {
+            s_last_index = index;
+            return &histogram;
+        }
+    }
+    if (s_histogram_count == k_histogram_count) {
+        // Table full, use the overflow histogram of the operation for all the endpoints and clusters
+        histogram_t &overflow = s_overflow[operation];
+        overflow.endpoint_id = k_any_endpoint_id;
+        overflow.cluster_id = k_any_cluster_id;
+        overflow.operation = operation;
+        return &overflow;
+    }
+    s_last_index = s_histogram_count++;
+    histogram_t &histogram = s_histograms[s_last_index];
+    histogram.operation = operation;
+    histogram.endpoint_id = endpoint_id;
+    histogram.cluster_id = cluster_id;
+    return &histogram;
+}
+
+void record(operation_t operation, uint16_t endpoint_id, uint32_t cluster_id, uint32_t latency_us)
+{
+    histogram_t *histogram = find_or_add(operation, endpoint_id, cluster_id);
+    histogram->count++;
+    histogram->total_us += latency_us;
+    if (latency_us > histogram->max_us) {
+        histogram->max_us = latency_us;
+    }
+    histogram->buckets[get_bucket(latency_us)]++;
+}
+
+static size_t copy_histograms(histogram_t *histograms, size_t max_count)
+{
+    size_t count = 0;
+    for (size_t index = 0; index < s_histogram_count && count < max_count; ++index) {
+        histograms[count++] = s_histograms[index];
+    }
+    for (size_t operation = 0; operation < OPERATION_COUNT && count < max_count; ++operation) {
+        if (s_overflow[operation].count > 0) {
+            histograms[count++] = s_overflow[operation];
+        }
+    }
+    return count;
+}
+
+size_t get_histograms(histogram_t *histograms, size_t max_count)
+{
+    if (!histograms) {
+        return 0;
+    }
+    if (!esp_matter::is_started()) {
+        return copy_histograms(histograms, max_count);
+    }
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+    return copy_histograms(histograms, max_count);
+}
+
+size_t get_capacity()
+{
+    return k_histogram_count + OPERATION_COUNT;
+}
+
+void reset()
+{
+    if (!esp_matter::is_started()) {
+        memset(s_histograms, 0, sizeof(s_histograms));
+        memset(s_overflow, 0, sizeof(s_overflow));
+        s_histogram_count = 0;
+        s_last_index = 0;
+        return;
+    }
+    lock::ScopedChipStackLock lock(portMAX_DELAY);
+    memset(s_histograms, 0, sizeof(s_histograms));
+    memset(s_overflow, 0, sizeof(s_overflow));
+    s_histogram_count = 0;
+    s_last_index = 0;
+}
+#else
+size_t get_histograms(histogram_t *histograms, size_t max_count)
+{
+    return 0;
+}
+
+size_t get_capacity()
+{
+    return 0;
+}
+
+void reset()
+{
+}
+#endif // CONFIG_ESP_MATTER_LATENCY_STATS
+
+const char *get_operation_name(uint8_t operation)
+{
+    switch (operation) {
+    case OPERATION_READ_ATTRIBUTE:
+        return "read";
+    case OPERATION_WRITE_ATTRIBUTE:
+        return "write";
+    case OPERATION_INVOKE_COMMAND:
+        return "invoke";
+    case OPERATION_ATTRIBUTE_CALLBACK:
+        return "callback";
+    case OPERATION_NVS_STORE:
+        return "nvs-store";
+    case OPERATION_NVS_COMMIT:
+        return "nvs-commit";
+    default:
+        break;
+    }
+    return "other";
+}
+
+uint32_t get_percentile_us(const histogram_t &histogram, uint8_t percentile)
+{
+    if (histogram.count == 0) {
+        return 0;
+    }
+    // Rank of the percentile, rounded up
+    uint64_t rank = ((uint64_t)histogram.count * (percentile > 100 ? 100 : percentile) + 99) / 100;
+    uint64_t seen = 0;
+    for (size_t bucket = 0; bucket < k_bucket_count - 1; ++bucket) {
+        seen += histogram.buckets[bucket];
+        if (seen >= rank && seen > 0) {
+            uint32_t upper_bound = bucket == 0 ? 0 : (1u << bucket) - 1;
+            return upper_bound < histogram.max_us ? upper_bound : histogram.max_us;
+        }
+    }
+    return histogram.max_us;
+}
+
+} // namespace latency
+} // namespace esp_matter
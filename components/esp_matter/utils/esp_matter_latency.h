@@ -0,0 +1,167 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <sdkconfig.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+#include <esp_timer.h>
+#endif
+
+namespace esp_matter {
+namespace latency {
+
+/** Instrumented operation */
+typedef enum : uint8_t {
+    /** `ReadAttribute()` of the data model provider */
+    OPERATION_READ_ATTRIBUTE = 0,
+    /** `WriteAttribute()` of the data model provider */
+    OPERATION_WRITE_ATTRIBUTE,
+    /** `InvokeCommand()` of the data model provider */
+    OPERATION_INVOKE_COMMAND,
+    /** Attribute callback of the application, `PRE_UPDATE`, `POST_UPDATE`, `READ` or `WRITE` */
+    OPERATION_ATTRIBUTE_CALLBACK,
+    /** Attribute value written to NVS. A single store includes its commit, the stores of a batch do not */
+    OPERATION_NVS_STORE,
+    /** Commit that ends a batch of attribute values written to NVS, recorded with `k_any_endpoint_id` and
+     *  `k_any_cluster_id` */
+    OPERATION_NVS_COMMIT,
+    OPERATION_COUNT,
+} operation_t;
+
+/** Number of buckets of a histogram. Bucket 0 counts the latencies of 0 us, bucket n > 0 the latencies from 2^(n-1)
+ *  to 2^n - 1 us, the last bucket all the longer ones. */
+constexpr size_t k_bucket_count = 16;
+
+/** Cluster ID of the histograms of the operations that are not specific to a cluster, or recorded once the table is
+ *  full. The operation is kept in the latter case, there is one such histogram per operation. */
+constexpr uint32_t k_any_cluster_id = 0xFFFFFFFF;
+
+/** Endpoint ID of the histograms recorded for all the endpoints, always used without
+ *  `CONFIG_ESP_MATTER_LATENCY_STATS_PER_ENDPOINT` */
+constexpr uint16_t k_any_endpoint_id = 0xFFFF;
+
+/** Latency histogram of an operation on a cluster */
+typedef struct {
+    /** Endpoint ID, `k_any_endpoint_id` for all the endpoints */
+    uint16_t endpoint_id;
+    /** `operation_t` */
+    uint8_t operation;
+    /** Cluster ID, `k_any_cluster_id` for all the clusters */
+    uint32_t cluster_id;
+    /** Number of calls */
+    uint32_t count;
+    /** Longest latency */
+    uint32_t max_us;
+    /** Sum of the latencies */
+    uint64_t total_us;
+    /** Number of calls per latency bucket */
+    uint32_t buckets[k_bucket_count];
+} histogram_t;
+
+/** Check whether the latency statistics are built in (`CONFIG_ESP_MATTER_LATENCY_STATS`) */
+constexpr bool is_enabled()
+{
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+    return true;
+#else
+    return false;
+#endif
+}
+
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+/** Record the latency of an operation. It must be called with the Matter stack lock held, or before
+ *  `esp_matter::start()`.
+ *
+ * @param[in] operation Operation.
+ * @param[in] endpoint_id Endpoint ID.
+ * @param[in] cluster_id Cluster ID, `k_any_cluster_id` if the operation is not specific to a cluster.
+ * @param[in] latency_us Latency.
+ */
+void record(operation_t operation, uint16_t endpoint_id, uint32_t cluster_id, uint32_t latency_us);
+#else
+inline void record(operation_t operation, uint16_t endpoint_id, uint32_t cluster_id, uint32_t latency_us)
+{
+}
+#endif
+
+/** Records the time from its construction to its destruction, nothing without `CONFIG_ESP_MATTER_LATENCY_STATS` */
+class scoped_timer {
+public:
+    scoped_timer(operation_t operation, uint16_t endpoint_id, uint32_t cluster_id)
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+        : m_start_us(esp_timer_get_time()), m_cluster_id(cluster_id), m_endpoint_id(endpoint_id),
+          m_operation(operation)
+#endif
+    {
+    }
+
+    ~scoped_timer()
+    {
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+        record(m_operation, m_endpoint_id, m_cluster_id, (uint32_t)(esp_timer_get_time() - m_start_us));
+#endif
+    }
+
+    scoped_timer(const scoped_timer &) = delete;
+    scoped_timer &operator=(const scoped_timer &) = delete;
+
+private:
+#if CONFIG_ESP_MATTER_LATENCY_STATS
+    int64_t m_start_us;
+    uint32_t m_cluster_id;
+    uint16_t m_endpoint_id;
+    operation_t m_operation;
+#endif
+};
+
+/** Get the latency histograms
+ *
+ * It takes the Matter stack lock, it must not be called from the Matter thread.
+ *
+ * @param[out] histograms Array of histograms.
+ * @param[in] max_count Size of the array, `get_capacity()` to get all the histograms.
+ *
+ * @return Number of histograms copied.
+ */
+size_t get_histograms(histogram_t *histograms, size_t max_count);
+
+/** Get the number of histograms that can be recorded, the ones of the full table included, 0 if the latency
+ *  statistics are not built in */
+size_t get_capacity();
+
+/** Get the name of an operation */
+const char *get_operation_name(uint8_t operation);
+
+/** Get an approximate percentile of a histogram
+ *
+ * @param[in] histogram Histogram.
+ * @param[in] percentile Percentile, from 0 to 100.
+ *
+ * @return Upper bound of the bucket of the percentile in us, `max_us` for the last bucket.
+ */
+uint32_t get_percentile_us(const histogram_t &histogram, uint8_t percentile);
+
+/** Clear all the histograms
+ *
+ * It takes the Matter stack lock, it must not be called from the Matter thread.
+ */
+void reset();
+
+} // namespace latency
+} // namespace esp_matter
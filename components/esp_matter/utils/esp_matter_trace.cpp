@@ -0,0 +1,145 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_trace.h>
+
+#if CONFIG_ESP_MATTER_TRACE
+#include <algorithm>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
+namespace esp_matter {
+namespace trace {
+
+#if CONFIG_ESP_MATTER_TRACE
+namespace {
+constexpr size_t k_ring_size = CONFIG_ESP_MATTER_TRACE_RING_SIZE;
+
+struct slot_t {
+    /* Position of the record plus one, 0 while the record is written */
+    std::atomic<uint32_t> sequence;
+    record_t record;
+};
+
+/* One ring per core, so that the cores never write to the same ring. The tasks of one core share its ring, the
+   position is reserved with an atomic increment so that a preempted writer does not lose its slot. */
+struct ring_t {
+    std::atomic<uint32_t> position;
+    std::atomic<uint32_t> cleared_position;
+    slot_t slots[k_ring_size];
+};
+
+ring_t s_rings[portNUM_PROCESSORS];
+} // namespace
+
+static ring_t &get_current_ring()
+{
+#if portNUM_PROCESSORS > 1
+    return s_rings[xPortGetCoreID()];
+#else
+    return s_rings[0];
+#endif
+}
+
+void record(event_t event, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id, uint8_t val_type, uint32_t value,
+            esp_err_t err, int64_t start_us)
+{
+    int64_t end_us = esp_timer_get_time();
+    ring_t &ring = get_current_ring();
+    uint32_t position = ring.position.fetch_add(1, std::memory_order_relaxed);
+    slot_t &slot = ring.slots[position % k_ring_size];
+
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record.timestamp_us = (uint32_t)start_us;
+    slot.record.latency_us = (uint32_t)(end_us - start_us);
+    slot.record.cluster_id = cluster_id;
+    slot.record.id = id;
+    slot.record.value = value;
+    slot.record.err = err;
+    slot.record.endpoint_id = endpoint_id;
+    slot.record.event = event;
+    slot.record.val_type = val_type;
+    slot.sequence.store(position + 1, std::memory_order_release);
+}
+
+static size_t read_ring(ring_t &ring, record_t *records, size_t max_count)
+{
+    uint32_t end = ring.position.load(std::memory_order_acquire);
+    uint32_t start = end > k_ring_size ? end - k_ring_size : 0;
+    start = std::max(start, ring.cleared_position.load(std::memory_order_relaxed));
+
+    size_t count = 0;
+    for (uint32_t position = start; position != end && count < max_count; ++position) {
+        slot_t &slot = ring.slots[position % k_ring_size];
+        if (slot.sequence.load(std::memory_order_acquire) != position + 1) {
+            // Being written, or already overwritten by a newer record
+            continue;
+        }
+        records[count] = slot.record;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == position + 1) {
+            count++;
+        }
+    }
+    return count;
+}
+
+size_t read(record_t *records, size_t max_count)
+{
+    if (!records) {
+        return 0;
+    }
+    size_t count = 0;
+    for (ring_t &ring : s_rings) {
+        count += read_ring(ring, records + count, max_count - count);
+    }
+    // The rings of the cores are merged by time, the wraparound of the 32-bit timestamps is ignored
+    std::stable_sort(records, records + count, [](const record_t &a, const record_t &b) {
+        return a.timestamp_us < b.timestamp_us;
+    });
+    return count;
+}
+
+size_t get_capacity()
+{
+    return k_ring_size * portNUM_PROCESSORS;
+}
+
+void clear()
+{
+    for (ring_t &ring : s_rings) {
+        ring.cleared_position.store(ring.position.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+}
+#else
+size_t read(record_t *records, size_t max_count)
+{
+    return 0;
+}
+
+size_t get_capacity()
+{
+    return 0;
+}
+
+void clear()
+{
+}
+#endif // CONFIG_ESP_MATTER_TRACE
+
+} // namespace trace
+} // namespace esp_matter
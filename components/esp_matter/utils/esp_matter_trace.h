@@ -0,0 +1,124 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <esp_err.h>
+#include <sdkconfig.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if CONFIG_ESP_MATTER_TRACE
+#include <esp_timer.h>
+#endif
+
+namespace esp_matter {
+namespace trace {
+
+/** Trace event */
+typedef enum : uint8_t {
+    /** Attribute value set with `attribute::update()`, `attribute::report()` or their variants */
+    EVENT_ATTRIBUTE_UPDATE = 1,
+    /** Command dispatched to the command callbacks */
+    EVENT_COMMAND = 2,
+} event_t;
+
+/** Trace record
+ *
+ * The records have a fixed size and are written without formatting, they are decoded when the trace is read.
+ */
+typedef struct {
+    /** Time of the start of the event, low 32 bits of `esp_timer_get_time()` */
+    uint32_t timestamp_us;
+    /** Duration of the event */
+    uint32_t latency_us;
+    /** Cluster ID */
+    uint32_t cluster_id;
+    /** Attribute ID or command ID */
+    uint32_t id;
+    /** Low 32 bits of the attribute value, the length for a string. Unused for commands. */
+    uint32_t value;
+    /** Result of the event */
+    int32_t err;
+    /** Endpoint ID */
+    uint16_t endpoint_id;
+    /** `event_t` of the record */
+    uint8_t event;
+    /** `esp_matter_val_type_t` of the attribute value. Unused for commands. */
+    uint8_t val_type;
+} record_t;
+
+/** Check whether the trace is built in (`CONFIG_ESP_MATTER_TRACE`) */
+constexpr bool is_enabled()
+{
+#if CONFIG_ESP_MATTER_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/** Get the start time of an event to pass to `record()` */
+inline int64_t begin()
+{
+#if CONFIG_ESP_MATTER_TRACE
+    return esp_timer_get_time();
+#else
+    return 0;
+#endif
+}
+
+#if CONFIG_ESP_MATTER_TRACE
+/** Record an event
+ *
+ * The record is written to the ring of the current core without taking a lock, the oldest record of the ring is
+ * overwritten when it is full.
+ *
+ * @param[in] event Event.
+ * @param[in] endpoint_id Endpoint ID.
+ * @param[in] cluster_id Cluster ID.
+ * @param[in] id Attribute ID or command ID.
+ * @param[in] val_type `esp_matter_val_type_t` of the attribute value, 0 for commands.
+ * @param[in] value Low 32 bits of the attribute value, 0 for commands.
+ * @param[in] err Result of the event.
+ * @param[in] start_us Value returned by `begin()` at the start of the event.
+ */
+void record(event_t event, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id, uint8_t val_type, uint32_t value,
+            esp_err_t err, int64_t start_us);
+#else
+inline void record(event_t event, uint16_t endpoint_id, uint32_t cluster_id, uint32_t id, uint8_t val_type,
+                   uint32_t value, esp_err_t err, int64_t start_us)
+{
+}
+#endif
+
+/** Read the trace
+ *
+ * Copies the records of all the cores, oldest first. The records written while reading might be missing.
+ *
+ * @param[out] records Array of records.
+ * @param[in] max_count Size of the array, `get_capacity()` to read the whole trace.
+ *
+ * @return Number of records copied.
+ */
+size_t read(record_t *records, size_t max_count);
+
+/** Get the number of records the trace can hold, 0 if the trace is not built in */
+size_t get_capacity();
+
+/** Drop all the records */
+void clear();
+
+} // namespace trace
+} // namespace esp_matter
@@ -20,7 +20,9 @@
 #include <json_to_tlv.h>
 #include <lib/support/Base64.h>
 #include <lib/support/SafeInt.h>
+#include <lib/support/ScopedBuffer.h>
 
+#include <climits>
 #include <stdlib.h>
 #include "support/CodeUtils.h"
 
@@ -43,14 +45,32 @@ struct element_context {
     TLV::TLVElementType sub_type;
 };
 
-static int compare_by_tag(const void *a, const void *b)
+// A scalar JSON value, from a cJSON item or read by the streaming tokenizer. The string is not NUL-terminated.
+struct json_scalar {
+    int type;
+    double valuedouble;
+    int valueint;
+    const char *valuestring;
+    size_t valuestring_len;
+
+    static json_scalar from_cjson(const cJSON *val)
+    {
+        return json_scalar{val->type, val->valuedouble, val->valueint, val->valuestring,
+                           val->valuestring ? strlen(val->valuestring) : 0};
+    }
+};
+
+static int compare_tags(TLV::Tag tag_a, TLV::Tag tag_b)
 {
-    const element_context *element_a = (const element_context *)a;
-    const element_context *element_b = (const element_context *)b;
-    if (TLV::IsContextTag(element_a->tag) == TLV::IsContextTag(element_b->tag)) {
-        return (int)TLV::TagNumFromTag(element_a->tag) - (int)TLV::TagNumFromTag(element_b->tag);
+    if (TLV::IsContextTag(tag_a) == TLV::IsContextTag(tag_b)) {
+        return (int)TLV::TagNumFromTag(tag_a) - (int)TLV::TagNumFromTag(tag_b);
     }
-    return TLV::IsContextTag(element_a->tag);
+    return TLV::IsContextTag(tag_a);
+}
+
+static int compare_by_tag(const void *a, const void *b)
+{
+    return compare_tags(((const element_context *)a)->tag, ((const element_context *)b)->tag);
 }
 
 static size_t get_char_count(const char *str, char ch)
@@ -80,7 +100,7 @@ static bool is_unsigned_integer(const char *str, size_t len)
     return true;
 }
 
-static bool is_integral_json_number(const cJSON *val)
+static bool is_integral_json_number(const json_scalar *val)
 {
     if (val == nullptr || val->type != cJSON_Number) {
         return false;
@@ -88,6 +108,23 @@ static bool is_integral_json_number(const cJSON *val)
     return static_cast<double>(val->valueint) == val->valuedouble;
 }
 
+static bool is_json_string(const json_scalar *val, const char *str)
+{
+    return val->type == cJSON_String && val->valuestring_len == strlen(str) &&
+           strncmp(val->valuestring, str, val->valuestring_len) == 0;
+}
+
+// Copies the integer string of the value to a terminated buffer for strtoll() and strtoull()
+static bool get_integer_string(const json_scalar *val, char *buf, size_t buf_size)
+{
+    if (!val->valuestring || val->valuestring_len == 0 || val->valuestring_len >= buf_size) {
+        return false;
+    }
+    memcpy(buf, val->valuestring, val->valuestring_len);
+    buf[val->valuestring_len] = '\0';
+    return true;
+}
+
 static esp_err_t type_str_to_tlv_element_type(const char *type_str, size_t len, TLVElementType &type)
 {
     if (len == strlen(element_type::k_int8) && strncmp(type_str, element_type::k_int8, len) == 0) {
@@ -202,16 +239,18 @@ static esp_err_t parse_json_name(const char *name, element_context &element_ctx,
     return ESP_OK;
 }
 
-static bool is_valid_base64_str(const char *str)
+static bool is_valid_base64_str(const char *str, size_t len)
 {
     const char *base64_chars = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
     if (!str) {
         return false;
     }
-    size_t len = strlen(str);
     if (len % 4 != 0) {
         return false;
     }
+    if (len == 0) {
+        return true;
+    }
     size_t padding_len = 0;
     if (str[len - 1] == '=') {
         padding_len++;
@@ -220,7 +259,7 @@ static bool is_valid_base64_str(const char *str)
         }
     }
     for (size_t i = 0; i < len - padding_len; ++i) {
-        if (strchr(base64_chars, str[i]) == NULL) {
+        if (str[i] == '\0' || strchr(base64_chars, str[i]) == NULL) {
             return false;
         }
     }
@@ -239,11 +278,9 @@ static size_t get_object_element_count(const cJSON *json)
     return ret;
 }
 
-static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, const element_context &element_ctx)
+static esp_err_t encode_tlv_scalar(const json_scalar *val, TLV::TLVWriter &writer, TLV::Tag tag, TLVElementType type)
 {
-    TLV::Tag tag = element_ctx.tag;
-
-    switch (element_ctx.type) {
+    switch (type) {
     case TLVElementType::Int8: {
         ESP_RETURN_ON_FALSE(val->type == cJSON_Number, ESP_ERR_INVALID_ARG, TAG, "Invalid type");
         ESP_RETURN_ON_FALSE(val->valueint <= INT8_MAX && val->valueint >= INT8_MIN, ESP_ERR_INVALID_ARG, TAG,
@@ -277,11 +314,12 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
             int64_val =
                 (val->valueint < INT32_MAX && val->valueint > INT32_MIN) ? val->valueint : (int64_t)val->valuedouble;
         } else {
-            ESP_RETURN_ON_FALSE(val->valuestring && val->valuestring[0] != '\0', ESP_ERR_INVALID_ARG, TAG,
+            char integer_str[32];
+            ESP_RETURN_ON_FALSE(get_integer_string(val, integer_str, sizeof(integer_str)), ESP_ERR_INVALID_ARG, TAG,
                                 "Invalid int64 string");
             char *end = nullptr;
-            int64_val = strtoll(val->valuestring, &end, 10);
-            ESP_RETURN_ON_FALSE(end != val->valuestring && end && *end == '\0', ESP_ERR_INVALID_ARG, TAG,
+            int64_val = strtoll(integer_str, &end, 10);
+            ESP_RETURN_ON_FALSE(end != integer_str && end && *end == '\0', ESP_ERR_INVALID_ARG, TAG,
                                 "Invalid int64 string");
         }
         ESP_RETURN_ON_FALSE(writer.Put(tag, int64_val) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
@@ -320,11 +358,12 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
             ESP_RETURN_ON_FALSE(val->valueint >= 0, ESP_ERR_INVALID_ARG, TAG, "Invalid range");
             uint64_val = val->valueint < INT32_MAX ? val->valueint : (uint64_t)val->valuedouble;
         } else {
-            ESP_RETURN_ON_FALSE(val->valuestring && val->valuestring[0] != '\0', ESP_ERR_INVALID_ARG, TAG,
+            char integer_str[32];
+            ESP_RETURN_ON_FALSE(get_integer_string(val, integer_str, sizeof(integer_str)), ESP_ERR_INVALID_ARG, TAG,
                                 "Invalid uint64 string");
             char *end = nullptr;
-            uint64_val = strtoull(val->valuestring, &end, 10);
-            ESP_RETURN_ON_FALSE(end != val->valuestring && end && *end == '\0', ESP_ERR_INVALID_ARG, TAG,
+            uint64_val = strtoull(integer_str, &end, 10);
+            ESP_RETURN_ON_FALSE(end != integer_str && end && *end == '\0', ESP_ERR_INVALID_ARG, TAG,
                                 "Invalid uint64 string");
         }
         ESP_RETURN_ON_FALSE(writer.Put(tag, uint64_val) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
@@ -335,10 +374,10 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
             float float_val = val->valuedouble;
             ESP_RETURN_ON_FALSE(writer.Put(tag, float_val) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
         } else if (val->type == cJSON_String) {
-            if (strcmp(val->valuestring, element_type::k_floating_point_positive_infinity) == 0) {
+            if (is_json_string(val, element_type::k_floating_point_positive_infinity)) {
                 ESP_RETURN_ON_FALSE(writer.Put(tag, std::numeric_limits<float>::infinity()) == CHIP_NO_ERROR, ESP_FAIL,
                                     TAG, "Failed to encode");
-            } else if (strcmp(val->valuestring, element_type::k_floating_point_negative_infinity) == 0) {
+            } else if (is_json_string(val, element_type::k_floating_point_negative_infinity)) {
                 ESP_RETURN_ON_FALSE(writer.Put(tag, -std::numeric_limits<float>::infinity()) == CHIP_NO_ERROR, ESP_FAIL,
                                     TAG, "Failed to encode");
             } else {
@@ -355,10 +394,10 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
             double double_val = val->valuedouble;
             ESP_RETURN_ON_FALSE(writer.Put(tag, double_val) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
         } else if (val->type == cJSON_String) {
-            if (strcmp(val->valuestring, element_type::k_floating_point_positive_infinity) == 0) {
+            if (is_json_string(val, element_type::k_floating_point_positive_infinity)) {
                 ESP_RETURN_ON_FALSE(writer.Put(tag, std::numeric_limits<double>::infinity()) == CHIP_NO_ERROR, ESP_FAIL,
                                     TAG, "Failed to encode");
-            } else if (strcmp(val->valuestring, element_type::k_floating_point_negative_infinity) == 0) {
+            } else if (is_json_string(val, element_type::k_floating_point_negative_infinity)) {
                 ESP_RETURN_ON_FALSE(writer.Put(tag, -std::numeric_limits<double>::infinity()) == CHIP_NO_ERROR,
                                     ESP_FAIL, TAG, "Failed to encode");
             } else {
@@ -380,9 +419,14 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
     }
     case TLVElementType::ByteString_1ByteLength: {
         ESP_RETURN_ON_FALSE(val->type == cJSON_String && val->valuestring, ESP_ERR_INVALID_ARG, TAG, "Invalid type");
-        size_t encoded_len = strlen(val->valuestring);
+        size_t encoded_len = val->valuestring_len;
         ESP_RETURN_ON_FALSE(chip::CanCastTo<uint16_t>(encoded_len), ESP_ERR_INVALID_ARG, TAG, "Invalid type");
-        ESP_RETURN_ON_FALSE(is_valid_base64_str(val->valuestring), ESP_ERR_INVALID_ARG, TAG, "Invalid type");
+        ESP_RETURN_ON_FALSE(is_valid_base64_str(val->valuestring, encoded_len), ESP_ERR_INVALID_ARG, TAG,
+                            "Invalid type");
+        if (encoded_len == 0) {
+            ESP_RETURN_ON_FALSE(writer.PutBytes(tag, nullptr, 0) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
+            break;
+        }
         Platform::ScopedMemoryBuffer<uint8_t> byte_str;
         byte_str.Alloc(BASE64_MAX_DECODED_LEN(static_cast<uint16_t>(encoded_len)));
         ESP_RETURN_ON_FALSE(byte_str.Get(), ESP_ERR_NO_MEM, TAG, "No memory");
@@ -393,8 +437,8 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
     }
     case TLVElementType::UTF8String_1ByteLength: {
         ESP_RETURN_ON_FALSE(val->type == cJSON_String, ESP_ERR_INVALID_ARG, TAG, "Invalid type");
-        ESP_RETURN_ON_FALSE(writer.PutString(tag, val->valuestring) == CHIP_NO_ERROR, ESP_FAIL, TAG,
-                            "Failed to encode");
+        ESP_RETURN_ON_FALSE(writer.PutString(tag, val->valuestring, val->valuestring_len) == CHIP_NO_ERROR, ESP_FAIL,
+                            TAG, "Failed to encode");
         break;
     }
     case TLVElementType::Null: {
@@ -402,6 +446,17 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
         ESP_RETURN_ON_FALSE(writer.PutNull(tag) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to encode");
         break;
     }
+    default:
+        break;
+    }
+    return ESP_OK;
+}
+
+static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, const element_context &element_ctx)
+{
+    TLV::Tag tag = element_ctx.tag;
+
+    switch (element_ctx.type) {
     case TLVElementType::Array: {
         TLV::TLVType container_type;
         esp_err_t err = ESP_OK;
@@ -455,12 +510,468 @@ static esp_err_t encode_tlv_element(const cJSON *val, TLV::TLVWriter &writer, co
         ESP_RETURN_ON_FALSE(writer.EndContainer(container_type) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to end container");
         break;
     }
-    default:
-        break;
+    default: {
+        json_scalar scalar = json_scalar::from_cjson(val);
+        return encode_tlv_scalar(&scalar, writer, tag, element_ctx.type);
+    }
     }
     return ESP_OK;
 }
 
+namespace {
+// Deepest nesting of the streaming conversion, each level is a recursion
+constexpr uint8_t k_max_stream_depth = 32;
+
+bool parse_hex4(const char *str, uint32_t &value)
+{
+    value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        char c = str[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') {
+            value |= c - '0';
+        } else if (c >= 'a' && c <= 'f') {
+            value |= c - 'a' + 10;
+        } else if (c >= 'A' && c <= 'F') {
+            value |= c - 'A' + 10;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t encode_utf8(uint32_t code_point, char *out)
+{
+    if (code_point < 0x80) {
+        out[0] = static_cast<char>(code_point);
+        return 1;
+    }
+    if (code_point < 0x800) {
+        out[0] = static_cast<char>(0xC0 | (code_point >> 6));
+        out[1] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 2;
+    }
+    if (code_point < 0x10000) {
+        out[0] = static_cast<char>(0xE0 | (code_point >> 12));
+        out[1] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+        out[2] = static_cast<char>(0x80 | (code_point & 0x3F));
+        return 3;
+    }
+    out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+    out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+    return 4;
+}
+
+// Unescapes the content of a JSON string like cJSON does. The output is never longer than the input.
+esp_err_t unescape_json_string(const char *raw, size_t raw_len, char *out, size_t *out_len)
+{
+    size_t len = 0;
+    for (size_t i = 0; i < raw_len; ++i) {
+        if (raw[i] != '\\') {
+            out[len++] = raw[i];
+            continue;
+        }
+        ESP_RETURN_ON_FALSE(++i < raw_len, ESP_ERR_INVALID_ARG, TAG, "Invalid escape");
+        switch (raw[i]) {
+        case 'b':
+            out[len++] = '\b';
+            break;
+        case 'f':
+            out[len++] = '\f';
+            break;
+        case 'n':
+            out[len++] = '\n';
+            break;
+        case 'r':
+            out[len++] = '\r';
+            break;
+        case 't':
+            out[len++] = '\t';
+            break;
+        case '"':
+        case '\\':
+        case '/':
+            out[len++] = raw[i];
+            break;
+        case 'u': {
+            uint32_t code_point = 0;
+            ESP_RETURN_ON_FALSE(raw_len - i > 4 && parse_hex4(raw + i + 1, code_point), ESP_ERR_INVALID_ARG, TAG,
+                                "Invalid escape");
+            i += 4;
+            ESP_RETURN_ON_FALSE(code_point < 0xDC00 || code_point > 0xDFFF, ESP_ERR_INVALID_ARG, TAG,
+                                "Invalid surrogate");
+            if (code_point >= 0xD800 && code_point <= 0xDBFF) {
+                // A high surrogate is followed by the low one
+                uint32_t low_surrogate = 0;
+                ESP_RETURN_ON_FALSE(raw_len - i > 6 && raw[i + 1] == '\\' && raw[i + 2] == 'u' &&
+                                    parse_hex4(raw + i + 3, low_surrogate) && low_surrogate >= 0xDC00 &&
+                                    low_surrogate <= 0xDFFF, ESP_ERR_INVALID_ARG, TAG, "Invalid surrogate");
+                i += 6;
+                code_point = 0x10000 + (((code_point & 0x3FF) << 10) | (low_surrogate & 0x3FF));
+            }
+            len += encode_utf8(code_point, out + len);
+            break;
+        }
+        default:
+            ESP_LOGE(TAG, "Invalid escape");
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    *out_len = len;
+    return ESP_OK;
+}
+
+// Pull tokenizer over a JSON document, it keeps no state besides the position
+class json_tokenizer {
+public:
+    json_tokenizer(const char *json, size_t len) : m_json(json), m_len(len) {}
+
+    // Returns the next character after the whitespace, NUL at the end of the document
+    char peek()
+    {
+        while (m_pos < m_len && m_json[m_pos] != '\0' && static_cast<uint8_t>(m_json[m_pos]) <= ' ') {
+            m_pos++;
+        }
+        return m_pos < m_len ? m_json[m_pos] : '\0';
+    }
+
+    bool consume(char c)
+    {
+        if (peek() != c) {
+            return false;
+        }
+        m_pos++;
+        return true;
+    }
+
+    size_t get_offset() const
+    {
+        return m_pos;
+    }
+
+    void seek(size_t offset)
+    {
+        m_pos = offset;
+    }
+
+    // Reads a string, `raw` points to its content in the document, escape sequences included
+    esp_err_t read_string(const char **raw, size_t *raw_len, bool *escaped)
+    {
+        ESP_RETURN_ON_FALSE(consume('"'), ESP_ERR_INVALID_ARG, TAG, "String expected");
+        size_t start = m_pos;
+        *escaped = false;
+        while (m_pos < m_len && m_json[m_pos] != '"' && m_json[m_pos] != '\0') {
+            if (m_json[m_pos] == '\\') {
+                *escaped = true;
+                m_pos++;
+            }
+            m_pos++;
+        }
+        ESP_RETURN_ON_FALSE(m_pos < m_len && m_json[m_pos] == '"', ESP_ERR_INVALID_ARG, TAG, "Unterminated string");
+        *raw = m_json + start;
+        *raw_len = m_pos - start;
+        m_pos++;
+        return ESP_OK;
+    }
+
+    /* Reads a string, number or literal. The objects and the arrays are reported with their cJSON type and not
+     * consumed. A string with escape sequences is unescaped into `unescaped`, the others point to the document. */
+    esp_err_t read_scalar(json_scalar &val, Platform::ScopedMemoryBuffer<char> &unescaped)
+    {
+        val = json_scalar{cJSON_Invalid, 0, 0, nullptr, 0};
+        char c = peek();
+        if (c == '"') {
+            const char *raw = nullptr;
+            size_t raw_len = 0;
+            bool escaped = false;
+            ESP_RETURN_ON_ERROR(read_string(&raw, &raw_len, &escaped), TAG, "Invalid string");
+            val.type = cJSON_String;
+            val.valuestring = raw;
+            val.valuestring_len = raw_len;
+            if (escaped) {
+                unescaped.Calloc(raw_len + 1);
+                ESP_RETURN_ON_FALSE(unescaped.Get(), ESP_ERR_NO_MEM, TAG, "No memory");
+                size_t len = 0;
+                ESP_RETURN_ON_ERROR(unescape_json_string(raw, raw_len, unescaped.Get(), &len), TAG, "Invalid string");
+                // cJSON strings end at the first NUL
+                val.valuestring = unescaped.Get();
+                val.valuestring_len = strnlen(unescaped.Get(), len);
+            }
+        } else if (c == '{') {
+            val.type = cJSON_Object;
+        } else if (c == '[') {
+            val.type = cJSON_Array;
+        } else if (consume_literal("null")) {
+            val.type = cJSON_NULL;
+        } else if (consume_literal("true")) {
+            val.type = cJSON_True;
+            val.valueint = 1;
+        } else if (consume_literal("false")) {
+            val.type = cJSON_False;
+        } else if (c == '-' || (c >= '0' && c <= '9')) {
+            ESP_RETURN_ON_ERROR(read_number(val.valuedouble), TAG, "Invalid number");
+            val.type = cJSON_Number;
+            // Saturated like cJSON does
+            val.valueint = val.valuedouble >= INT_MAX ? INT_MAX
+                           : val.valuedouble <= (double)INT_MIN ? INT_MIN : (int)val.valuedouble;
+        } else {
+            ESP_LOGE(TAG, "Invalid value");
+            return ESP_ERR_INVALID_ARG;
+        }
+        return ESP_OK;
+    }
+
+    // Skips a value, checking its syntax
+    esp_err_t skip_value(uint8_t depth)
+    {
+        ESP_RETURN_ON_FALSE(depth < k_max_stream_depth, ESP_ERR_INVALID_ARG, TAG, "Nesting too deep");
+        char open = peek();
+        if (open == '"') {
+            // The content of the skipped strings is not needed
+            const char *raw = nullptr;
+            size_t raw_len = 0;
+            bool escaped = false;
+            return read_string(&raw, &raw_len, &escaped);
+        }
+        if (open != '{' && open != '[') {
+            json_scalar val;
+            Platform::ScopedMemoryBuffer<char> unescaped;
+            return read_scalar(val, unescaped);
+        }
+        char close = open == '{' ? '}' : ']';
+        m_pos++;
+        if (consume(close)) {
+            return ESP_OK;
+        }
+        do {
+            if (open == '{') {
+                const char *raw = nullptr;
+                size_t raw_len = 0;
+                bool escaped = false;
+                ESP_RETURN_ON_ERROR(read_string(&raw, &raw_len, &escaped), TAG, "Invalid member name");
+                ESP_RETURN_ON_FALSE(consume(':'), ESP_ERR_INVALID_ARG, TAG, "Invalid member");
+            }
+            ESP_RETURN_ON_ERROR(skip_value(depth + 1), TAG, "Invalid value");
+        } while (consume(','));
+        ESP_RETURN_ON_FALSE(consume(close), ESP_ERR_INVALID_ARG, TAG, "Unterminated container");
+        return ESP_OK;
+    }
+
+private:
+    bool consume_literal(const char *literal)
+    {
+        size_t len = strlen(literal);
+        if (peek() != literal[0] || m_len - m_pos < len || strncmp(m_json + m_pos, literal, len) != 0) {
+            return false;
+        }
+        m_pos += len;
+        return true;
+    }
+
+    esp_err_t read_number(double &value)
+    {
+        // Same characters as cJSON, strtod() tells where the number ends
+        char number_str[64];
+        size_t len = 0;
+        while (m_pos + len < m_len && len < sizeof(number_str) - 1 && m_json[m_pos + len] != '\0' &&
+                strchr("0123456789+-eE.", m_json[m_pos + len])) {
+            number_str[len] = m_json[m_pos + len];
+            len++;
+        }
+        number_str[len] = '\0';
+        char *end = nullptr;
+        value = strtod(number_str, &end);
+        ESP_RETURN_ON_FALSE(end != number_str, ESP_ERR_INVALID_ARG, TAG, "Invalid number");
+        m_pos += end - number_str;
+        return ESP_OK;
+    }
+
+    const char *m_json;
+    size_t m_len;
+    size_t m_pos = 0;
+};
+
+struct stream_member {
+    TLV::Tag tag;
+    TLVElementType type;
+    TLVElementType sub_type;
+    size_t value_offset;
+};
+
+int compare_members_by_tag(const void *a, const void *b)
+{
+    return compare_tags(((const stream_member *)a)->tag, ((const stream_member *)b)->tag);
+}
+} // namespace
+
+// Reads a member name and its separator, the name is parsed like in the tree conversion
+static esp_err_t read_member_name(json_tokenizer &tokenizer, element_context &element_ctx,
+                                  uint32_t implicit_profile_id)
+{
+    const char *raw = nullptr;
+    size_t raw_len = 0;
+    bool escaped = false;
+    ESP_RETURN_ON_ERROR(tokenizer.read_string(&raw, &raw_len, &escaped), TAG, "Invalid member name");
+    ESP_RETURN_ON_FALSE(tokenizer.consume(':'), ESP_ERR_INVALID_ARG, TAG, "Invalid member");
+    char name[k_max_json_name_len];
+    ESP_RETURN_ON_FALSE(raw_len < sizeof(name), ESP_ERR_INVALID_ARG, TAG, "Member name too long");
+    size_t name_len = raw_len;
+    if (escaped) {
+        ESP_RETURN_ON_ERROR(unescape_json_string(raw, raw_len, name, &name_len), TAG, "Invalid member name");
+    } else {
+        memcpy(name, raw, raw_len);
+    }
+    name[name_len] = '\0';
+    return parse_json_name(name, element_ctx, implicit_profile_id);
+}
+
+static esp_err_t stream_tlv_element(json_tokenizer &tokenizer, TLV::TLVWriter &writer,
+                                    const element_context &element_ctx, uint8_t depth);
+
+static esp_err_t stream_tlv_array(json_tokenizer &tokenizer, TLV::TLVWriter &writer,
+                                  const element_context &element_ctx, uint8_t depth)
+{
+    ESP_RETURN_ON_FALSE(tokenizer.consume('['), ESP_ERR_INVALID_ARG, TAG, "Invalid type");
+    bool empty = tokenizer.consume(']');
+    if (element_ctx.sub_type == TLV::TLVElementType::NotSpecified) {
+        ESP_RETURN_ON_FALSE(empty, ESP_ERR_INVALID_ARG, TAG, "Invalid array size");
+    }
+    TLV::TLVType container_type;
+    ESP_RETURN_ON_FALSE(writer.StartContainer(element_ctx.tag, TLV::kTLVType_Array, container_type) == CHIP_NO_ERROR,
+                        ESP_FAIL, TAG, "Failed to start container");
+    element_context nested_element_ctx;
+    nested_element_ctx.tag = TLV::AnonymousTag();
+    nested_element_ctx.type = element_ctx.sub_type;
+    esp_err_t err = ESP_OK;
+    if (!empty) {
+        do {
+            err = stream_tlv_element(tokenizer, writer, nested_element_ctx, depth + 1);
+        } while (err == ESP_OK && tokenizer.consume(','));
+        if (err == ESP_OK && !tokenizer.consume(']')) {
+            err = ESP_ERR_INVALID_ARG;
+        }
+    }
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to encode");
+        // Ignore the return value of EndContainer()
+        (void)writer.EndContainer(container_type);
+        return err;
+    }
+    ESP_RETURN_ON_FALSE(writer.EndContainer(container_type) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to end container");
+    return ESP_OK;
+}
+
+static esp_err_t stream_tlv_structure(json_tokenizer &tokenizer, TLV::TLVWriter &writer,
+                                      const element_context &element_ctx, uint8_t depth)
+{
+    ESP_RETURN_ON_FALSE(tokenizer.consume('{'), ESP_ERR_INVALID_ARG, TAG, "Invalid type");
+    size_t members_offset = tokenizer.get_offset();
+
+    // The first pass checks the names and the syntax of the members, and whether they are sorted by tag
+    size_t member_count = 0;
+    bool sorted = true;
+    TLV::Tag previous_tag = TLV::AnonymousTag();
+    if (!tokenizer.consume('}')) {
+        do {
+            element_context member_ctx;
+            ESP_RETURN_ON_ERROR(read_member_name(tokenizer, member_ctx, writer.ImplicitProfileId), TAG,
+                                "Failed to parse json name");
+            ESP_RETURN_ON_ERROR(tokenizer.skip_value(depth + 1), TAG, "Invalid value");
+            sorted = sorted && (member_count == 0 || compare_tags(previous_tag, member_ctx.tag) <= 0);
+            previous_tag = member_ctx.tag;
+            member_count++;
+        } while (tokenizer.consume(','));
+        ESP_RETURN_ON_FALSE(tokenizer.consume('}'), ESP_ERR_INVALID_ARG, TAG, "Unterminated object");
+    }
+    size_t end_offset = tokenizer.get_offset();
+
+    // Only the objects out of order need a table of their members, to encode them sorted
+    Platform::ScopedMemoryBuffer<stream_member> members;
+    if (!sorted) {
+        members.Calloc(member_count);
+        ESP_RETURN_ON_FALSE(members.Get(), ESP_ERR_NO_MEM, TAG, "No memory for members");
+        tokenizer.seek(members_offset);
+        for (size_t member_idx = 0; member_idx < member_count; ++member_idx) {
+            element_context member_ctx;
+            ESP_RETURN_ON_ERROR(read_member_name(tokenizer, member_ctx, writer.ImplicitProfileId), TAG,
+                                "Failed to parse json name");
+            members.Get()[member_idx] = {member_ctx.tag, member_ctx.type, member_ctx.sub_type, tokenizer.get_offset()};
+            ESP_RETURN_ON_ERROR(tokenizer.skip_value(depth + 1), TAG, "Invalid value");
+            tokenizer.consume(',');
+        }
+        qsort(members.Get(), member_count, sizeof(stream_member), compare_members_by_tag);
+    }
+
+    TLV::TLVType container_type;
+    ESP_RETURN_ON_FALSE(writer.StartContainer(element_ctx.tag, TLV::kTLVType_Structure, container_type) ==
+                        CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to start container");
+    esp_err_t err = ESP_OK;
+    tokenizer.seek(members_offset);
+    for (size_t member_idx = 0; member_idx < member_count && err == ESP_OK; ++member_idx) {
+        element_context member_ctx;
+        if (sorted) {
+            err = read_member_name(tokenizer, member_ctx, writer.ImplicitProfileId);
+        } else {
+            member_ctx.tag = members.Get()[member_idx].tag;
+            member_ctx.type = members.Get()[member_idx].type;
+            member_ctx.sub_type = members.Get()[member_idx].sub_type;
+            tokenizer.seek(members.Get()[member_idx].value_offset);
+        }
+        if (err == ESP_OK) {
+            err = stream_tlv_element(tokenizer, writer, member_ctx, depth + 1);
+        }
+        tokenizer.consume(',');
+    }
+    tokenizer.seek(end_offset);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to encode");
+        // Ignore the return value of EndContainer()
+        (void)writer.EndContainer(container_type);
+        return err;
+    }
+    ESP_RETURN_ON_FALSE(writer.EndContainer(container_type) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to end container");
+    return ESP_OK;
+}
+
+static esp_err_t stream_tlv_element(json_tokenizer &tokenizer, TLV::TLVWriter &writer,
+                                    const element_context &element_ctx, uint8_t depth)
+{
+    ESP_RETURN_ON_FALSE(depth < k_max_stream_depth, ESP_ERR_INVALID_ARG, TAG, "Nesting too deep");
+    switch (element_ctx.type) {
+    case TLVElementType::Array:
+        return stream_tlv_array(tokenizer, writer, element_ctx, depth);
+    case TLVElementType::Structure:
+        return stream_tlv_structure(tokenizer, writer, element_ctx, depth);
+    default: {
+        json_scalar val;
+        Platform::ScopedMemoryBuffer<char> unescaped;
+        ESP_RETURN_ON_ERROR(tokenizer.read_scalar(val, unescaped), TAG, "Invalid value");
+        return encode_tlv_scalar(&val, writer, element_ctx.tag, element_ctx.type);
+    }
+    }
+}
+
+esp_err_t json_to_tlv_stream(const char *json_str, size_t json_len, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag)
+{
+    ESP_RETURN_ON_FALSE(json_str, ESP_ERR_INVALID_ARG, TAG, "json_str cannot be NULL");
+    json_tokenizer tokenizer(json_str, json_len);
+    if (tokenizer.peek() != '{') {
+        return ESP_ERR_INVALID_ARG;
+    }
+    element_context element_ctx;
+    element_ctx.type = TLVElementType::Structure;
+    element_ctx.sub_type = TLVElementType::NotSpecified;
+    element_ctx.tag = tag;
+    esp_err_t err = stream_tlv_element(tokenizer, writer, element_ctx, 0);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to encode tlv element");
+    }
+    return err;
+}
+
 esp_err_t json_to_tlv(const char *json_str, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag)
 {
     cJSON *json = cJSON_Parse(json_str);
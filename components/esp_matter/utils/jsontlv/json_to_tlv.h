@@ -42,4 +42,21 @@ esp_err_t json_to_tlv(const char *json_str, chip::TLV::TLVWriter &writer, chip::
  */
 esp_err_t json_to_tlv(cJSON *json, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag);
 
+/** Convert a JSON string to the given TLVWriter without building a cJSON tree
+ *
+ * The string is tokenized in place and encoded as it is read, the result is the one of `json_to_tlv()`. Each object
+ * is scanned once before it is encoded, to check its syntax and the order of its members: the members out of tag
+ * order are sorted with a table of their positions. Only those tables and the strings with escape sequences use the
+ * heap, the memory does not grow with the size of the document.
+ *
+ * @param[in]   json_str The JSON string that represents a TLV structure, it does not need to be NUL-terminated
+ * @param[in]   json_len The length of the JSON string
+ * @param[out]  writer   The TLV output from the JSON string
+ * @param[in]   tag      The TLV tag of the TLV structure
+ *
+ * @return ESP_OK on success
+ * @return error in case of failure
+ */
+esp_err_t json_to_tlv_stream(const char *json_str, size_t json_len, chip::TLV::TLVWriter &writer, chip::TLV::Tag tag);
+
 } // namespace esp_matter
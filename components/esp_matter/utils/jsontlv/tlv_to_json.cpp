@@ -12,7 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cJSON.h>
+#include <cfloat>
+#include <climits>
 #include <cmath>
 #include <element_types.h>
 #include <esp_check.h>
@@ -424,6 +427,346 @@ static esp_err_t encode_tlv_node(TLV::TLVReader &reader, cJSON **json, TLVElemen
     return ESP_OK;
 }
 
+namespace {
+// Size of the chunks handed to the callback, the only buffer of the streaming conversion
+constexpr size_t k_json_chunk_size = 128;
+// Bytes base64-encoded at once, a multiple of 3 so only the last group is padded
+constexpr size_t k_base64_group_size = 48;
+
+class json_stream_writer {
+public:
+    json_stream_writer(json_chunk_cb_t chunk_cb, void *ctx) : m_chunk_cb(chunk_cb), m_ctx(ctx) {}
+
+    esp_err_t write(const char *data, size_t len)
+    {
+        while (len > 0) {
+            size_t copy_len = std::min(len, sizeof(m_chunk) - m_len);
+            memcpy(m_chunk + m_len, data, copy_len);
+            m_len += copy_len;
+            data += copy_len;
+            len -= copy_len;
+            if (m_len == sizeof(m_chunk)) {
+                esp_err_t err = flush();
+                if (err != ESP_OK) {
+                    return err;
+                }
+            }
+        }
+        return ESP_OK;
+    }
+
+    esp_err_t write(const char *str) { return write(str, strlen(str)); }
+
+    esp_err_t write(char c) { return write(&c, 1); }
+
+    // Writes a quoted string, escaped like cJSON does
+    esp_err_t write_string(const char *data, size_t len)
+    {
+        esp_err_t err = write('"');
+        for (size_t i = 0; i < len && err == ESP_OK; ++i) {
+            uint8_t c = static_cast<uint8_t>(data[i]);
+            char escaped[8];
+            switch (c) {
+            case '"':
+                err = write("\\\"");
+                break;
+            case '\\':
+                err = write("\\\\");
+                break;
+            case '\b':
+                err = write("\\b");
+                break;
+            case '\f':
+                err = write("\\f");
+                break;
+            case '\n':
+                err = write("\\n");
+                break;
+            case '\r':
+                err = write("\\r");
+                break;
+            case '\t':
+                err = write("\\t");
+                break;
+            default:
+                if (c < 0x20) {
+                    snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    err = write(escaped);
+                } else {
+                    err = write(static_cast<char>(c));
+                }
+                break;
+            }
+        }
+        return err == ESP_OK ? write('"') : err;
+    }
+
+    esp_err_t flush()
+    {
+        if (m_len == 0) {
+            return ESP_OK;
+        }
+        esp_err_t err = m_chunk_cb(m_chunk, m_len, m_ctx);
+        m_len = 0;
+        return err;
+    }
+
+private:
+    json_chunk_cb_t m_chunk_cb;
+    void *m_ctx;
+    char m_chunk[k_json_chunk_size];
+    size_t m_len = 0;
+};
+
+struct json_buffer_context {
+    char *buf;
+    size_t buf_size;
+    size_t len;
+};
+
+esp_err_t append_to_buffer(const char *chunk, size_t len, void *ctx)
+{
+    json_buffer_context *buffer = static_cast<json_buffer_context *>(ctx);
+    // Keep the room for the terminator
+    if (buffer->len + len >= buffer->buf_size) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(buffer->buf + buffer->len, chunk, len);
+    buffer->len += len;
+    return ESP_OK;
+}
+} // namespace
+
+// Prints the number like cJSON_PrintUnformatted() does for a cJSON number
+static esp_err_t stream_number(json_stream_writer &out, double value)
+{
+    char value_str[32];
+    if (std::isnan(value) || std::isinf(value)) {
+        return out.write("null");
+    }
+    int value_int = value >= INT_MAX ? INT_MAX : value <= (double)INT_MIN ? INT_MIN : (int)value;
+    if (value == (double)value_int) {
+        snprintf(value_str, sizeof(value_str), "%d", value_int);
+    } else {
+        snprintf(value_str, sizeof(value_str), "%1.15g", value);
+        double test = strtod(value_str, nullptr);
+        double max_value = std::max(std::fabs(test), std::fabs(value));
+        if (std::fabs(test - value) > max_value * DBL_EPSILON) {
+            snprintf(value_str, sizeof(value_str), "%1.17g", value);
+        }
+    }
+    return out.write(value_str);
+}
+
+static esp_err_t stream_floating_point(json_stream_writer &out, double value)
+{
+    if (std::isinf(value)) {
+        return out.write_string(value > 0 ? element_type::k_floating_point_positive_infinity
+                                : element_type::k_floating_point_negative_infinity,
+                                strlen(value > 0 ? element_type::k_floating_point_positive_infinity
+                                       : element_type::k_floating_point_negative_infinity));
+    }
+    return stream_number(out, value);
+}
+
+static esp_err_t stream_byte_string(TLV::TLVReader &reader, json_stream_writer &out,
+                                    const tlv_to_json_options &options)
+{
+    ByteSpan value;
+    ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read byte string");
+
+    if (options.human_readable_bytes && is_human_readable_utf8(value)) {
+        return out.write_string(reinterpret_cast<const char *>(value.data()), value.size());
+    }
+
+    // Base64 never needs escaping, it is encoded group by group
+    char encoded[BASE64_ENCODED_LEN(k_base64_group_size)];
+    esp_err_t err = out.write('"');
+    for (size_t offset = 0; offset < value.size() && err == ESP_OK; offset += k_base64_group_size) {
+        size_t group_size = std::min(k_base64_group_size, value.size() - offset);
+        uint16_t encoded_len = Base64Encode(value.data() + offset, static_cast<uint16_t>(group_size), encoded);
+        err = out.write(encoded, encoded_len);
+    }
+    return err == ESP_OK ? out.write('"') : err;
+}
+
+static esp_err_t stream_utf8_string(TLV::TLVReader &reader, json_stream_writer &out)
+{
+    ByteSpan value;
+    ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read byte string");
+    // The tree conversion stops at the first NUL as well
+    const char *str = reinterpret_cast<const char *>(value.data());
+    return out.write_string(str, strnlen(str, value.size()));
+}
+
+// The array subtype is the type of its first element, it is part of the member name written before the array
+static TLVElementType peek_array_sub_type(const TLV::TLVReader &reader)
+{
+    TLV::TLVReader array_reader;
+    array_reader.Init(reader);
+    TLV::TLVType container_type;
+    if (array_reader.EnterContainer(container_type) != CHIP_NO_ERROR || array_reader.Next() != CHIP_NO_ERROR) {
+        return TLVElementType::NotSpecified;
+    }
+    return get_tlv_element_type(array_reader);
+}
+
+static esp_err_t stream_tlv_node(TLV::TLVReader &reader, json_stream_writer &out,
+                                 const tlv_to_json_options &options);
+
+static esp_err_t stream_tlv_container(TLV::TLVReader &reader, json_stream_writer &out, bool is_object,
+                                      const tlv_to_json_options &options)
+{
+    TLV::TLVType container_type;
+    CHIP_ERROR err = reader.EnterContainer(container_type);
+    ESP_RETURN_ON_FALSE(err == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to enter container: %" CHIP_ERROR_FORMAT,
+                        err.Format());
+
+    esp_err_t ret = out.write(is_object ? '{' : '[');
+    bool first = true;
+    while (ret == ESP_OK && (err = reader.Next()) == CHIP_NO_ERROR) {
+        if (!first) {
+            ret = out.write(',');
+        }
+        first = false;
+        if (ret == ESP_OK && is_object) {
+            TLVElementType child_type = get_tlv_element_type(reader);
+            TLVElementType child_sub_type =
+                child_type == TLVElementType::Array ? peek_array_sub_type(reader) : TLVElementType::NotSpecified;
+            char json_name[64] = { 0 };
+            ret = create_json_name(reader.GetTag(), child_type, child_sub_type, json_name, sizeof(json_name));
+            if (ret == ESP_OK && (ret = out.write_string(json_name, strlen(json_name))) == ESP_OK) {
+                ret = out.write(':');
+            }
+        }
+        if (ret == ESP_OK) {
+            ret = stream_tlv_node(reader, out, options);
+        }
+    }
+    if (ret == ESP_OK && err != CHIP_END_OF_TLV) {
+        ESP_LOGE(TAG, "Failed to iterate container: %" CHIP_ERROR_FORMAT, err.Format());
+        ret = ESP_FAIL;
+    }
+    if (ret == ESP_OK) {
+        ret = out.write(is_object ? '}' : ']');
+    }
+
+    err = reader.ExitContainer(container_type);
+    if (err != CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to exit container: %" CHIP_ERROR_FORMAT, err.Format());
+        return ret == ESP_OK ? ESP_FAIL : ret;
+    }
+    return ret;
+}
+
+static esp_err_t stream_tlv_node(TLV::TLVReader &reader, json_stream_writer &out, const tlv_to_json_options &options)
+{
+    char value_str[32];
+
+    switch (get_tlv_element_type(reader)) {
+    case TLVElementType::Int8:
+    case TLVElementType::Int16:
+    case TLVElementType::Int32: {
+        int32_t value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read integer");
+        return stream_number(out, value);
+    }
+    case TLVElementType::Int64: {
+        int64_t value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read int64");
+        snprintf(value_str, sizeof(value_str), "%" PRId64, value);
+        return out.write_string(value_str, strlen(value_str));
+    }
+    case TLVElementType::UInt8:
+    case TLVElementType::UInt16:
+    case TLVElementType::UInt32: {
+        uint32_t value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read unsigned integer");
+        return stream_number(out, value);
+    }
+    case TLVElementType::UInt64: {
+        uint64_t value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read uint64");
+        snprintf(value_str, sizeof(value_str), "%" PRIu64, value);
+        return out.write_string(value_str, strlen(value_str));
+    }
+    case TLVElementType::BooleanFalse:
+    case TLVElementType::BooleanTrue: {
+        bool value = false;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read bool");
+        return out.write(value ? "true" : "false");
+    }
+    case TLVElementType::FloatingPointNumber32: {
+        float value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read float");
+        return stream_floating_point(out, value);
+    }
+    case TLVElementType::FloatingPointNumber64: {
+        double value = 0;
+        ESP_RETURN_ON_FALSE(reader.Get(value) == CHIP_NO_ERROR, ESP_FAIL, TAG, "Failed to read double");
+        return stream_floating_point(out, value);
+    }
+    case TLVElementType::UTF8String_1ByteLength:
+    case TLVElementType::UTF8String_2ByteLength:
+    case TLVElementType::UTF8String_4ByteLength:
+    case TLVElementType::UTF8String_8ByteLength:
+        return stream_utf8_string(reader, out);
+    case TLVElementType::ByteString_1ByteLength:
+    case TLVElementType::ByteString_2ByteLength:
+    case TLVElementType::ByteString_4ByteLength:
+    case TLVElementType::ByteString_8ByteLength:
+        return stream_byte_string(reader, out, options);
+    case TLVElementType::Null:
+        return out.write("null");
+    case TLVElementType::Structure:
+        return stream_tlv_container(reader, out, true, options);
+    case TLVElementType::Array:
+    case TLVElementType::List:
+        return stream_tlv_container(reader, out, false, options);
+    default:
+        ESP_LOGE(TAG, "Unsupported tlv element type: %d", static_cast<int>(get_tlv_element_type(reader)));
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+}
+
+esp_err_t tlv_to_json_stream(TLV::TLVReader &reader, json_chunk_cb_t chunk_cb, void *ctx,
+                             const tlv_to_json_options &options)
+{
+    ESP_RETURN_ON_FALSE(chunk_cb, ESP_ERR_INVALID_ARG, TAG, "chunk_cb cannot be NULL");
+
+    TLV::TLVReader reader_copy;
+    reader_copy.Init(reader);
+
+    if (reader_copy.GetType() == TLV::kTLVType_NotSpecified) {
+        CHIP_ERROR chip_err = reader_copy.Next();
+        if (chip_err != CHIP_NO_ERROR) {
+            ESP_LOGE(TAG, "Failed to move tlv reader: %" CHIP_ERROR_FORMAT, chip_err.Format());
+            return ESP_FAIL;
+        }
+    }
+
+    json_stream_writer out(chunk_cb, ctx);
+    esp_err_t err = stream_tlv_node(reader_copy, out, options);
+    if (err != ESP_OK) {
+        return err;
+    }
+    return out.flush();
+}
+
+esp_err_t tlv_to_json(TLV::TLVReader &reader, char *buf, size_t buf_size, size_t *json_len,
+                      const tlv_to_json_options &options)
+{
+    ESP_RETURN_ON_FALSE(buf && buf_size > 0, ESP_ERR_INVALID_ARG, TAG, "buf cannot be NULL or empty");
+
+    json_buffer_context buffer = { .buf = buf, .buf_size = buf_size, .len = 0 };
+    esp_err_t err = tlv_to_json_stream(reader, append_to_buffer, &buffer, options);
+    buf[err == ESP_OK ? buffer.len : 0] = '\0';
+    if (json_len) {
+        *json_len = err == ESP_OK ? buffer.len : 0;
+    }
+    return err;
+}
+
 esp_err_t tlv_to_json(TLV::TLVReader &reader, cJSON **json)
 {
     return tlv_to_json(reader, json, tlv_to_json_options {});
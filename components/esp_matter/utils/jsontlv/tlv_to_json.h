@@ -45,4 +45,45 @@ esp_err_t tlv_to_json(chip::TLV::TLVReader &reader, cJSON **json);
  */
 esp_err_t tlv_to_json(chip::TLV::TLVReader &reader, cJSON **json, const tlv_to_json_options &options);
 
+/** Receives the JSON text of `tlv_to_json_stream()`, chunk by chunk. The chunks are not NUL-terminated.
+ *
+ * @param[in] chunk The next part of the JSON text.
+ * @param[in] len   Length of the chunk.
+ * @param[in] ctx   The context passed to `tlv_to_json_stream()`.
+ *
+ * @return ESP_OK to continue, an error stops the conversion and is returned by `tlv_to_json_stream()`.
+ */
+typedef esp_err_t (*json_chunk_cb_t)(const char *chunk, size_t len, void *ctx);
+
+/** Convert TLV data model payload to JSON text without building a cJSON tree.
+ *
+ * The text is the one `cJSON_PrintUnformatted()` gives for the output of `tlv_to_json()`. It is handed to the
+ * callback in chunks of up to 128 bytes, from a buffer on the stack: no heap is used whatever the payload size.
+ *
+ * @param[in]   reader   The TLV reader positioned at the payload.
+ * @param[in]   chunk_cb The callback receiving the JSON text.
+ * @param[in]   ctx      The context passed to the callback.
+ * @param[in]   options  Options controlling non-canonical display behavior.
+ *
+ * @return ESP_OK on success.
+ * @return error in case of failure, the callback may have received a part of the text.
+ */
+esp_err_t tlv_to_json_stream(chip::TLV::TLVReader &reader, json_chunk_cb_t chunk_cb, void *ctx,
+                             const tlv_to_json_options &options);
+
+/** Convert TLV data model payload to a NUL-terminated JSON string in a caller-provided buffer.
+ *
+ * @param[in]   reader   The TLV reader positioned at the payload.
+ * @param[out]  buf      The buffer receiving the JSON string, empty on failure.
+ * @param[in]   buf_size Size of the buffer, the terminator included.
+ * @param[out]  json_len Length of the JSON string, the terminator excluded. Can be NULL.
+ * @param[in]   options  Options controlling non-canonical display behavior.
+ *
+ * @return ESP_OK on success.
+ * @return ESP_ERR_INVALID_SIZE if the buffer is too small.
+ * @return error in case of failure.
+ */
+esp_err_t tlv_to_json(chip::TLV::TLVReader &reader, char *buf, size_t buf_size, size_t *json_len,
+                      const tlv_to_json_options &options);
+
 } // namespace esp_matter
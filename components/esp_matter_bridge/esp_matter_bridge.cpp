@@ -31,41 +31,103 @@ using namespace esp_matter::endpoint;
 
 namespace esp_matter_bridge {
 
-static uint16_t bridged_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
-
-/** Persistent Bridged Device Info **/
-static esp_err_t store_device_persistent_info(device_persistent_info_t *persistent_info)
+/* The persistent info of the bridged devices, packed: the first device_info_count entries are used. It is stored as
+ * a single blob, so that the devices created or removed together are persisted with one write and one commit.
+ * The table grows on demand, it also holds the suspended devices which have no endpoint. */
+static device_persistent_info_t *device_info_table = NULL;
+static size_t device_info_count = 0;
+static size_t device_info_capacity = 0;
+static constexpr size_t k_min_table_capacity = 8;
+
+static esp_err_t open_bridge_namespace(nvs_open_mode_t open_mode, nvs_handle_t *handle)
 {
-    esp_err_t err = ESP_OK;
-    if (!persistent_info) {
-        ESP_LOGE(TAG, "persistent_info cannot be NULL");
-        return ESP_ERR_INVALID_ARG;
+    esp_err_t err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
+                                            open_mode, handle);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
+                 ESP_MATTER_BRIDGE_NAMESPACE, err);
     }
+    return err;
+}
 
+static esp_err_t store_device_info_table()
+{
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    esp_err_t err = open_bridge_namespace(NVS_READWRITE, &handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
-    uint16_t endpoint_id = persistent_info->device_endpoint_id;
-    err = nvs_set_blob(handle, nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName(),
-                       persistent_info, sizeof(device_persistent_info_t));
+    if (device_info_count > 0) {
+        err = nvs_set_blob(handle, nvs_key_allocator::device_info_table().KeyName(), device_info_table,
+                           device_info_count * sizeof(device_persistent_info_t));
+    } else {
+        err = nvs_erase_key(handle, nvs_key_allocator::device_info_table().KeyName());
+        err = err == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : err;
+    }
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed on nvs_set_blob when storing device_persistent_info");
+        ESP_LOGE(TAG, "Failed to store the bridged device info table");
         nvs_close(handle);
         return err;
     }
     err = nvs_commit(handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed on nvs_commit when storing device_persistent_info");
+        ESP_LOGE(TAG, "Failed on nvs_commit when storing the bridged device info table");
     }
     nvs_close(handle);
     return err;
 }
 
+static esp_err_t reserve_device_info(size_t count)
+{
+    if (count <= device_info_capacity) {
+        return ESP_OK;
+    }
+    size_t capacity = device_info_capacity ? device_info_capacity : k_min_table_capacity;
+    while (capacity < count) {
+        capacity *= 2;
+    }
+    device_persistent_info_t *table = (device_persistent_info_t *)esp_matter_mem_realloc(
+        device_info_table, capacity * sizeof(device_persistent_info_t));
+    if (!table) {
+        ESP_LOGE(TAG, "Failed to allocate the bridged device info table for %u devices", (unsigned)count);
+        return ESP_ERR_NO_MEM;
+    }
+    device_info_table = table;
+    device_info_capacity = capacity;
+    return ESP_OK;
+}
+
+static device_persistent_info_t *find_device_info(uint16_t endpoint_id)
+{
+    for (size_t idx = 0; idx < device_info_count; ++idx) {
+        if (device_info_table[idx].device_endpoint_id == endpoint_id) {
+            return &device_info_table[idx];
+        }
+    }
+    return NULL;
+}
+
+static esp_err_t add_device_info(const device_persistent_info_t *persistent_info)
+{
+    if (reserve_device_info(device_info_count + 1) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+    device_info_table[device_info_count++] = *persistent_info;
+    return ESP_OK;
+}
+
+static bool remove_device_info(uint16_t endpoint_id)
+{
+    device_persistent_info_t *persistent_info = find_device_info(endpoint_id);
+    if (!persistent_info) {
+        return false;
+    }
+    // The order of the table does not matter, move the last entry into the hole
+    *persistent_info = device_info_table[--device_info_count];
+    return true;
+}
+
+/** Legacy storage: one persistent info key per device and an array of the bridged endpoint ids **/
 static esp_err_t nvs_get_device_persistent_info(const char *nvs_namespace, const char *nvs_key,
                                                 device_persistent_info_t *persistent_info)
 {
@@ -73,8 +135,6 @@ static esp_err_t nvs_get_device_persistent_info(const char *nvs_namespace, const
     nvs_handle_t handle;
     err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, nvs_namespace, NVS_READONLY, &handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 nvs_namespace, err);
         return err;
     }
     size_t len = sizeof(device_persistent_info_t);
@@ -82,148 +142,192 @@ static esp_err_t nvs_get_device_persistent_info(const char *nvs_namespace, const
     nvs_close(handle);
     return err;
 }
-static esp_err_t read_device_persistent_info(device_persistent_info_t *persistent_info, uint16_t endpoint_id)
+
+static void nvs_erase_legacy_key(const char *nvs_namespace, const char *nvs_key)
 {
-    if (!persistent_info) {
-        ESP_LOGE(TAG, "persistent_info cannot be NULL");
-        return ESP_ERR_INVALID_ARG;
+    nvs_handle_t handle;
+    if (nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, nvs_namespace, NVS_READWRITE,
+                                &handle) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to open %s namespace", nvs_namespace);
+        return;
+    }
+    if (nvs_erase_key(handle, nvs_key) == ESP_OK) {
+        nvs_commit(handle);
     }
+    nvs_close(handle);
+}
 
+// Older versions stored the persistent_info in a namespace per endpoint
+static void get_legacy_endpoint_namespace(uint16_t endpoint_id, char *nvs_namespace, size_t size)
+{
+    snprintf(nvs_namespace, size, "bridge_ep_%X", endpoint_id);
+}
+
+static esp_err_t read_legacy_device_persistent_info(device_persistent_info_t *persistent_info, uint16_t endpoint_id,
+                                                    bool *in_endpoint_namespace)
+{
+    *in_endpoint_namespace = false;
     esp_err_t err = nvs_get_device_persistent_info(ESP_MATTER_BRIDGE_NAMESPACE,
                                                    nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName(),
                                                    persistent_info);
     if (err == ESP_ERR_NVS_NOT_FOUND) {
-        // If we don't find persistent_info key in the bridge namespace, we will try to get the persistent_info
-        // with the previous key from the previous namespace.
         char nvs_namespace[16] = {0};
-        snprintf(nvs_namespace, 16, "bridge_ep_%X", endpoint_id);
+        get_legacy_endpoint_namespace(endpoint_id, nvs_namespace, sizeof(nvs_namespace));
         err = nvs_get_device_persistent_info(nvs_namespace, "persistent_info", persistent_info);
-        if (err == ESP_OK) {
-            nvs_handle_t handle;
-            // If we get the persistent_info with the previous key, we will erase it and store it in current namespace
-            // with the new persistent_info key.
-            if (nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, nvs_namespace, NVS_READWRITE,
-                                        &handle) != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to open %s namespace", nvs_namespace);
-            } else {
-                if (nvs_erase_key(handle, "persistent_info") != ESP_OK) {
-                    ESP_LOGE(TAG, "Failed to erase persistent_info");
-                } else {
-                    nvs_commit(handle);
-                }
-                nvs_close(handle);
-            }
-            store_device_persistent_info(persistent_info);
-        }
+        *in_endpoint_namespace = err == ESP_OK;
     }
     return err;
 }
 
-static esp_err_t store_bridged_endpoint_ids()
+static void erase_legacy_device_persistent_info(uint16_t endpoint_id, bool in_endpoint_namespace)
+{
+    if (in_endpoint_namespace) {
+        char nvs_namespace[16] = {0};
+        get_legacy_endpoint_namespace(endpoint_id, nvs_namespace, sizeof(nvs_namespace));
+        nvs_erase_legacy_key(nvs_namespace, "persistent_info");
+    } else {
+        nvs_erase_legacy_key(ESP_MATTER_BRIDGE_NAMESPACE,
+                             nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName());
+    }
+}
+
+static esp_err_t nvs_get_legacy_endpoint_ids(const char *nvs_key, uint16_t *endpoint_ids, size_t *len)
 {
-    esp_err_t err = ESP_OK;
     nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    esp_err_t err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
+                                            NVS_READONLY, &handle);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
         return err;
     }
-    err = nvs_set_blob(handle, nvs_key_allocator::endpoint_ids_array().KeyName(), bridged_endpoint_id_array,
-                       sizeof(bridged_endpoint_id_array));
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed on nvs_set_blob when storing bridged_endpoint_ids");
-    }
-    err = nvs_commit(handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed on nvs_commit when storing bridged_endpoint_ids");
-    }
+    err = nvs_get_blob(handle, nvs_key, endpoint_ids, len);
     nvs_close(handle);
     return err;
 }
 
-static esp_err_t nvs_get_bridged_endpoint_ids(const char *nvs_namespace, const char *nvs_key)
+// Move the devices stored with the legacy keys to the device info table
+static esp_err_t migrate_legacy_device_info()
 {
-    esp_err_t err = ESP_OK;
-    nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, nvs_namespace, NVS_READONLY, &handle);
+    uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    size_t len = sizeof(endpoint_ids);
+    StorageKeyName endpoint_ids_array_key = nvs_key_allocator::endpoint_ids_array();
+    const char *endpoint_ids_key = endpoint_ids_array_key.KeyName();
+    esp_err_t err = nvs_get_legacy_endpoint_ids(endpoint_ids_key, endpoint_ids, &len);
+    if (err == ESP_ERR_NVS_NOT_FOUND) {
+        len = sizeof(endpoint_ids);
+        endpoint_ids_key = "ep_id_array";
+        err = nvs_get_legacy_endpoint_ids(endpoint_ids_key, endpoint_ids, &len);
+    }
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 nvs_namespace, err);
         return err;
     }
-    size_t len = sizeof(bridged_endpoint_id_array);
-    err = nvs_get_blob(handle, nvs_key, bridged_endpoint_id_array, &len);
-    nvs_close(handle);
-    return err;
+    ESP_LOGI(TAG, "Moving the bridged device info to the device info table");
+    size_t endpoint_count = len / sizeof(uint16_t);
+    bool migrated[MAX_BRIDGED_DEVICE_COUNT] = {false};
+    bool in_endpoint_namespace[MAX_BRIDGED_DEVICE_COUNT] = {false};
+    for (size_t idx = 0; idx < endpoint_count; ++idx) {
+        device_persistent_info_t persistent_info;
+        if (endpoint_ids[idx] == chip::kInvalidEndpointId) {
+            continue;
+        }
+        if (read_legacy_device_persistent_info(&persistent_info, endpoint_ids[idx], &in_endpoint_namespace[idx]) !=
+                ESP_OK) {
+            continue;
+        }
+        err = add_device_info(&persistent_info);
+        if (err != ESP_OK) {
+            // The legacy keys are kept, the move is tried again on the next boot
+            device_info_count = 0;
+            return err;
+        }
+        migrated[idx] = true;
+    }
+    err = store_device_info_table();
+    if (err != ESP_OK) {
+        device_info_count = 0;
+        return err;
+    }
+    // The legacy keys are only erased once the table holding their content is committed
+    for (size_t idx = 0; idx < endpoint_count; ++idx) {
+        if (migrated[idx]) {
+            erase_legacy_device_persistent_info(endpoint_ids[idx], in_endpoint_namespace[idx]);
+        }
+    }
+    nvs_erase_legacy_key(ESP_MATTER_BRIDGE_NAMESPACE, endpoint_ids_key);
+    return ESP_OK;
 }
 
-static esp_err_t read_bridged_endpoint_ids()
+static esp_err_t read_device_info_table()
 {
-    esp_err_t err =
-        nvs_get_bridged_endpoint_ids(ESP_MATTER_BRIDGE_NAMESPACE, nvs_key_allocator::endpoint_ids_array().KeyName());
-    if (err == ESP_ERR_NVS_NOT_FOUND) {
-        err = nvs_get_bridged_endpoint_ids(ESP_MATTER_BRIDGE_NAMESPACE, "ep_id_array");
-        // If we don't find endpoint_ids_array in the bridge namespace, we will try to get the attribute value
-        // with the previous key from the previous namespace.
+    nvs_handle_t handle;
+    device_info_count = 0;
+    esp_err_t err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
+                                            NVS_READONLY, &handle);
+    if (err == ESP_OK) {
+        // Size the table from the blob length, it is not bounded by the dynamic endpoints
+        size_t len = 0;
+        err = nvs_get_blob(handle, nvs_key_allocator::device_info_table().KeyName(), NULL, &len);
+        if (err == ESP_OK) {
+            err = reserve_device_info(len / sizeof(device_persistent_info_t));
+        }
         if (err == ESP_OK) {
-            // If we get endpoint_ids_array with the previous key, we will erase it and store it in current namespace
-            // with the new endpoint_ids_array key.
-            nvs_handle_t handle;
-            if (nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
-                                        NVS_READWRITE, &handle) != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to open bridge namespace");
-            } else {
-                if (nvs_erase_key(handle, "ep_id_array") != ESP_OK) {
-                    ESP_LOGE(TAG, "Failed to erase old key");
-                } else {
-                    nvs_commit(handle);
-                }
-                nvs_close(handle);
-            }
-            store_bridged_endpoint_ids();
+            err = nvs_get_blob(handle, nvs_key_allocator::device_info_table().KeyName(), device_info_table, &len);
+        }
+        nvs_close(handle);
+        if (err == ESP_OK) {
+            device_info_count = len / sizeof(device_persistent_info_t);
+            return ESP_OK;
         }
     }
-    return err;
+    if (err != ESP_ERR_NVS_NOT_FOUND) {
+        ESP_LOGE(TAG, "Failed to read the bridged device info table");
+        return err;
+    }
+    err = migrate_legacy_device_info();
+    return err == ESP_ERR_NVS_NOT_FOUND ? ESP_OK : err;
 }
 
 esp_err_t get_bridged_endpoint_ids(uint16_t *matter_endpoint_id_array)
 {
     if (!matter_endpoint_id_array) {
-        ESP_LOGE(TAG, "matter_endpoint_id_array is NULL. Failed to copy the bridged_endpoint_id_array to it");
+        ESP_LOGE(TAG, "matter_endpoint_id_array is NULL. Failed to copy the bridged endpoint ids to it");
         return ESP_ERR_INVALID_ARG;
     }
-    memcpy(matter_endpoint_id_array, bridged_endpoint_id_array, sizeof(bridged_endpoint_id_array));
+    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
+        matter_endpoint_id_array[idx] =
+            idx < device_info_count ? device_info_table[idx].device_endpoint_id : chip::kInvalidEndpointId;
+    }
     return ESP_OK;
 }
 
-esp_err_t erase_bridged_device_info(uint16_t endpoint_id)
+size_t get_bridged_device_count()
 {
-    // Remove endpoint id from the endpoint id array
-    esp_err_t err = ESP_OK;
-    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
-        if (bridged_endpoint_id_array[idx] == endpoint_id) {
-            bridged_endpoint_id_array[idx] = chip::kInvalidEndpointId;
-        }
+    return device_info_count;
+}
+
+esp_err_t get_bridged_endpoint_ids(uint16_t *endpoint_ids, size_t *count)
+{
+    if (!endpoint_ids || !count) {
+        ESP_LOGE(TAG, "endpoint_ids and count cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
     }
-    err = store_bridged_endpoint_ids();
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "failed to store the endpoint_id array");
-        return err;
+    if (*count > device_info_count) {
+        *count = device_info_count;
     }
-    // Clear the persistent information of the removed endpoint
-    nvs_handle_t handle;
-    err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READWRITE,
-                                  &handle);
+    for (size_t idx = 0; idx < *count; ++idx) {
+        endpoint_ids[idx] = device_info_table[idx].device_endpoint_id;
+    }
+    return ESP_OK;
+}
+
+esp_err_t erase_bridged_device_info(uint16_t endpoint_id)
+{
+    if (!remove_device_info(endpoint_id)) {
+        return ESP_OK;
+    }
+    esp_err_t err = store_device_info_table();
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Error opening partition %s namespace %s. Err: %d", CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME,
-                 ESP_MATTER_BRIDGE_NAMESPACE, err);
-        return err;
+        ESP_LOGE(TAG, "failed to store the bridged device info table");
     }
-    err = nvs_erase_key(handle, nvs_key_allocator::endpoint_pesistent_info(endpoint_id).KeyName());
-    nvs_commit(handle);
-    nvs_close(handle);
     return err;
 }
 
@@ -249,6 +353,8 @@ static esp_err_t plugin_init_callback_endpoint(endpoint_t *endpoint)
 
 static bridge_device_type_callback_t device_type_callback;
 
+static esp_err_t destroy_device(device_t *bridged_device);
+
 esp_err_t set_device_type(device_t *bridged_device, uint32_t device_type_id, void *priv_data)
 {
     esp_err_t err;
@@ -268,6 +374,110 @@ esp_err_t set_device_type(device_t *bridged_device, uint32_t device_type_id, voi
     return plugin_init_callback_endpoint(bridged_device->endpoint);
 }
 
+#if CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
+typedef struct device_type_template {
+    struct device_type_template *next;
+    uint32_t device_type_id;
+    bool created; /* Captured from a created device, its nonvolatile attributes hold the default values */
+    size_t device_count; /* The devices built from the template, it is freed with the last one */
+    endpoint_template_t *endpoint_template;
+} device_type_template_t;
+
+/* The endpoint templates of the device types, the newest first. A replaced template stays in the list until the
+ * devices built from it are destroyed, but it is not found anymore. */
+static device_type_template_t *device_type_templates = NULL;
+
+static device_type_template_t *find_device_type_template(uint32_t device_type_id)
+{
+    for (device_type_template_t *entry = device_type_templates; entry; entry = entry->next) {
+        if (entry->device_type_id == device_type_id) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static device_type_template_t *add_device_type_template(uint32_t device_type_id, bool created,
+                                                        endpoint_template_t *endpoint_template)
+{
+    device_type_template_t *entry = (device_type_template_t *)esp_matter_mem_calloc(1, sizeof(device_type_template_t));
+    if (!entry) {
+        ESP_LOGW(TAG, "Failed to keep the template of device type 0x%08" PRIx32, device_type_id);
+        endpoint::destroy_template(endpoint_template);
+        return NULL;
+    }
+    entry->device_type_id = device_type_id;
+    entry->created = created;
+    entry->endpoint_template = endpoint_template;
+    entry->next = device_type_templates;
+    device_type_templates = entry;
+    return entry;
+}
+
+// Called once the endpoint of the device is destroyed, the template is freed with the last device built from it
+static void release_device_type_template(device_t *dev)
+{
+    device_type_template_t *entry = dev->device_type_template;
+    dev->device_type_template = NULL;
+    if (!entry || --entry->device_count > 0) {
+        return;
+    }
+    device_type_template_t **link = &device_type_templates;
+    while (*link != entry) {
+        link = &(*link)->next;
+    }
+    *link = entry->next;
+    endpoint::destroy_template(entry->endpoint_template);
+    esp_matter_mem_free(entry);
+}
+
+// Build the device type on the endpoint from the template of the device type, or with the device type callback and
+// keep a template of the result. The template is captured before the plugin init callbacks run, so that the values
+// they set are not given to the next devices. The stored values of a resumed device are in its template, so it only
+// serves the resumed devices until a created device replaces it.
+static esp_err_t add_device_type_clusters(device_t *dev, uint32_t device_type_id, void *priv_data, bool created)
+{
+    device_type_template_t *entry = find_device_type_template(device_type_id);
+    if (entry && (entry->created || !created)) {
+        // The endpoint points to the descriptors and bounds of the template from now on
+        dev->device_type_template = entry;
+        entry->device_count++;
+        esp_err_t err = endpoint::apply_template(dev->endpoint, entry->endpoint_template);
+        if (err != ESP_OK) {
+            return err;
+        }
+        return plugin_init_callback_endpoint(dev->endpoint);
+    }
+    if (!device_type_callback) {
+        ESP_LOGE(TAG, "device_type_callback is NULL, call initialize() first");
+        return ESP_ERR_INVALID_STATE;
+    }
+    esp_err_t err = device_type_callback(dev->endpoint, device_type_id, priv_data);
+    if (err != ESP_OK) {
+        return err;
+    }
+    endpoint_template_t *endpoint_template = endpoint::capture_template(dev->endpoint);
+    if (endpoint_template) {
+        entry = add_device_type_template(device_type_id, created, endpoint_template);
+        if (entry) {
+            // The source device keeps the template alive too, the ones built from it might outlive it
+            dev->device_type_template = entry;
+            entry->device_count++;
+        }
+    }
+    return plugin_init_callback_endpoint(dev->endpoint);
+}
+#else
+static void release_device_type_template(device_t *dev)
+{
+}
+
+static esp_err_t add_device_type_clusters(device_t *dev, uint32_t device_type_id, void *priv_data, bool created)
+{
+    return set_device_type(dev, device_type_id, priv_data);
+}
+#endif // CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
+
 static bool parent_endpoint_is_valid(node_t *node, uint16_t parent_endpoint_id)
 {
     if (!node) {
@@ -292,11 +502,12 @@ static bool parent_endpoint_is_valid(node_t *node, uint16_t parent_endpoint_id)
     return false;
 }
 
-device_t *create_device(node_t *node, uint16_t parent_endpoint_id, uint32_t device_type_id, void *priv_data)
+// Create the device and add its persistent info to the table, the caller stores the table
+static device_t *create_device_internal(node_t *node, uint16_t parent_endpoint_id, uint32_t device_type_id,
+                                        void *priv_data)
 {
-    // Check whether the parent endpoint is valid
-    if (!parent_endpoint_is_valid(node, parent_endpoint_id)) {
-        ESP_LOGE(TAG, "Parent endpoint is invalid");
+    if (endpoint::get_count(node) >= CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT) {
+        ESP_LOGE(TAG, "Endpoints are used up");
         return NULL;
     }
 
@@ -309,6 +520,7 @@ device_t *create_device(node_t *node, uint16_t parent_endpoint_id, uint32_t devi
 
     dev->node = node;
     dev->persistent_info.parent_endpoint_id = parent_endpoint_id;
+    dev->persistent_info.device_endpoint_id = chip::kInvalidEndpointId;
     bridged_node::config_t bridged_node_config;
     dev->endpoint =
         bridged_node::create(node, &bridged_node_config, ENDPOINT_FLAG_DESTROYABLE | ENDPOINT_FLAG_BRIDGE, priv_data);
@@ -317,59 +529,111 @@ device_t *create_device(node_t *node, uint16_t parent_endpoint_id, uint32_t devi
         esp_matter_mem_free(dev);
         return NULL;
     }
-    if (set_device_type(dev, device_type_id, priv_data) != ESP_OK) {
+    if (add_device_type_clusters(dev, device_type_id, priv_data, true) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to add the device type for the bridged device");
-        remove_device(dev);
+        destroy_device(dev);
         return NULL;
     }
     endpoint_t *parent_endpoint = endpoint::get(node, parent_endpoint_id);
     if (set_parent_endpoint(dev->endpoint, parent_endpoint) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to set parent endpoint for the bridged device");
-        remove_device(dev);
+        destroy_device(dev);
         return NULL;
     }
 
-    // Store the persistent information
     dev->persistent_info.device_endpoint_id = esp_matter::endpoint::get_id(dev->endpoint);
     dev->persistent_info.device_type_id = device_type_id;
-    if (store_device_persistent_info(&dev->persistent_info) != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to store the persistent info for the bridged device");
-        remove_device(dev);
+    if (add_device_info(&dev->persistent_info) != ESP_OK) {
+        destroy_device(dev);
         return NULL;
     }
+    return dev;
+}
 
-    // Store the endpoint_id in endpoint_id_array
-    size_t idx;
-    for (idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
-        if (bridged_endpoint_id_array[idx] == chip::kInvalidEndpointId) {
-            bridged_endpoint_id_array[idx] = dev->persistent_info.device_endpoint_id;
-            break;
-        }
+device_t *create_device(node_t *node, uint16_t parent_endpoint_id, uint32_t device_type_id, void *priv_data)
+{
+    // Check whether the parent endpoint is valid
+    if (!parent_endpoint_is_valid(node, parent_endpoint_id)) {
+        ESP_LOGE(TAG, "Parent endpoint is invalid");
+        return NULL;
     }
-    if (idx == MAX_BRIDGED_DEVICE_COUNT) {
-        ESP_LOGE(TAG, "Endpoints are used up");
-        remove_device(dev);
+    device_t *dev = create_device_internal(node, parent_endpoint_id, device_type_id, priv_data);
+    if (!dev) {
         return NULL;
     }
-    if (store_bridged_endpoint_ids() != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to persist bridged endpoint IDs");
+    // Store the persistent information
+    if (store_device_info_table() != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to store the persistent info for the bridged device");
+        destroy_device(dev);
+        return NULL;
     }
     return dev;
 }
 
-device_t *resume_device(node_t *node, uint16_t device_endpoint_id, void *priv_data)
+esp_err_t create_devices(node_t *node, uint16_t parent_endpoint_id, const uint32_t *device_type_ids,
+                         void *const *priv_data, size_t count, device_t **devices)
 {
+    if (!device_type_ids || !devices || count == 0) {
+        ESP_LOGE(TAG, "device_type_ids and devices cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!parent_endpoint_is_valid(node, parent_endpoint_id)) {
+        ESP_LOGE(TAG, "Parent endpoint is invalid");
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (endpoint::get_count(node) + count > CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT) {
+        ESP_LOGE(TAG, "Not enough endpoints for %u bridged devices", (unsigned)count);
+        return ESP_ERR_NO_MEM;
+    }
+    if (reserve_device_info(device_info_count + count) != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
     esp_err_t err = ESP_OK;
-    device_persistent_info_t persistent_info;
-    err = read_device_persistent_info(&persistent_info, device_endpoint_id);
+    size_t created = 0;
+    for (; created < count; ++created) {
+        devices[created] = create_device_internal(node, parent_endpoint_id, device_type_ids[created],
+                                                  priv_data ? priv_data[created] : NULL);
+        if (!devices[created]) {
+            err = ESP_FAIL;
+            break;
+        }
+    }
+    // Persist all the devices at once
+    if (err == ESP_OK) {
+        err = store_device_info_table();
+    }
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to read the persistent info for the resumed device");
+        ESP_LOGE(TAG, "Failed to create the bridged devices");
+        for (size_t idx = 0; idx < created; ++idx) {
+            destroy_device(devices[idx]);
+            devices[idx] = NULL;
+        }
+    }
+    return err;
+}
+
+// Resume the device from its persistent info in the table, a device which cannot be resumed is removed from the table.
+// A device which is already resumed or does not get an endpoint because they are used up is kept.
+static device_t *resume_device_internal(node_t *node, uint16_t device_endpoint_id, void *priv_data)
+{
+    device_persistent_info_t *stored_info = find_device_info(device_endpoint_id);
+    if (!stored_info) {
+        ESP_LOGE(TAG, "Failed to find the persistent info for the resumed device");
         return NULL;
     }
+    device_persistent_info_t persistent_info = *stored_info;
     if (!parent_endpoint_is_valid(node, persistent_info.parent_endpoint_id)) {
         ESP_LOGE(TAG, "Parent endpoint is invalid");
         return NULL;
     }
+    if (endpoint::get(node, device_endpoint_id)) {
+        ESP_LOGE(TAG, "The bridged device on endpoint %u is already resumed", device_endpoint_id);
+        return NULL;
+    }
+    if (endpoint::get_count(node) >= CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT) {
+        ESP_LOGE(TAG, "Endpoints are used up, the bridged device on endpoint %u stays suspended", device_endpoint_id);
+        return NULL;
+    }
     device_t *dev = (device_t *)esp_matter_mem_calloc(1, sizeof(device_t));
     if (!dev) {
         ESP_LOGE(TAG, "Failed to allocate memory for bridged device");
@@ -384,37 +648,107 @@ device_t *resume_device(node_t *node, uint16_t device_endpoint_id, void *priv_da
     if (!(dev->endpoint)) {
         ESP_LOGE(TAG, "Could not resume esp_matter endpoint for bridged device");
         esp_matter_mem_free(dev);
-        erase_bridged_device_info(device_endpoint_id);
+        remove_device_info(device_endpoint_id);
         return NULL;
     }
-    if (set_device_type(dev, persistent_info.device_type_id, priv_data) != ESP_OK) {
+    if (add_device_type_clusters(dev, persistent_info.device_type_id, priv_data, false) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to add the device type for the bridged device");
-        remove_device(dev);
+        destroy_device(dev);
         return NULL;
     }
     endpoint_t *parent_endpoint = endpoint::get(node, persistent_info.parent_endpoint_id);
     if (set_parent_endpoint(dev->endpoint, parent_endpoint) != ESP_OK) {
         ESP_LOGE(TAG, "Failed to set parent endpoint for the bridged device");
-        remove_device(dev);
+        destroy_device(dev);
         return NULL;
     }
     return dev;
 }
 
-esp_err_t remove_device(device_t *bridged_device)
+device_t *resume_device(node_t *node, uint16_t device_endpoint_id, void *priv_data)
+{
+    size_t count = device_info_count;
+    device_t *dev = resume_device_internal(node, device_endpoint_id, priv_data);
+    if (device_info_count != count) {
+        store_device_info_table();
+    }
+    return dev;
+}
+
+esp_err_t resume_devices(node_t *node, const uint16_t *endpoint_ids, void *const *priv_data, size_t count,
+                         device_t **devices)
+{
+    if (!endpoint_ids || !devices) {
+        ESP_LOGE(TAG, "endpoint_ids and devices cannot be NULL");
+        return ESP_ERR_INVALID_ARG;
+    }
+    size_t stored_count = device_info_count;
+    esp_err_t err = ESP_OK;
+    for (size_t idx = 0; idx < count; ++idx) {
+        devices[idx] = NULL;
+        if (endpoint_ids[idx] == chip::kInvalidEndpointId) {
+            continue;
+        }
+        devices[idx] = resume_device_internal(node, endpoint_ids[idx], priv_data ? priv_data[idx] : NULL);
+        if (!devices[idx]) {
+            ESP_LOGE(TAG, "Failed to resume the bridged device on endpoint %u", endpoint_ids[idx]);
+            err = ESP_FAIL;
+        }
+    }
+    // Persist the removal of the devices which could not be resumed at once
+    if (device_info_count != stored_count) {
+        store_device_info_table();
+    }
+    return err;
+}
+
+esp_err_t resume_all(node_t *node, void *const *priv_data, device_t **devices)
+{
+    // The table is compacted when a device fails to resume, walk a copy of the endpoint ids
+    uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    get_bridged_endpoint_ids(endpoint_ids);
+    return resume_devices(node, endpoint_ids, priv_data, MAX_BRIDGED_DEVICE_COUNT, devices);
+}
+
+esp_err_t suspend_device(device_t *bridged_device)
 {
     if (!bridged_device) {
         return ESP_ERR_INVALID_ARG;
     }
-    erase_bridged_device_info(bridged_device->persistent_info.device_endpoint_id);
+    // The persistent info stays in the table and the attribute values in NVS, the device is resumed later with
+    // resume_device()
+    esp_err_t err = endpoint::suspend(bridged_device->node, bridged_device->endpoint);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to delete bridged endpoint");
+        return err;
+    }
+    release_device_type_template(bridged_device);
+    esp_matter_mem_free(bridged_device);
+    return ESP_OK;
+}
+
+static esp_err_t destroy_device(device_t *bridged_device)
+{
+    remove_device_info(bridged_device->persistent_info.device_endpoint_id);
     esp_err_t error = endpoint::destroy(bridged_device->node, bridged_device->endpoint);
     if (error != ESP_OK) {
         ESP_LOGE(TAG, "Failed to delete bridged endpoint");
     }
+    // The device is freed even if its endpoint could not be destroyed, so is its reference to the template
+    release_device_type_template(bridged_device);
     esp_matter_mem_free(bridged_device);
     return error;
 }
 
+esp_err_t remove_device(device_t *bridged_device)
+{
+    if (!bridged_device) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    erase_bridged_device_info(bridged_device->persistent_info.device_endpoint_id);
+    return destroy_device(bridged_device);
+}
+
 esp_err_t initialize(node_t *node, bridge_device_type_callback_t device_type_cb)
 {
     if (!node) {
@@ -433,21 +767,10 @@ esp_err_t initialize(node_t *node, bridge_device_type_callback_t device_type_cb)
         ESP_LOGE(TAG, "Failed to initialize the bridge info partition");
         return err;
     }
-    // Read the bridged endpoint array
-    err = read_bridged_endpoint_ids();
-    if (err == ESP_ERR_NVS_NOT_FOUND) {
-        ESP_LOGI(TAG, "The bridged endpoint id array is not found in partition %s, Try to initialize it",
-                 CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME);
-        for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
-            bridged_endpoint_id_array[idx] = chip::kInvalidEndpointId;
-        }
-        if (store_bridged_endpoint_ids() != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to store the initialized endpoint id array");
-            return err;
-        }
-        return ESP_OK;
-    } else if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to read the bridged endpoint id array");
+    // Read the persistent info of all the bridged devices at once
+    err = read_device_info_table();
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to read the bridged device info table");
     }
     return err;
 }
@@ -467,9 +790,7 @@ esp_err_t factory_reset()
     err = nvs_erase_all(handle);
     nvs_commit(handle);
     nvs_close(handle);
-    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
-        bridged_endpoint_id_array[idx] = chip::kInvalidEndpointId;
-    }
+    device_info_count = 0;
     return err;
 }
 
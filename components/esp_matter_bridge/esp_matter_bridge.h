@@ -21,6 +21,8 @@
 #define MAX_BRIDGED_DEVICE_COUNT \
     (CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT - 1 - CONFIG_ESP_MATTER_AGGREGATOR_ENDPOINT_COUNT)
 // There is an endpoint reserved as root endpoint
+// MAX_BRIDGED_DEVICE_COUNT bounds the bridged devices with an endpoint at the same time. More devices can be stored
+// if the others are suspended, see suspend_device().
 
 namespace esp_matter_bridge {
 
@@ -30,16 +32,30 @@ typedef struct device_persistent_info {
     uint32_t device_type_id;
 } device_persistent_info_t;
 
+#if CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
+struct device_type_template;
+#endif
+
 typedef struct device {
     esp_matter::node_t *node;
     esp_matter::endpoint_t *endpoint;
     device_persistent_info_t persistent_info;
+#if CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
+    // The template the endpoint is built from, managed by the bridge
+    struct device_type_template *device_type_template;
+#endif
 } device_t;
 
 typedef esp_err_t (*bridge_device_type_callback_t)(esp_matter::endpoint_t *ep, uint32_t device_type_id, void *priv_data);
 
 esp_err_t get_bridged_endpoint_ids(uint16_t *matter_endpoint_id_array);
 
+// The number of stored bridged devices, resumed or suspended
+size_t get_bridged_device_count();
+
+// Copy the endpoint ids of up to *count stored bridged devices, *count is set to the number of ids copied
+esp_err_t get_bridged_endpoint_ids(uint16_t *endpoint_ids, size_t *count);
+
 esp_err_t erase_bridged_device_info(uint16_t matter_endpoint_id);
 
 device_t *create_device(esp_matter::node_t *node, uint16_t parent_endpoint_id, uint32_t device_type_id,
@@ -47,10 +63,35 @@ device_t *create_device(esp_matter::node_t *node, uint16_t parent_endpoint_id, u
 
 device_t *resume_device(esp_matter::node_t *node, uint16_t device_endpoint_id, void *priv_data);
 
+// Create count bridged devices under the same parent endpoint and persist them with a single NVS write. Either all
+// the devices are created or none: on failure the devices array is cleared. priv_data can be NULL.
+esp_err_t create_devices(esp_matter::node_t *node, uint16_t parent_endpoint_id, const uint32_t *device_type_ids,
+                         void *const *priv_data, size_t count, device_t **devices);
+
+// Resume the stored bridged devices from the persistent info read by initialize(), the first MAX_BRIDGED_DEVICE_COUNT
+// ones if more are stored. priv_data and devices are indexed as the array filled by get_bridged_endpoint_ids() and hold
+// MAX_BRIDGED_DEVICE_COUNT entries, priv_data can be NULL. See resume_devices() for the devices which are not resumed.
+esp_err_t resume_all(esp_matter::node_t *node, void *const *priv_data, device_t **devices);
+
+// Resume the stored bridged devices on the given endpoints, for example the ones which are online when there are more
+// stored devices than endpoints. The devices which cannot be resumed are left NULL, the ones skipped because the
+// endpoints are used up stay stored. The others are removed from the storage with a single NVS write.
+esp_err_t resume_devices(esp_matter::node_t *node, const uint16_t *endpoint_ids, void *const *priv_data, size_t count,
+                         device_t **devices);
+
+// Destroy the endpoint of a bridged device, typically offline, but keep its persistent info so that it is resumed
+// later with the same endpoint id by resume_device(). Only the RAM of the endpoint is released, its nonvolatile
+// attribute values stay in NVS and are restored when it is resumed.
+esp_err_t suspend_device(device_t *bridged_device);
+
 esp_err_t set_device_type(device_t *bridged_device, uint32_t device_type_id, void *priv_data);
 
 esp_err_t remove_device(device_t *bridged_device);
 
+// With CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE, device_type_cb runs once per device type: the next bridged
+// devices of that type are built from a template of the clusters it added, see
+// esp_matter::endpoint::capture_template().
+// The template is freed when the last device built from it is removed or suspended.
 esp_err_t initialize(esp_matter::node_t *node, bridge_device_type_callback_t device_type_cb);
 
 esp_err_t factory_reset();
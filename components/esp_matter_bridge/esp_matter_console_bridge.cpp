@@ -197,36 +197,41 @@ static esp_err_t bridge_initialize()
         return err;
     }
 
-    uint16_t matter_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
-    esp_matter_bridge::get_bridged_endpoint_ids(matter_endpoint_id_array);
+    // Resume all the stored devices in one pass
+    esp_matter_bridge::device_t **devices =
+        (esp_matter_bridge::device_t **)esp_matter_mem_calloc(MAX_BRIDGED_DEVICE_COUNT, sizeof(*devices));
+    if (!devices) {
+        ESP_LOGE(TAG, "Failed to allocate memory for bridged devices");
+        return ESP_ERR_NO_MEM;
+    }
+    if (esp_matter_bridge::resume_all(node, NULL, devices) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to resume some bridged devices");
+    }
     for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
-        if (matter_endpoint_id_array[idx] != chip::kInvalidEndpointId) {
-            cli_bridged_device_t *new_cli_dev =
-                (cli_bridged_device_t *)esp_matter_mem_calloc(1, sizeof(cli_bridged_device_t));
-            if (!(new_cli_dev)) {
-                ESP_LOGE(TAG, "Failed to allocate memory for bridged device");
-                return ESP_ERR_NO_MEM;
-            }
-
-            new_cli_dev->device = esp_matter_bridge::resume_device(node, matter_endpoint_id_array[idx], NULL);
-            if (!(new_cli_dev->device)) {
-                ESP_LOGE(TAG, "Failed to resume the bridged device");
-                esp_matter_mem_free(new_cli_dev);
-                continue;
-            }
-
-            if (esp_matter::endpoint::enable(new_cli_dev->device->endpoint) != ESP_OK) {
-                ESP_LOGE(TAG, "Failed to enable endpoint");
-                esp_matter_bridge::remove_device(new_cli_dev->device);
-                esp_matter_mem_free(new_cli_dev);
-                continue;
-            }
-            new_cli_dev->next = cli_device;
-            cli_device = new_cli_dev;
-            ESP_LOGI(TAG, "Resume endpoint 0x%04" PRIX16, matter_endpoint_id_array[idx]);
+        if (!devices[idx]) {
+            continue;
+        }
+        cli_bridged_device_t *new_cli_dev =
+            (cli_bridged_device_t *)esp_matter_mem_calloc(1, sizeof(cli_bridged_device_t));
+        if (!(new_cli_dev)) {
+            ESP_LOGE(TAG, "Failed to allocate memory for bridged device");
+            err = ESP_ERR_NO_MEM;
+            break;
         }
+        new_cli_dev->device = devices[idx];
+        uint16_t endpoint_id = new_cli_dev->device->persistent_info.device_endpoint_id;
+        if (esp_matter::endpoint::enable(new_cli_dev->device->endpoint) != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to enable endpoint");
+            esp_matter_bridge::remove_device(new_cli_dev->device);
+            esp_matter_mem_free(new_cli_dev);
+            continue;
+        }
+        new_cli_dev->next = cli_device;
+        cli_device = new_cli_dev;
+        ESP_LOGI(TAG, "Resume endpoint 0x%04" PRIX16, endpoint_id);
     }
-    return ESP_OK;
+    esp_matter_mem_free(devices);
+    return err;
 }
 
 static esp_err_t bridge_dispatch(int argc, char *argv[])
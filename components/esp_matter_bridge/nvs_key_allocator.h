@@ -32,6 +32,10 @@ inline StorageKeyName endpoint_pesistent_info(uint16_t endpoint_id)
 {
     return StorageKeyName::Formatted("b/%x/pi", endpoint_id);
 }
+inline StorageKeyName device_info_table()
+{
+    return StorageKeyName::FromConst("b/dit");
+}
 
 } // namespace nvs_key_allocator
 
@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_timer.h>
+#include <esp_matter.h>
+#include <esp_matter_bridge.h>
+#include <esp_matter_mem.h>
+
+#include "bridge_test_common.h"
+
+using namespace esp_matter;
+using esp_matter_bridge::test::add_device_type;
+using esp_matter_bridge::test::get_stored_table_size;
+using esp_matter_bridge::test::setup_bridge;
+
+static constexpr size_t k_device_count = 6;
+
+TEST_CASE("bridged devices are created and resumed in bulk", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+
+    uint32_t device_type_ids[k_device_count];
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        device_type_ids[idx] = endpoint::on_off_light::get_device_type_id();
+    }
+    esp_matter_bridge::device_t *devices[MAX_BRIDGED_DEVICE_COUNT] = {};
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::create_devices(node, aggregator_id, device_type_ids, nullptr,
+                                                                k_device_count, devices));
+    TEST_ASSERT_EQUAL(k_device_count * sizeof(esp_matter_bridge::device_persistent_info_t), get_stored_table_size());
+
+    uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::get_bridged_endpoint_ids(endpoint_ids));
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        TEST_ASSERT_NOT_NULL(devices[idx]);
+        TEST_ASSERT_EQUAL_UINT16(endpoint::get_id(devices[idx]->endpoint), endpoint_ids[idx]);
+        TEST_ASSERT_EQUAL_UINT16(aggregator_id, devices[idx]->persistent_info.parent_endpoint_id);
+    }
+
+    // Reboot: drop the endpoints but keep the storage, then read it and resume everything
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, devices[idx]->endpoint));
+        esp_matter_mem_free(devices[idx]);
+        devices[idx] = nullptr;
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::initialize(node, add_device_type));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::resume_all(node, nullptr, devices));
+    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
+        if (idx >= k_device_count) {
+            TEST_ASSERT_NULL(devices[idx]);
+            continue;
+        }
+        TEST_ASSERT_NOT_NULL(devices[idx]);
+        TEST_ASSERT_EQUAL_UINT16(endpoint_ids[idx], endpoint::get_id(devices[idx]->endpoint));
+        TEST_ASSERT_EQUAL_UINT32(endpoint::on_off_light::get_device_type_id(),
+                                 devices[idx]->persistent_info.device_type_id);
+        TEST_ASSERT_NOT_NULL(endpoint::get(node, endpoint_ids[idx]));
+    }
+
+    // Removing a device rewrites the table without it
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[0]));
+    TEST_ASSERT_EQUAL((k_device_count - 1) * sizeof(esp_matter_bridge::device_persistent_info_t),
+                      get_stored_table_size());
+    for (size_t idx = 1; idx < k_device_count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[idx]));
+    }
+    TEST_ASSERT_EQUAL(0, get_stored_table_size());
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
+
+TEST_CASE("bulk creation is undone when a device cannot be created", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+
+    // The device type callback rejects the last device
+    uint32_t device_type_ids[] = { endpoint::on_off_light::get_device_type_id(), 0xFFF1FC01 };
+    esp_matter_bridge::device_t *devices[2] = {};
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, esp_matter_bridge::create_devices(node, endpoint::get_id(aggregator),
+                                                                    device_type_ids, nullptr, 2, devices));
+    TEST_ASSERT_NULL(devices[0]);
+    TEST_ASSERT_NULL(devices[1]);
+    TEST_ASSERT_EQUAL(0, get_stored_table_size());
+    uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::get_bridged_endpoint_ids(endpoint_ids));
+    TEST_ASSERT_EQUAL_UINT16(chip::kInvalidEndpointId, endpoint_ids[0]);
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
+
+static esp_err_t set_legacy_blob(const char *key, const void *value, size_t len)
+{
+    nvs_handle_t handle;
+    esp_err_t err = nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE,
+                                            NVS_READWRITE, &handle);
+    if (err != ESP_OK) {
+        return err;
+    }
+    err = nvs_set_blob(handle, key, value, len);
+    if (err == ESP_OK) {
+        err = nvs_commit(handle);
+    }
+    nvs_close(handle);
+    return err;
+}
+
+static bool has_legacy_key(const char *key)
+{
+    nvs_handle_t handle;
+    if (nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READONLY,
+                                &handle) != ESP_OK) {
+        return false;
+    }
+    size_t len = 0;
+    bool found = nvs_get_blob(handle, key, nullptr, &len) == ESP_OK;
+    nvs_close(handle);
+    return found;
+}
+
+TEST_CASE("legacy bridged device info is erased once the table is stored", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+
+    // The storage of the older versions: the endpoint id array and one key per device
+    uint16_t endpoint_ids[MAX_BRIDGED_DEVICE_COUNT];
+    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
+        endpoint_ids[idx] = idx < 2 ? (uint16_t)(aggregator_id + 10 + idx) : chip::kInvalidEndpointId;
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, set_legacy_blob(nvs_key_allocator::endpoint_ids_array().KeyName(), endpoint_ids,
+                                              sizeof(endpoint_ids)));
+    for (size_t idx = 0; idx < 2; ++idx) {
+        esp_matter_bridge::device_persistent_info_t persistent_info = {
+            aggregator_id, endpoint_ids[idx], endpoint::on_off_light::get_device_type_id()};
+        StorageKeyName key = nvs_key_allocator::endpoint_pesistent_info(endpoint_ids[idx]);
+        TEST_ASSERT_EQUAL(ESP_OK, set_legacy_blob(key.KeyName(), &persistent_info, sizeof(persistent_info)));
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::initialize(node, add_device_type));
+    TEST_ASSERT_EQUAL(2, esp_matter_bridge::get_bridged_device_count());
+    TEST_ASSERT_EQUAL(2 * sizeof(esp_matter_bridge::device_persistent_info_t), get_stored_table_size());
+    TEST_ASSERT_FALSE(has_legacy_key(nvs_key_allocator::endpoint_ids_array().KeyName()));
+    for (size_t idx = 0; idx < 2; ++idx) {
+        TEST_ASSERT_FALSE(has_legacy_key(nvs_key_allocator::endpoint_pesistent_info(endpoint_ids[idx]).KeyName()));
+    }
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::factory_reset());
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
+
+TEST_CASE("bridged device creation cost", "[bridge][benchmark]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+    uint32_t device_type_ids[k_device_count];
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        device_type_ids[idx] = endpoint::on_off_light::get_device_type_id();
+    }
+    esp_matter_bridge::device_t *devices[k_device_count] = {};
+
+    int64_t start = esp_timer_get_time();
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        devices[idx] = esp_matter_bridge::create_device(node, aggregator_id, device_type_ids[idx], nullptr);
+        TEST_ASSERT_NOT_NULL(devices[idx]);
+    }
+    int64_t single_us = esp_timer_get_time() - start;
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[idx]));
+    }
+
+    start = esp_timer_get_time();
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::create_devices(node, aggregator_id, device_type_ids, nullptr,
+                                                                k_device_count, devices));
+    int64_t bulk_us = esp_timer_get_time() - start;
+
+    printf("%u devices: one by one %" PRId64 " us, in bulk %" PRId64 " us\n", (unsigned)k_device_count, single_us,
+           bulk_us);
+    for (size_t idx = 0; idx < k_device_count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[idx]));
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_bridge.h>
+
+#include "bridge_test_common.h"
+
+using namespace esp_matter;
+using namespace chip::app::Clusters;
+using esp_matter_bridge::test::add_device_type;
+using esp_matter_bridge::test::setup_bridge;
+
+#if CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
+static uint32_t s_callback_count = 0;
+
+static esp_err_t count_device_type(endpoint_t *ep, uint32_t device_type_id, void *priv_data)
+{
+    s_callback_count++;
+    return add_device_type(ep, device_type_id, priv_data);
+}
+
+static esp_matter_bridge::device_t *create_light(node_t *node, uint16_t aggregator_id)
+{
+    esp_matter_bridge::device_t *device = esp_matter_bridge::create_device(
+        node, aggregator_id, endpoint::on_off_light::get_device_type_id(), nullptr);
+    TEST_ASSERT_NOT_NULL(device);
+    return device;
+}
+
+static bool get_on_off(esp_matter_bridge::device_t *device)
+{
+    esp_matter_attr_val_t val = esp_matter_bool(false);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint::get_id(device->endpoint), OnOff::Id,
+                                                 OnOff::Attributes::OnOff::Id, &val));
+    return val.val.b;
+}
+
+TEST_CASE("bridged devices of a device type are built from its template", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::initialize(node, count_device_type));
+    s_callback_count = 0;
+
+    // A value set once the first device is built is not given to the next devices
+    esp_matter_bridge::device_t *first = create_light(node, aggregator_id);
+    attribute_t *on_off = attribute::get(endpoint::get_id(first->endpoint), OnOff::Id, OnOff::Attributes::OnOff::Id);
+    TEST_ASSERT_NOT_NULL(on_off);
+    esp_matter_attr_val_t val = esp_matter_bool(true);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(on_off, &val, false));
+    esp_matter_bridge::device_t *second = create_light(node, aggregator_id);
+    TEST_ASSERT_EQUAL_UINT32(1, s_callback_count);
+    TEST_ASSERT_NOT_NULL(cluster::get(second->endpoint, OnOff::Id));
+    TEST_ASSERT_FALSE(get_on_off(second));
+
+    // The template outlives the device it was captured from
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(first));
+    esp_matter_bridge::device_t *third = create_light(node, aggregator_id);
+    TEST_ASSERT_EQUAL_UINT32(1, s_callback_count);
+    TEST_ASSERT_FALSE(get_on_off(third));
+
+    // A device resumed from the template gets its own stored values back
+    uint16_t third_id = endpoint::get_id(third->endpoint);
+    on_off = attribute::get(third_id, OnOff::Id, OnOff::Attributes::OnOff::Id);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(on_off, &val, false));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::suspend_device(third));
+    third = esp_matter_bridge::resume_device(node, third_id, nullptr);
+    TEST_ASSERT_NOT_NULL(third);
+    TEST_ASSERT_EQUAL_UINT32(1, s_callback_count);
+    TEST_ASSERT_TRUE(get_on_off(third));
+
+    // The template is freed with the last device built from it, the next device runs the callback again
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(second));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(third));
+    esp_matter_bridge::device_t *fourth = create_light(node, aggregator_id);
+    TEST_ASSERT_EQUAL_UINT32(2, s_callback_count);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(fourth));
+
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::initialize(node, add_device_type));
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
+#endif // CONFIG_ESP_MATTER_BRIDGE_DEVICE_TYPE_TEMPLATE
@@ -0,0 +1,161 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_bridge.h>
+
+#include "bridge_test_common.h"
+
+using namespace esp_matter;
+using esp_matter_bridge::test::setup_bridge;
+
+static constexpr size_t k_max_stored_count = CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT + 4;
+
+// Create bridged devices until the endpoints are used up
+static size_t fill_endpoints(node_t *node, uint16_t aggregator_id, esp_matter_bridge::device_t **devices)
+{
+    size_t count = 0;
+    while (endpoint::get_count(node) < CONFIG_ESP_MATTER_MAX_DYNAMIC_ENDPOINT_COUNT) {
+        devices[count] = esp_matter_bridge::create_device(node, aggregator_id,
+                                                          endpoint::on_off_light::get_device_type_id(), nullptr);
+        TEST_ASSERT_NOT_NULL(devices[count]);
+        count++;
+    }
+    return count;
+}
+
+// Remove the resumed devices, then resume and remove the suspended ones
+static void remove_all(node_t *node, endpoint_t *aggregator, esp_matter_bridge::device_t **devices, size_t count)
+{
+    for (size_t idx = 0; idx < count; ++idx) {
+        if (devices[idx]) {
+            TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[idx]));
+        }
+    }
+    uint16_t endpoint_ids[k_max_stored_count];
+    size_t stored_count = k_max_stored_count;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::get_bridged_endpoint_ids(endpoint_ids, &stored_count));
+    for (size_t idx = 0; idx < stored_count; ++idx) {
+        esp_matter_bridge::device_t *device = esp_matter_bridge::resume_device(node, endpoint_ids[idx], nullptr);
+        TEST_ASSERT_NOT_NULL(device);
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(device));
+    }
+    TEST_ASSERT_EQUAL(0, esp_matter_bridge::get_bridged_device_count());
+    TEST_ASSERT_EQUAL(ESP_OK, endpoint::destroy(node, aggregator));
+}
+
+TEST_CASE("suspended bridged devices do not use an endpoint", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+    esp_matter_bridge::device_t *devices[k_max_stored_count] = {};
+    size_t count = fill_endpoints(node, aggregator_id, devices);
+    TEST_ASSERT_NULL(esp_matter_bridge::create_device(node, aggregator_id,
+                                                      endpoint::on_off_light::get_device_type_id(), nullptr));
+
+    // The endpoint of a suspended device is given to a new one, both stay stored
+    uint16_t suspended_id = endpoint::get_id(devices[0]->endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::suspend_device(devices[0]));
+    TEST_ASSERT_NULL(endpoint::get(node, suspended_id));
+    esp_matter_bridge::device_t *added = esp_matter_bridge::create_device(
+        node, aggregator_id, endpoint::on_off_light::get_device_type_id(), nullptr);
+    TEST_ASSERT_NOT_NULL(added);
+    TEST_ASSERT_NOT_EQUAL(suspended_id, endpoint::get_id(added->endpoint));
+    TEST_ASSERT_EQUAL(count + 1, esp_matter_bridge::get_bridged_device_count());
+
+    // No endpoint is left to resume the suspended device, it is kept for later
+    TEST_ASSERT_NULL(esp_matter_bridge::resume_device(node, suspended_id, nullptr));
+    TEST_ASSERT_EQUAL(count + 1, esp_matter_bridge::get_bridged_device_count());
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::suspend_device(added));
+    devices[0] = esp_matter_bridge::resume_device(node, suspended_id, nullptr);
+    TEST_ASSERT_NOT_NULL(devices[0]);
+    TEST_ASSERT_EQUAL_UINT16(suspended_id, endpoint::get_id(devices[0]->endpoint));
+
+    remove_all(node, aggregator, devices, count);
+}
+
+TEST_CASE("only the selected bridged devices are resumed", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+    esp_matter_bridge::device_t *devices[k_max_stored_count] = {};
+    size_t count = fill_endpoints(node, aggregator_id, devices);
+    TEST_ASSERT_GREATER_OR_EQUAL(2, count);
+    uint16_t endpoint_ids[k_max_stored_count];
+    size_t stored_count = k_max_stored_count;
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::get_bridged_endpoint_ids(endpoint_ids, &stored_count));
+    TEST_ASSERT_EQUAL(count, stored_count);
+    for (size_t idx = 0; idx < count; ++idx) {
+        TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::suspend_device(devices[idx]));
+    }
+
+    // Resume the devices which are online, the even ones
+    uint16_t online_ids[k_max_stored_count];
+    size_t online_count = 0;
+    for (size_t idx = 0; idx < count; idx += 2) {
+        online_ids[online_count++] = endpoint_ids[idx];
+    }
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::resume_devices(node, online_ids, nullptr, online_count, devices));
+    for (size_t idx = 0; idx < count; ++idx) {
+        TEST_ASSERT_EQUAL(idx % 2 == 0, endpoint::get(node, endpoint_ids[idx]) != nullptr);
+    }
+    TEST_ASSERT_EQUAL(count, esp_matter_bridge::get_bridged_device_count());
+
+    remove_all(node, aggregator, devices, online_count);
+}
+
+TEST_CASE("endpoint ids of the removed bridged devices are not reused", "[bridge]")
+{
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    uint16_t aggregator_id = endpoint::get_id(aggregator);
+    uint32_t device_type_ids[3];
+    for (size_t idx = 0; idx < 3; ++idx) {
+        device_type_ids[idx] = endpoint::on_off_light::get_device_type_id();
+    }
+    esp_matter_bridge::device_t *devices[3] = {};
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::create_devices(node, aggregator_id, device_type_ids, nullptr, 3,
+                                                                devices));
+    uint16_t first_id = endpoint::get_id(devices[0]->endpoint);
+    uint16_t last_id = endpoint::get_id(devices[2]->endpoint);
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[2]));
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::remove_device(devices[0]));
+    devices[0] = esp_matter_bridge::create_device(node, aggregator_id, device_type_ids[0], nullptr);
+    TEST_ASSERT_NOT_NULL(devices[0]);
+    TEST_ASSERT_GREATER_THAN_UINT16(last_id, endpoint::get_id(devices[0]->endpoint));
+    TEST_ASSERT_NOT_EQUAL(first_id, endpoint::get_id(devices[0]->endpoint));
+
+    remove_all(node, aggregator, devices, 2);
+}
+
+TEST_CASE("suspended bridged devices keep their attribute values", "[bridge]")
+{
+    using namespace chip::app::Clusters;
+    node_t *node = nullptr;
+    endpoint_t *aggregator = setup_bridge(&node);
+    esp_matter_bridge::device_t *device = esp_matter_bridge::create_device(
+        node, endpoint::get_id(aggregator), endpoint::on_off_light::get_device_type_id(), nullptr);
+    TEST_ASSERT_NOT_NULL(device);
+    uint16_t endpoint_id = endpoint::get_id(device->endpoint);
+    attribute_t *on_off = attribute::get(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id);
+    TEST_ASSERT_NOT_NULL(on_off);
+    esp_matter_attr_val_t val = esp_matter_bool(true);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::set_val(on_off, &val, false));
+
+    // Only the RAM of the endpoint is released, the value stored in NVS is restored on resume
+    TEST_ASSERT_EQUAL(ESP_OK, esp_matter_bridge::suspend_device(device));
+    TEST_ASSERT_NULL(endpoint::get(node, endpoint_id));
+    device = esp_matter_bridge::resume_device(node, endpoint_id, nullptr);
+    TEST_ASSERT_NOT_NULL(device);
+    val = esp_matter_bool(false);
+    TEST_ASSERT_EQUAL(ESP_OK, attribute::get_val(endpoint_id, OnOff::Id, OnOff::Attributes::OnOff::Id, &val));
+    TEST_ASSERT_TRUE(val.val.b);
+
+    remove_all(node, aggregator, &device, 1);
+}
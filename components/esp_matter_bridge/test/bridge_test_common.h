@@ -0,0 +1,61 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <unity.h>
+#include <esp_matter.h>
+#include <esp_matter_bridge.h>
+#include <nvs.h>
+#include <nvs_flash.h>
+#include <nvs_key_allocator.h>
+
+namespace esp_matter_bridge::test {
+
+inline esp_err_t add_device_type(esp_matter::endpoint_t *ep, uint32_t device_type_id, void *priv_data)
+{
+    if (device_type_id != esp_matter::endpoint::on_off_light::get_device_type_id()) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    esp_matter::endpoint::on_off_light::config_t config;
+    return esp_matter::endpoint::on_off_light::add(ep, &config);
+}
+
+// Create an aggregator and start from an empty bridge storage
+inline esp_matter::endpoint_t *setup_bridge(esp_matter::node_t **node)
+{
+    *node = esp_matter::node::get();
+    if (!*node) {
+        TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_init());
+        esp_matter::node::config_t node_config;
+        *node = esp_matter::node::create(&node_config, nullptr, nullptr);
+        TEST_ASSERT_NOT_NULL(*node);
+    }
+    esp_matter::endpoint::aggregator::config_t aggregator_config;
+    esp_matter::endpoint_t *aggregator = esp_matter::endpoint::aggregator::create(
+        *node, &aggregator_config, esp_matter::ENDPOINT_FLAG_DESTROYABLE, nullptr);
+    TEST_ASSERT_NOT_NULL(aggregator);
+    TEST_ASSERT_EQUAL(ESP_OK, initialize(*node, add_device_type));
+    TEST_ASSERT_EQUAL(ESP_OK, factory_reset());
+    return aggregator;
+}
+
+inline size_t get_stored_table_size()
+{
+    nvs_handle_t handle;
+    size_t len = 0;
+    if (nvs_open_from_partition(CONFIG_ESP_MATTER_BRIDGE_INFO_PART_NAME, ESP_MATTER_BRIDGE_NAMESPACE, NVS_READONLY,
+                                &handle) != ESP_OK) {
+        return 0;
+    }
+    if (nvs_get_blob(handle, nvs_key_allocator::device_info_table().KeyName(), nullptr, &len) != ESP_OK) {
+        len = 0;
+    }
+    nvs_close(handle);
+    return len;
+}
+
+} // namespace esp_matter_bridge::test
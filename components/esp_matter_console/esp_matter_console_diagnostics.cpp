@@ -14,8 +14,13 @@
 
 #include <esp_heap_caps.h>
 #include <esp_log.h>
+#include <esp_matter_boot_profile.h>
 #include <esp_matter_console.h>
+#include <esp_matter_latency.h>
+#include <esp_matter_trace.h>
 #include <esp_timer.h>
+#include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 namespace esp_matter {
@@ -43,6 +48,134 @@ static esp_err_t up_time_console_handler(int argc, char *argv[])
     return ESP_OK;
 }
 
+static void trace_decode(const trace::record_t &record)
+{
+    switch (record.event) {
+    case trace::EVENT_ATTRIBUTE_UPDATE:
+        printf("%10" PRIu32 " us %6" PRIu32 " us update  0x%04" PRIX16 "/0x%08" PRIX32 "/0x%08" PRIX32
+               " type 0x%02x value 0x%08" PRIX32 " err 0x%" PRIx32 "\n",
+               record.timestamp_us, record.latency_us, record.endpoint_id, record.cluster_id, record.id,
+               record.val_type, record.value, (uint32_t)record.err);
+        break;
+    case trace::EVENT_COMMAND:
+        printf("%10" PRIu32 " us %6" PRIu32 " us command 0x%04" PRIX16 "/0x%08" PRIX32 "/0x%08" PRIX32
+               " err 0x%" PRIx32 "\n",
+               record.timestamp_us, record.latency_us, record.endpoint_id, record.cluster_id, record.id,
+               (uint32_t)record.err);
+        break;
+    default:
+        printf("%10" PRIu32 " us unknown event %u\n", record.timestamp_us, record.event);
+        break;
+    }
+}
+
+static void trace_dump(const trace::record_t &record)
+{
+    const uint8_t *bytes = (const uint8_t *)&record;
+    for (size_t index = 0; index < sizeof(record); ++index) {
+        printf("%02x", bytes[index]);
+    }
+    printf("\n");
+}
+
+static esp_err_t trace_console_handler(int argc, char *argv[])
+{
+    if (!trace::is_enabled()) {
+        printf("%s: Trace is disabled, enable CONFIG_ESP_MATTER_TRACE\n", TAG);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (argc == 1 && strncmp(argv[0], "clear", sizeof("clear")) == 0) {
+        trace::clear();
+        return ESP_OK;
+    }
+    bool dump = argc == 1 && strncmp(argv[0], "dump", sizeof("dump")) == 0;
+    if (argc > 1 || (argc == 1 && !dump && strncmp(argv[0], "decode", sizeof("decode")) != 0)) {
+        printf("%s: Usage: matter esp diagnostics trace [decode|dump|clear]\n", TAG);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t capacity = trace::get_capacity();
+    trace::record_t *records = (trace::record_t *)calloc(capacity, sizeof(trace::record_t));
+    if (!records) {
+        printf("%s: Not enough memory to read %u trace records\n", TAG, (unsigned)capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t count = trace::read(records, capacity);
+    for (size_t index = 0; index < count; ++index) {
+        if (dump) {
+            trace_dump(records[index]);
+        } else {
+            trace_decode(records[index]);
+        }
+    }
+    free(records);
+    printf("%s: %u trace records\n", TAG, (unsigned)count);
+    return ESP_OK;
+}
+
+static esp_err_t latency_console_handler(int argc, char *argv[])
+{
+    if (!latency::is_enabled()) {
+        printf("%s: Latency statistics are disabled, enable CONFIG_ESP_MATTER_LATENCY_STATS\n", TAG);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (argc == 1 && strncmp(argv[0], "reset", sizeof("reset")) == 0) {
+        latency::reset();
+        return ESP_OK;
+    }
+    if (argc > 0) {
+        printf("%s: Usage: matter esp diagnostics latency [reset]\n", TAG);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t capacity = latency::get_capacity();
+    latency::histogram_t *histograms = (latency::histogram_t *)calloc(capacity, sizeof(latency::histogram_t));
+    if (!histograms) {
+        printf("%s: Not enough memory to read %u latency histograms\n", TAG, (unsigned)capacity);
+        return ESP_ERR_NO_MEM;
+    }
+    size_t count = latency::get_histograms(histograms, capacity);
+    printf("%-6s %-10s %-10s %8s %8s %8s %8s %8s\n", "ep", "cluster", "operation", "count", "avg_us", "p50_us",
+           "p99_us", "max_us");
+    for (size_t index = 0; index < count; ++index) {
+        const latency::histogram_t &histogram = histograms[index];
+        char endpoint[8] = "*";
+        char cluster[12] = "*";
+        if (histogram.endpoint_id != latency::k_any_endpoint_id) {
+            snprintf(endpoint, sizeof(endpoint), "%u", histogram.endpoint_id);
+        }
+        if (histogram.cluster_id != latency::k_any_cluster_id) {
+            snprintf(cluster, sizeof(cluster), "0x%08" PRIx32, histogram.cluster_id);
+        }
+        uint32_t average_us = histogram.count > 0 ? (uint32_t)(histogram.total_us / histogram.count) : 0;
+        printf("%-6s %-10s %-10s %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n", endpoint,
+               cluster, latency::get_operation_name(histogram.operation), histogram.count, average_us,
+               latency::get_percentile_us(histogram, 50), latency::get_percentile_us(histogram, 99),
+               histogram.max_us);
+    }
+    free(histograms);
+    printf("%s: %u latency histograms\n", TAG, (unsigned)count);
+    return ESP_OK;
+}
+
+static esp_err_t boot_console_handler(int argc, char *argv[])
+{
+    if (!boot_profile::is_enabled()) {
+        printf("%s: Boot phase timing is disabled, enable CONFIG_ESP_MATTER_BOOT_PROFILE\n", TAG);
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    printf("%-20s %10s %6s %10s %10s\n", "phase", "total_us", "count", "start_us", "end_us");
+    for (uint8_t phase = 0; phase < boot_profile::PHASE_COUNT; ++phase) {
+        boot_profile::phase_stats_t stats;
+        if (boot_profile::get((boot_profile::phase_t)phase, &stats) != ESP_OK || stats.count == 0) {
+            continue;
+        }
+        printf("%-20s %10" PRIu32 " %6" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n", boot_profile::get_phase_name(phase),
+               stats.total_us, stats.count, stats.start_us, stats.end_us);
+    }
+    return ESP_OK;
+}
+
 static esp_err_t diagnostics_dispatch(int argc, char **argv)
 {
     if (argc <= 0) {
@@ -71,6 +204,24 @@ esp_err_t diagnostics_register_commands()
             .description = "print the uptime of the device",
             .handler = up_time_console_handler,
         },
+        {
+            .name = "trace",
+            .description = "print the binary trace of the attribute updates and commands. "
+                           "Usage: matter esp diagnostics trace [decode|dump|clear]",
+            .handler = trace_console_handler,
+        },
+        {
+            .name = "latency",
+            .description = "print the latency histograms of the reads, writes, commands, attribute callbacks and NVS "
+                           "writes. Usage: matter esp diagnostics latency [reset]",
+            .handler = latency_console_handler,
+        },
+        {
+            .name = "boot",
+            .description = "print the timing of the boot phases, from the data model build to the DNS-SD "
+                           "initialization. Usage: matter esp diagnostics boot",
+            .handler = boot_console_handler,
+        },
     };
     diagnostics_console.register_commands(diagnostics_commands, sizeof(diagnostics_commands) / sizeof(command_t));
 
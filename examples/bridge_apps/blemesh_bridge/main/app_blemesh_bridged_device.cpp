@@ -43,6 +43,11 @@ bool app_blemesh_bridged_device_t::check_dev_addr(const void *addr_ctx)
     return false;
 }
 
+uint32_t app_blemesh_bridged_device_t::hash_dev_addr(const void *addr_ctx)
+{
+    return ((const blemesh_device_addr_t *)addr_ctx)->blemesh_addr;
+}
+
 esp_err_t app_blemesh_bridged_device_t::delete_dev_addr()
 {
     if (m_dev_addr_ctx) {
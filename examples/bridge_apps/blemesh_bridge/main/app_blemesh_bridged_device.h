@@ -20,6 +20,8 @@ public:
 
     bool check_dev_addr(const void *addr_ctx) override;
 
+    static uint32_t hash_dev_addr(const void *addr_ctx);
+
     esp_err_t delete_dev_addr() override;
 
     esp_err_t store_dev_addr() override;
@@ -72,8 +72,9 @@ static esp_err_t app_attribute_update_cb(callback_type_t type, uint16_t endpoint
                                          uint32_t attribute_id, esp_matter_attr_val_t *val, void *priv_data)
 {
     esp_err_t err = ESP_OK;
-    if (type == PRE_UPDATE) {
-        err = blemesh_bridge_attribute_update(endpoint_id, cluster_id, attribute_id, val, (app_bridged_device_t *)priv_data);
+    if (type == PRE_UPDATE && priv_data) {
+        // Sent to the bridged device now or when the window of CONFIG_APP_BRIDGE_SHADOW_WINDOW_MS ends
+        err = app_bridge_shadow_write((app_bridged_device_t *)priv_data, cluster_id, attribute_id, val);
     }
     return err;
 }
@@ -147,11 +148,15 @@ extern "C" void app_main()
 
     aggregator_endpoint_id = endpoint::get_id(aggregator);
 
+    err = app_bridge_shadow_enable(blemesh_bridge_attribute_update, CONFIG_APP_BRIDGE_SHADOW_WINDOW_MS);
+    ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to enable the bridge shadow state, err:%d", err));
+
     /* Matter start */
     err = esp_matter::start(app_event_cb);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to start Matter, err:%d", err));
 
-    err = app_bridge_initialize(node, create_bridge_devices, create_blemesh_bridged_device, free_blemesh_bridged_device);
+    err = app_bridge_initialize(node, create_bridge_devices, create_blemesh_bridged_device, free_blemesh_bridged_device,
+                                app_blemesh_bridged_device_t::hash_dev_addr);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to resume the bridged endpoints: %d", err));
 
 #if CONFIG_ENABLE_CHIP_SHELL
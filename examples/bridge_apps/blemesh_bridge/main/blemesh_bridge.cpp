@@ -80,8 +80,11 @@ esp_err_t blemesh_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster
                          attribute_id);
                 blemesh_device_addr_t *dev_addr = (blemesh_device_addr_t *)bridged_device->get_dev_addr();
                 app_ble_mesh_onoff_set(dev_addr->blemesh_addr, val->val.b);
+                return ESP_OK;
             }
         }
+        // Only the OnOff attribute is bridged to the BLE mesh node
+        return ESP_ERR_NOT_SUPPORTED;
     } else {
         ESP_LOGE(TAG, "Unable to Update Bridge Device, ep: 0x%x, cluster: 0x%lx, att: 0x%lx", endpoint_id, cluster_id,
                  attribute_id);
@@ -43,6 +43,11 @@ bool app_espnow_bridged_device_t::check_dev_addr(const void *addr_ctx)
     return false;
 }
 
+uint32_t app_espnow_bridged_device_t::hash_dev_addr(const void *addr_ctx)
+{
+    return app_bridge_hash_bytes(((const espnow_device_addr_t *)addr_ctx)->espnow_macaddr, 6);
+}
+
 esp_err_t app_espnow_bridged_device_t::delete_dev_addr()
 {
     if (m_dev_addr_ctx) {
@@ -193,7 +193,8 @@ extern "C" void app_main()
     err = esp_matter::start(app_event_cb);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to start Matter, err:%d", err));
 
-    err = app_bridge_initialize(node, create_bridge_devices, create_espnow_bridged_device, free_espnow_bridged_device);
+    err = app_bridge_initialize(node, create_bridge_devices, create_espnow_bridged_device, free_espnow_bridged_device,
+                                app_espnow_bridged_device_t::hash_dev_addr);
     ABORT_APP_ON_FAILURE(err == ESP_OK, ESP_LOGE(TAG, "Failed to resume the bridged endpoints: %d", err));
 
     app_espnow_init();
@@ -48,6 +48,14 @@ bool app_rainmaker_bridged_device_t::check_dev_addr(const void *addr_ctx)
     return false;
 }
 
+uint32_t app_rainmaker_bridged_device_t::hash_dev_addr(const void *addr_ctx)
+{
+    // Only the node id is compared
+    const rainmaker_device_addr_t *dev_addr = (const rainmaker_device_addr_t *)addr_ctx;
+    return app_bridge_hash_bytes(dev_addr->rainmaker_node_id,
+                                 strnlen(dev_addr->rainmaker_node_id, sizeof(dev_addr->rainmaker_node_id) - 1));
+}
+
 esp_err_t app_rainmaker_bridged_device_t::delete_dev_addr()
 {
     if (m_dev_addr_ctx) {
@@ -43,6 +43,13 @@ bool app_zigbee_bridged_device_t::check_dev_addr(const void *addr_ctx)
     return false;
 }
 
+uint32_t app_zigbee_bridged_device_t::hash_dev_addr(const void *addr_ctx)
+{
+    const zigbee_device_addr_t *dev_addr = (const zigbee_device_addr_t *)addr_ctx;
+    // The padding byte of the address is not hashed
+    return ((uint32_t)dev_addr->shortaddr << 8) | dev_addr->endpoint_id;
+}
+
 esp_err_t app_zigbee_bridged_device_t::delete_dev_addr()
 {
     if (m_dev_addr_ctx) {
@@ -68,8 +68,11 @@ esp_err_t zigbee_bridge_attribute_update(uint16_t endpoint_id, uint32_t cluster_
                     esp_zb_zcl_on_off_cmd_req(&cmd_req);
                     esp_zb_lock_release();
                 }
+                return ESP_OK;
             }
         }
+        // Only the OnOff attribute is bridged to the zigbee device
+        return ESP_ERR_NOT_SUPPORTED;
     } else {
         ESP_LOGE(TAG, "Unable to Update Bridge Device, ep: %" PRId16 ", cluster: %" PRId32 ", att: %" PRId32 "", endpoint_id, cluster_id, attribute_id);
     }
@@ -16,6 +16,7 @@
 #include <esp_log.h>
 #include <esp_matter.h>
 #include <esp_matter_bridge.h>
+#include <esp_matter_mem.h>
 #include <nvs.h>
 #include <string.h>
 
@@ -29,7 +30,9 @@ using namespace esp_matter;
 
 static const char *TAG = "app_bridged_device";
 app_bridged_device_t *g_bridged_device_list = nullptr;
-static uint8_t g_current_bridged_device_count = 0;
+static app_bridged_device_index_t g_bridged_device_index;
+static app_bridged_device_shadow_t g_bridged_device_shadow;
+static bool g_bridged_device_shadow_enabled = false;
 static create_device_callback_t g_create_device_cb = nullptr;
 static free_device_callback_t g_free_device_cb = nullptr;
 
@@ -52,7 +55,8 @@ esp_err_t map_matter_error(CHIP_ERROR error)
 
 /** Bridged Device APIs */
 esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_type_callback_t device_type_cb,
-                                create_device_callback_t create_cb, free_device_callback_t free_cb)
+                                create_device_callback_t create_cb, free_device_callback_t free_cb,
+                                dev_addr_hash_callback_t hash_cb)
 {
     // Free_callback can be null if the user doesn't want to delete app_bridged_device_t app_bridge_remove_device()
     VerifyOrReturnValue(node && device_type_cb && create_cb, ESP_ERR_INVALID_ARG);
@@ -62,30 +66,69 @@ esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_t
         return err;
     }
     g_bridged_device_list = nullptr;
-    g_current_bridged_device_count = 0;
+    g_bridged_device_index.clear();
+    g_bridged_device_index.set_hash_callback(hash_cb);
     g_create_device_cb = create_cb;
     g_free_device_cb = free_cb;
     uint16_t matter_endpoint_id_array[MAX_BRIDGED_DEVICE_COUNT];
     esp_matter_bridge::get_bridged_endpoint_ids(matter_endpoint_id_array);
+    // The bridged devices followed by the resumed Matter devices, indexed as the endpoint id array
+    void **resume_ctx = (void **)esp_matter_mem_calloc(2 * MAX_BRIDGED_DEVICE_COUNT, sizeof(void *));
+    VerifyOrReturnValue(resume_ctx, ESP_ERR_NO_MEM);
+    app_bridged_device_t **bridged_devices = (app_bridged_device_t **)resume_ctx;
+    esp_matter_bridge::device_t **matter_devices = (esp_matter_bridge::device_t **)&resume_ctx[MAX_BRIDGED_DEVICE_COUNT];
+    bool created = true;
     for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
         if (matter_endpoint_id_array[idx] != chip::kInvalidEndpointId) {
-            app_bridged_device_t *bridged_device = create_cb(node, matter_endpoint_id_array[idx]);
-            if (!bridged_device) {
+            bridged_devices[idx] = create_cb(node, matter_endpoint_id_array[idx]);
+            if (!bridged_devices[idx]) {
                 ESP_LOGE(TAG, "Failed to resume the endpoint %u", matter_endpoint_id_array[idx]);
-                return ESP_FAIL;
+                err = ESP_FAIL;
+                created = false;
+                break;
             }
-            bridged_device->set_matter_device(esp_matter_bridge::resume_device(node, matter_endpoint_id_array[idx], bridged_device));
-            VerifyOrReturnValue(bridged_device->get_matter_device(), ESP_ERR_NO_MEM);
-            err = bridged_device->restore_dev_addr();
-            VerifyOrReturnValue(err == ESP_OK, err);
-            bridged_device->set_next(g_bridged_device_list);
-            g_bridged_device_list = bridged_device;
-            g_current_bridged_device_count++;
-            // Enable the resumed endpoint
-            esp_matter::endpoint::enable(bridged_device->get_matter_device()->endpoint);
         }
     }
-    return ESP_OK;
+    // Resume all the endpoints in one pass, from the device info read by esp_matter_bridge::initialize()
+    if (created && esp_matter_bridge::resume_all(node, resume_ctx, matter_devices) != ESP_OK) {
+        ESP_LOGW(TAG, "Failed to resume some bridged devices, they are removed");
+    }
+    for (size_t idx = 0; idx < MAX_BRIDGED_DEVICE_COUNT; ++idx) {
+        app_bridged_device_t *bridged_device = bridged_devices[idx];
+        if (!bridged_device) {
+            continue;
+        }
+        if (!created || !matter_devices[idx]) {
+            if (g_free_device_cb) {
+                g_free_device_cb(bridged_device);
+            }
+            continue;
+        }
+        bridged_device->set_matter_device(matter_devices[idx]);
+        esp_err_t restore_err = bridged_device->restore_dev_addr();
+        if (restore_err == ESP_OK) {
+            restore_err = g_bridged_device_index.add(bridged_device);
+        }
+        if (restore_err != ESP_OK) {
+            ESP_LOGE(TAG, "Failed to restore the bridged device on endpoint %u, removing it",
+                     matter_endpoint_id_array[idx]);
+            err = err == ESP_OK ? restore_err : err;
+            // A device without its address cannot be reached, remove its resumed endpoint and its stored info
+            bridged_device->erase_dev_addr();
+            bridged_device->delete_dev_addr();
+            esp_matter_bridge::remove_device(matter_devices[idx]);
+            if (g_free_device_cb) {
+                g_free_device_cb(bridged_device);
+            }
+            continue;
+        }
+        bridged_device->set_next(g_bridged_device_list);
+        g_bridged_device_list = bridged_device;
+        // Enable the resumed endpoint
+        esp_matter::endpoint::enable(bridged_device->get_matter_device()->endpoint);
+    }
+    esp_matter_mem_free(resume_ctx);
+    return err;
 }
 
 esp_err_t app_bridge_create_new_device(node_t *node, uint16_t parent_endpoint_id, uint32_t matter_device_type_id,
@@ -93,7 +136,7 @@ esp_err_t app_bridge_create_new_device(node_t *node, uint16_t parent_endpoint_id
 {
     VerifyOrReturnValue(node && parent_endpoint_id != chip::kInvalidEndpointId, ESP_ERR_INVALID_ARG);
     VerifyOrReturnValue(g_create_device_cb, ESP_ERR_INVALID_STATE);
-    if (g_current_bridged_device_count >= MAX_BRIDGED_DEVICE_COUNT) {
+    if (g_bridged_device_index.get_count() >= MAX_BRIDGED_DEVICE_COUNT) {
         ESP_LOGE(TAG, "The device list is full, could not add bridged device");
         return ESP_ERR_NO_MEM;
     }
@@ -112,9 +155,17 @@ esp_err_t app_bridge_create_new_device(node_t *node, uint16_t parent_endpoint_id
     }
     bridged_device->set_dev_addr(addr_ctx);
     bridged_device->set_priv_data(priv_data);
+    if (g_bridged_device_index.add(bridged_device) != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to index the bridged device");
+        esp_matter_bridge::remove_device(bridged_device->get_matter_device());
+        bridged_device->delete_dev_addr();
+        if (g_free_device_cb) {
+            g_free_device_cb(bridged_device);
+        }
+        return ESP_ERR_NO_MEM;
+    }
     bridged_device->set_next(g_bridged_device_list);
     g_bridged_device_list = bridged_device;
-    g_current_bridged_device_count++;
 
     if (ESP_OK != bridged_device->store_dev_addr()) {
         ESP_LOGW(TAG, "Failed to store the bridged device information");
@@ -148,6 +199,9 @@ esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
             return ESP_ERR_NOT_FOUND;
         }
     }
+    g_bridged_device_index.remove(bridged_device);
+    // The held writes of the device are not sent
+    g_bridged_device_shadow.discard(bridged_device);
 
     bridged_device->erase_dev_addr();
     bridged_device->delete_dev_addr();
@@ -166,38 +220,48 @@ esp_err_t app_bridge_remove_device(app_bridged_device_t *bridged_device)
 
 app_bridged_device_t *app_bridge_get_device(const void *dev_addr)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if (current_dev->check_dev_addr(dev_addr)) {
-            return current_dev;
-        }
-        current_dev = current_dev->get_next();
-    }
-    return nullptr;
+    return g_bridged_device_index.find(dev_addr);
 }
 
 app_bridged_device_t *app_bridge_get_device(uint16_t endpoint_id)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if (current_dev->get_matter_device() &&
-                esp_matter::endpoint::get_id(current_dev->get_matter_device()->endpoint) == endpoint_id) {
-            return current_dev;
-        }
-        current_dev = current_dev->get_next();
-    }
-    return nullptr;
+    return g_bridged_device_index.find(endpoint_id);
 }
 
 uint16_t app_bridge_get_endpoint(const void *dev_addr)
 {
-    app_bridged_device_t *current_dev = g_bridged_device_list;
-    while (current_dev) {
-        if (current_dev->check_dev_addr(dev_addr) && current_dev->get_matter_device()) {
-            return endpoint::get_id(current_dev->get_matter_device()->endpoint);
-        }
-        current_dev = current_dev->get_next();
+    app_bridged_device_t *bridged_device = g_bridged_device_index.find(dev_addr);
+    return bridged_device ? bridged_device->get_endpoint_id() : chip::kInvalidEndpointId;
+}
+
+esp_err_t app_bridge_shadow_enable(app_bridge_send_callback_t send_cb, uint32_t window_ms)
+{
+    VerifyOrReturnValue(send_cb, ESP_ERR_INVALID_ARG);
+    g_bridged_device_shadow.set_send_callback(send_cb);
+    g_bridged_device_shadow.set_window(window_ms);
+    g_bridged_device_shadow_enabled = true;
+    return ESP_OK;
+}
+
+esp_err_t app_bridge_shadow_write(app_bridged_device_t *bridged_device, uint32_t cluster_id, uint32_t attribute_id,
+                                  esp_matter_attr_val_t *val)
+{
+    VerifyOrReturnValue(bridged_device && val, ESP_ERR_INVALID_ARG);
+    VerifyOrReturnValue(g_bridged_device_shadow_enabled, ESP_ERR_INVALID_STATE);
+    return g_bridged_device_shadow.write(bridged_device, cluster_id, attribute_id, *val);
+}
+
+bool app_bridge_shadow_report(app_bridged_device_t *bridged_device, uint32_t cluster_id, uint32_t attribute_id,
+                              const esp_matter_attr_val_t *val)
+{
+    if (!g_bridged_device_shadow_enabled || !val) {
+        return true;
     }
-    return chip::kInvalidEndpointId;
+    return g_bridged_device_shadow.report(bridged_device, cluster_id, attribute_id, *val);
+}
+
+const app_bridged_device_shadow_stats_t *app_bridge_shadow_get_stats()
+{
+    return &g_bridged_device_shadow.get_stats();
 }
 #endif
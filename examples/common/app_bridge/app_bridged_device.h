@@ -21,10 +21,16 @@
 
 using esp_matter::node_t;
 
+struct app_bridged_device_shadow_entry;
+
+// Hash of a device address, two addresses for which check_dev_addr() returns true must have the same hash.
+typedef uint32_t (*dev_addr_hash_callback_t)(const void *addr_ctx);
+
 /* Virtual Class for Bridged Device */
 class app_bridged_device_t {
 public:
-    app_bridged_device_t() : m_dev(nullptr), m_dev_addr_ctx(nullptr), m_next(nullptr), m_priv_data(nullptr) {};
+    app_bridged_device_t() : m_dev(nullptr), m_dev_addr_ctx(nullptr), m_next(nullptr), m_priv_data(nullptr),
+        m_dev_addr_hash(0), m_next_by_dev_addr(nullptr), m_next_by_endpoint(nullptr), m_shadow_entries(nullptr) {};
 
     virtual ~app_bridged_device_t() = default;
 
@@ -32,7 +38,8 @@ public:
     // and the allocated memory must be released in delete_dev_addr().
     virtual esp_err_t set_dev_addr(const void *addr_ctx) = 0;
     // This function will compare device address in addr_ctx and dev_addr_ctx. If the two addresses are the
-    // same, it should return true.
+    // same, it should return true. The subclasses should also provide a dev_addr_hash_callback_t hashing the
+    // compared fields, see app_bridge_initialize().
     virtual bool check_dev_addr(const void *addr_ctx) = 0;
     // This function will release the allocated device address in set_dev_addr().
     virtual esp_err_t delete_dev_addr() = 0;
@@ -53,6 +60,11 @@ public:
         m_dev = dev;
     }
 
+    uint16_t get_endpoint_id() const
+    {
+        return m_dev ? m_dev->persistent_info.device_endpoint_id : chip::kInvalidEndpointId;
+    }
+
     void *get_dev_addr() const
     {
         return m_dev_addr_ctx;
@@ -85,8 +97,157 @@ protected:
     app_bridged_device_t *m_next;
     /* User initialization data */
     void *m_priv_data;
+
+private:
+    friend class app_bridged_device_index_t;
+    /** Hash of the device address when the device was indexed */
+    uint32_t m_dev_addr_hash;
+    /** Next device in the same device address bucket */
+    app_bridged_device_t *m_next_by_dev_addr;
+    /** Next device in the same endpoint id bucket */
+    app_bridged_device_t *m_next_by_endpoint;
+
+    friend class app_bridged_device_shadow_t;
+    /** Shadow state of the attributes written to or reported by the device */
+    app_bridged_device_shadow_entry *m_shadow_entries;
+};
+
+/* Hashed indexes of the bridged devices by device address and by endpoint id
+ *
+ * The address of a device must be set before it is added and must not change while it is indexed. Without hash
+ * callback all the devices share a bucket and the address lookup walks them, as the device list does.
+ */
+class app_bridged_device_index_t {
+public:
+    app_bridged_device_index_t() = default;
+    ~app_bridged_device_index_t();
+
+    // The hash callback can only be changed while the index is empty.
+    esp_err_t set_hash_callback(dev_addr_hash_callback_t hash_cb);
+
+    esp_err_t add(app_bridged_device_t *device);
+    esp_err_t remove(app_bridged_device_t *device);
+    void clear();
+
+    app_bridged_device_t *find(const void *dev_addr) const;
+    app_bridged_device_t *find(uint16_t endpoint_id) const;
+
+    size_t get_count() const
+    {
+        return m_count;
+    }
+
+private:
+    esp_err_t resize(uint8_t bucket_bits);
+    size_t get_bucket(uint32_t hash) const;
+
+    dev_addr_hash_callback_t m_hash_cb = nullptr;
+    /* The device address buckets followed by the endpoint id buckets */
+    app_bridged_device_t **m_buckets = nullptr;
+    uint8_t m_bucket_bits = 0;
+    size_t m_count = 0;
+};
+
+// Sends an attribute value to the downstream device, the zigbee_bridge_attribute_update() of the examples. It returns
+// ESP_ERR_NOT_SUPPORTED for the attributes which are not bridged to the device.
+typedef esp_err_t (*app_bridge_send_callback_t)(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                                                esp_matter_attr_val_t *val, app_bridged_device_t *device);
+
+/* Counters of the shadow state, to tune the coalescing window */
+typedef struct app_bridged_device_shadow_stats {
+    /** Matter writes of the bridged attributes */
+    uint32_t writes;
+    /** Values sent to the downstream devices */
+    uint32_t frames_sent;
+    /** Values the send callback failed to send */
+    uint32_t send_failures;
+    /** Writes replaced by a later write before they were sent */
+    uint32_t writes_coalesced;
+    /** Writes of the value the downstream device already has, not sent */
+    uint32_t writes_unchanged;
+    /** Values reported by the downstream devices */
+    uint32_t reports;
+    /** Reports not applied to Matter: echoes of the sent values, or older than the held write */
+    uint32_t reports_suppressed;
+} app_bridged_device_shadow_stats_t;
+
+/* Last known and desired values of the bridged attributes, to limit the traffic toward the downstream devices
+ *
+ * A write is sent right away unless a value was sent for the same attribute less than the window ago. It is then
+ * held until the window ends, and only the latest value written meanwhile is sent. A held write which fails to send
+ * is held again for another window, until it is sent or replaced by a later write. The attributes for which the send
+ * callback returns ESP_ERR_NOT_SUPPORTED keep no shadow state.
+ *
+ * The values reported by the device are its last known values: a write of the value the device has is not sent, and
+ * a held write is not sent if the device reported its value meanwhile. A report received while a write is held is
+ * not applied to Matter, the held value is newer.
+ *
+ * The scalar values are shadowed, the other types are sent right away. It must be used with the Matter stack lock
+ * held, the held writes are sent from a Matter timer once the stack is started or by flush().
+ */
+class app_bridged_device_shadow_t {
+public:
+    app_bridged_device_shadow_t() = default;
+    ~app_bridged_device_shadow_t();
+
+    void set_send_callback(app_bridge_send_callback_t send_cb)
+    {
+        m_send_cb = send_cb;
+    }
+    // A 0 ms window sends every write which changes the value
+    void set_window(uint32_t window_ms)
+    {
+        m_window_us = (int64_t)window_ms * 1000;
+    }
+
+    esp_err_t write(app_bridged_device_t *device, uint32_t cluster_id, uint32_t attribute_id,
+                    const esp_matter_attr_val_t &val);
+    // For the reports of the devices: returns whether the value should be updated on the Matter attribute
+    bool report(app_bridged_device_t *device, uint32_t cluster_id, uint32_t attribute_id,
+                const esp_matter_attr_val_t &val);
+    // Drops the shadow state of a device which is removed, its held writes are not sent
+    void discard(app_bridged_device_t *device);
+
+    // Sends the held writes whose window has ended, or all of them
+    esp_err_t flush_due();
+    esp_err_t flush();
+
+    size_t get_pending_count() const
+    {
+        return m_pending_count;
+    }
+    // The attributes of the device with shadow state
+    size_t get_entry_count(const app_bridged_device_t *device) const;
+    const app_bridged_device_shadow_stats_t &get_stats() const
+    {
+        return m_stats;
+    }
+    void reset_stats()
+    {
+        m_stats = {};
+    }
+
+private:
+    app_bridged_device_shadow_entry *get_entry(app_bridged_device_t *device, uint32_t cluster_id,
+                                               uint32_t attribute_id);
+    esp_err_t send(app_bridged_device_shadow_entry *entry, const esp_matter_attr_val_t &val, int64_t now_us);
+    void remove_entry(app_bridged_device_shadow_entry *entry);
+    bool hold(app_bridged_device_shadow_entry *entry, int64_t deadline_us);
+    esp_err_t send_pending(app_bridged_device_shadow_entry *entry, int64_t now_us);
+    esp_err_t send_held(app_bridged_device_shadow_entry *held, int64_t now_us);
+    void schedule(int64_t now_us);
+
+    app_bridge_send_callback_t m_send_cb = nullptr;
+    int64_t m_window_us = 0;
+    /* The held writes, by deadline */
+    app_bridged_device_shadow_entry *m_pending = nullptr;
+    size_t m_pending_count = 0;
+    app_bridged_device_shadow_stats_t m_stats = {};
 };
 
+// FNV-1a hash of the given bytes, for the dev_addr_hash_callback_t of the subclasses
+uint32_t app_bridge_hash_bytes(const void *data, size_t len);
+
 namespace esp_matter_bridge {
 namespace nvs_key_allocator {
 
@@ -103,8 +264,11 @@ esp_err_t map_matter_error(CHIP_ERROR error);
 typedef app_bridged_device_t *(*create_device_callback_t)(node_t *node, uint16_t endpoint_id);
 typedef void (*free_device_callback_t)(app_bridged_device_t *device);
 
+// hash_cb indexes the devices by address for app_bridge_get_device() and app_bridge_get_endpoint(), without it
+// the lookups compare the address of each device.
 esp_err_t app_bridge_initialize(node_t *node, esp_matter_bridge::bridge_device_type_callback_t device_type_cb,
-                                create_device_callback_t create_cb, free_device_callback_t free_cb);
+                                create_device_callback_t create_cb, free_device_callback_t free_cb,
+                                dev_addr_hash_callback_t hash_cb = nullptr);
 
 esp_err_t app_bridge_create_new_device(node_t *node, uint16_t parent_endpoint_id, uint32_t matter_device_type_id,
                                        void *addr_ctx, void *priv_data);
@@ -116,3 +280,18 @@ app_bridged_device_t *app_bridge_get_device(const void *dev_addr);
 app_bridged_device_t *app_bridge_get_device(uint16_t endpoint_id);
 
 uint16_t app_bridge_get_endpoint(const void *dev_addr);
+
+// Route the writes of the bridged attributes through the shadow state, see app_bridged_device_shadow_t. window_ms is
+// the minimum time between two values sent for the same attribute.
+esp_err_t app_bridge_shadow_enable(app_bridge_send_callback_t send_cb, uint32_t window_ms);
+
+// For the PRE_UPDATE attribute callback: sends the value to the device now or at the end of the window
+esp_err_t app_bridge_shadow_write(app_bridged_device_t *bridged_device, uint32_t cluster_id, uint32_t attribute_id,
+                                  esp_matter_attr_val_t *val);
+
+// For the reports of the devices: returns whether the value should be updated on the Matter attribute, the echoes of
+// the values sent and the reports older than a held write are not applied
+bool app_bridge_shadow_report(app_bridged_device_t *bridged_device, uint32_t cluster_id, uint32_t attribute_id,
+                              const esp_matter_attr_val_t *val);
+
+const app_bridged_device_shadow_stats_t *app_bridge_shadow_get_stats();
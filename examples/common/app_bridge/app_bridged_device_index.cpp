@@ -0,0 +1,169 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_matter_mem.h>
+
+#include <app_bridged_device.h>
+
+static constexpr uint8_t k_min_bucket_bits = 3;
+static constexpr uint8_t k_max_bucket_bits = 12;
+
+uint32_t app_bridge_hash_bytes(const void *data, size_t len)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; ++i) {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+app_bridged_device_index_t::~app_bridged_device_index_t()
+{
+    clear();
+}
+
+esp_err_t app_bridged_device_index_t::set_hash_callback(dev_addr_hash_callback_t hash_cb)
+{
+    if (m_count != 0) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    m_hash_cb = hash_cb;
+    return ESP_OK;
+}
+
+size_t app_bridged_device_index_t::get_bucket(uint32_t hash) const
+{
+    // Fibonacci hashing, the endpoint ids and the short addresses differ in their low bits only
+    return (hash * 2654435769u) >> (32 - m_bucket_bits);
+}
+
+esp_err_t app_bridged_device_index_t::resize(uint8_t bucket_bits)
+{
+    size_t bucket_count = (size_t)1 << bucket_bits;
+    app_bridged_device_t **buckets =
+        (app_bridged_device_t **)esp_matter_mem_calloc(2 * bucket_count, sizeof(app_bridged_device_t *));
+    if (!buckets) {
+        return ESP_ERR_NO_MEM;
+    }
+    app_bridged_device_t **old_buckets = m_buckets;
+    size_t old_bucket_count = m_buckets ? (size_t)1 << m_bucket_bits : 0;
+    m_buckets = buckets;
+    m_bucket_bits = bucket_bits;
+    // Both chains contain all the devices, rebuild them from the endpoint chains
+    for (size_t idx = 0; idx < old_bucket_count; ++idx) {
+        app_bridged_device_t *device = old_buckets[old_bucket_count + idx];
+        while (device) {
+            app_bridged_device_t *next = device->m_next_by_endpoint;
+            app_bridged_device_t **addr_bucket = &m_buckets[get_bucket(device->m_dev_addr_hash)];
+            device->m_next_by_dev_addr = *addr_bucket;
+            *addr_bucket = device;
+            app_bridged_device_t **endpoint_bucket = &m_buckets[bucket_count + get_bucket(device->get_endpoint_id())];
+            device->m_next_by_endpoint = *endpoint_bucket;
+            *endpoint_bucket = device;
+            device = next;
+        }
+    }
+    esp_matter_mem_free(old_buckets);
+    return ESP_OK;
+}
+
+esp_err_t app_bridged_device_index_t::add(app_bridged_device_t *device)
+{
+    if (!device || device->get_endpoint_id() == chip::kInvalidEndpointId) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!m_buckets) {
+        if (resize(k_min_bucket_bits) != ESP_OK) {
+            return ESP_ERR_NO_MEM;
+        }
+    } else if (m_count >= ((size_t)1 << m_bucket_bits) && m_bucket_bits < k_max_bucket_bits) {
+        // Longer chains are still correct if the larger table cannot be allocated
+        resize(m_bucket_bits + 1);
+    }
+    const void *dev_addr = device->get_dev_addr();
+    device->m_dev_addr_hash = (m_hash_cb && dev_addr) ? m_hash_cb(dev_addr) : 0;
+    app_bridged_device_t **addr_bucket = &m_buckets[get_bucket(device->m_dev_addr_hash)];
+    device->m_next_by_dev_addr = *addr_bucket;
+    *addr_bucket = device;
+    app_bridged_device_t **endpoint_bucket =
+        &m_buckets[((size_t)1 << m_bucket_bits) + get_bucket(device->get_endpoint_id())];
+    device->m_next_by_endpoint = *endpoint_bucket;
+    *endpoint_bucket = device;
+    m_count++;
+    return ESP_OK;
+}
+
+esp_err_t app_bridged_device_index_t::remove(app_bridged_device_t *device)
+{
+    if (!device) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!m_buckets) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    app_bridged_device_t **link = &m_buckets[((size_t)1 << m_bucket_bits) + get_bucket(device->get_endpoint_id())];
+    while (*link && *link != device) {
+        link = &(*link)->m_next_by_endpoint;
+    }
+    if (!*link) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    *link = device->m_next_by_endpoint;
+    link = &m_buckets[get_bucket(device->m_dev_addr_hash)];
+    while (*link != device) {
+        link = &(*link)->m_next_by_dev_addr;
+    }
+    *link = device->m_next_by_dev_addr;
+    device->m_next_by_dev_addr = nullptr;
+    device->m_next_by_endpoint = nullptr;
+    m_count--;
+    return ESP_OK;
+}
+
+void app_bridged_device_index_t::clear()
+{
+    esp_matter_mem_free(m_buckets);
+    m_buckets = nullptr;
+    m_bucket_bits = 0;
+    m_count = 0;
+}
+
+app_bridged_device_t *app_bridged_device_index_t::find(const void *dev_addr) const
+{
+    if (!m_buckets || !dev_addr) {
+        return nullptr;
+    }
+    uint32_t hash = m_hash_cb ? m_hash_cb(dev_addr) : 0;
+    for (app_bridged_device_t *device = m_buckets[get_bucket(hash)]; device; device = device->m_next_by_dev_addr) {
+        if (device->m_dev_addr_hash == hash && device->check_dev_addr(dev_addr)) {
+            return device;
+        }
+    }
+    return nullptr;
+}
+
+app_bridged_device_t *app_bridged_device_index_t::find(uint16_t endpoint_id) const
+{
+    if (!m_buckets) {
+        return nullptr;
+    }
+    for (app_bridged_device_t *device = m_buckets[((size_t)1 << m_bucket_bits) + get_bucket(endpoint_id)]; device;
+            device = device->m_next_by_endpoint) {
+        if (device->get_endpoint_id() == endpoint_id) {
+            return device;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,332 @@
+// Copyright 2026 Espressif Systems (Shanghai) PTE LTD
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <esp_log.h>
+#include <esp_matter_core.h>
+#include <esp_matter_mem.h>
+#include <esp_timer.h>
+
+#include <app_bridged_device.h>
+#include <platform/CHIPDeviceLayer.h>
+
+static const char *TAG = "app_bridge_shadow";
+
+// A held write which failed to send is retried after the window, and not sooner than this delay
+static constexpr int64_t k_min_retry_delay_us = 100 * 1000;
+
+struct app_bridged_device_shadow_entry {
+    uint32_t cluster_id;
+    uint32_t attribute_id;
+    app_bridged_device_t *device;
+    esp_matter_attr_val_t current; /* Last value sent to or reported by the device */
+    esp_matter_attr_val_t desired; /* Latest write, held until the deadline */
+    bool has_current;
+    bool sent;
+    bool pending;
+    int64_t last_sent_us;
+    int64_t deadline_us;
+    app_bridged_device_shadow_entry *next; /* Next entry of the same device */
+    app_bridged_device_shadow_entry *next_pending; /* Next held write, by deadline */
+};
+
+// The strings and arrays point to buffers owned by the caller, they are not kept
+static bool is_shadowed(const esp_matter_attr_val_t &val)
+{
+    switch (val.get_storage_type()) {
+    case ESP_MATTER_VAL_TYPE_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_OCTET_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_CHAR_STRING:
+    case ESP_MATTER_VAL_TYPE_LONG_OCTET_STRING:
+    case ESP_MATTER_VAL_TYPE_ARRAY:
+        return false;
+    default:
+        return true;
+    }
+}
+
+static bool is_current(const app_bridged_device_shadow_entry *entry, const esp_matter_attr_val_t &val)
+{
+    return entry->has_current && esp_matter::attribute::val_compare(&entry->current, &val);
+}
+
+static void timer_callback(chip::System::Layer *layer, void *context)
+{
+    static_cast<app_bridged_device_shadow_t *>(context)->flush_due();
+}
+
+app_bridged_device_shadow_t::~app_bridged_device_shadow_t()
+{
+    if (esp_matter::is_started()) {
+        chip::DeviceLayer::SystemLayer().CancelTimer(timer_callback, this);
+    }
+}
+
+app_bridged_device_shadow_entry *app_bridged_device_shadow_t::get_entry(app_bridged_device_t *device,
+                                                                        uint32_t cluster_id, uint32_t attribute_id)
+{
+    // A device has a few bridged attributes, its entries are searched in a list
+    for (app_bridged_device_shadow_entry *entry = device->m_shadow_entries; entry; entry = entry->next) {
+        if (entry->cluster_id == cluster_id && entry->attribute_id == attribute_id) {
+            return entry;
+        }
+    }
+    app_bridged_device_shadow_entry *entry =
+        (app_bridged_device_shadow_entry *)esp_matter_mem_calloc(1, sizeof(app_bridged_device_shadow_entry));
+    if (!entry) {
+        ESP_LOGE(TAG, "Failed to allocate the shadow state of attribute 0x%" PRIx32, attribute_id);
+        return nullptr;
+    }
+    entry->cluster_id = cluster_id;
+    entry->attribute_id = attribute_id;
+    entry->device = device;
+    entry->next = device->m_shadow_entries;
+    device->m_shadow_entries = entry;
+    return entry;
+}
+
+void app_bridged_device_shadow_t::remove_entry(app_bridged_device_shadow_entry *entry)
+{
+    app_bridged_device_shadow_entry **position = &entry->device->m_shadow_entries;
+    while (*position != entry) {
+        position = &(*position)->next;
+    }
+    *position = entry->next;
+    esp_matter_mem_free(entry);
+}
+
+esp_err_t app_bridged_device_shadow_t::send(app_bridged_device_shadow_entry *entry, const esp_matter_attr_val_t &val,
+                                            int64_t now_us)
+{
+    if (!m_send_cb) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // The callback gets its own copy, like the attribute callback
+    esp_matter_attr_val_t sent_val = val;
+    esp_err_t err = m_send_cb(entry->device->get_endpoint_id(), entry->cluster_id, entry->attribute_id, &sent_val,
+                              entry->device);
+    if (err == ESP_ERR_NOT_SUPPORTED) {
+        // The attribute is not bridged to the device, it keeps no shadow state
+        remove_entry(entry);
+        return ESP_OK;
+    }
+    if (err != ESP_OK) {
+        m_stats.send_failures++;
+        return err;
+    }
+    m_stats.frames_sent++;
+    entry->current = val;
+    entry->has_current = true;
+    entry->sent = true;
+    entry->last_sent_us = now_us;
+    return ESP_OK;
+}
+
+// Keep the write until deadline_us, returns whether it is the first held write
+bool app_bridged_device_shadow_t::hold(app_bridged_device_shadow_entry *entry, int64_t deadline_us)
+{
+    entry->pending = true;
+    entry->deadline_us = deadline_us;
+    app_bridged_device_shadow_entry **position = &m_pending;
+    while (*position && (*position)->deadline_us <= entry->deadline_us) {
+        position = &(*position)->next_pending;
+    }
+    entry->next_pending = *position;
+    *position = entry;
+    m_pending_count++;
+    return m_pending == entry;
+}
+
+esp_err_t app_bridged_device_shadow_t::send_pending(app_bridged_device_shadow_entry *entry, int64_t now_us)
+{
+    entry->pending = false;
+    m_pending_count--;
+    // The latest write might be back to the value sent, or the device reported it during the window
+    if (is_current(entry, entry->desired)) {
+        m_stats.writes_unchanged++;
+        return ESP_OK;
+    }
+    esp_err_t err = send(entry, entry->desired, now_us);
+    if (err != ESP_OK) {
+        // Matter already has the value, keep it for the device until it is sent or a later write replaces it
+        hold(entry, now_us + (m_window_us > k_min_retry_delay_us ? m_window_us : k_min_retry_delay_us));
+    }
+    return err;
+}
+
+// Send the held writes taken out of the pending list, the failed ones are held again
+esp_err_t app_bridged_device_shadow_t::send_held(app_bridged_device_shadow_entry *held, int64_t now_us)
+{
+    esp_err_t err = ESP_OK;
+    while (held) {
+        app_bridged_device_shadow_entry *entry = held;
+        held = entry->next_pending;
+        esp_err_t send_err = send_pending(entry, now_us);
+        err = err == ESP_OK ? send_err : err;
+    }
+    schedule(now_us);
+    return err;
+}
+
+void app_bridged_device_shadow_t::schedule(int64_t now_us)
+{
+    // The held writes wait for flush() until the Matter timers can be used
+    if (!esp_matter::is_started()) {
+        return;
+    }
+    auto &system_layer = chip::DeviceLayer::SystemLayer();
+    if (!m_pending) {
+        system_layer.CancelTimer(timer_callback, this);
+        return;
+    }
+    int64_t delay_us = m_pending->deadline_us > now_us ? m_pending->deadline_us - now_us : 0;
+    // Round up, so that the head is due when the timer fires
+    uint32_t delay_ms = (uint32_t)((delay_us + 999) / 1000);
+    if (system_layer.StartTimer(chip::System::Clock::Milliseconds32(delay_ms), timer_callback, this) !=
+            CHIP_NO_ERROR) {
+        ESP_LOGE(TAG, "Failed to start the shadow timer, the held writes wait for the next write");
+    }
+}
+
+esp_err_t app_bridged_device_shadow_t::write(app_bridged_device_t *device, uint32_t cluster_id,
+                                             uint32_t attribute_id, const esp_matter_attr_val_t &val)
+{
+    if (!device || !device->get_matter_device()) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    m_stats.writes++;
+    if (!is_shadowed(val)) {
+        if (!m_send_cb) {
+            return ESP_ERR_INVALID_STATE;
+        }
+        esp_matter_attr_val_t sent_val = val;
+        esp_err_t err = m_send_cb(device->get_endpoint_id(), cluster_id, attribute_id, &sent_val, device);
+        if (err == ESP_ERR_NOT_SUPPORTED) {
+            return ESP_OK;
+        }
+        if (err != ESP_OK) {
+            m_stats.send_failures++;
+            return err;
+        }
+        m_stats.frames_sent++;
+        return ESP_OK;
+    }
+
+    app_bridged_device_shadow_entry *entry = get_entry(device, cluster_id, attribute_id);
+    if (!entry) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    if (entry->pending) {
+        // Only the latest value is sent at the end of the window
+        entry->desired = val;
+        m_stats.writes_coalesced++;
+        return ESP_OK;
+    }
+    if (is_current(entry, val)) {
+        m_stats.writes_unchanged++;
+        return ESP_OK;
+    }
+    int64_t now_us = esp_timer_get_time();
+    if (!entry->sent || now_us - entry->last_sent_us >= m_window_us) {
+        return send(entry, val, now_us);
+    }
+
+    // Hold the write until the window of the last value sent ends
+    entry->desired = val;
+    if (hold(entry, entry->last_sent_us + m_window_us)) {
+        schedule(now_us);
+    }
+    return ESP_OK;
+}
+
+bool app_bridged_device_shadow_t::report(app_bridged_device_t *device, uint32_t cluster_id, uint32_t attribute_id,
+                                         const esp_matter_attr_val_t &val)
+{
+    if (!device || !is_shadowed(val)) {
+        return true;
+    }
+    m_stats.reports++;
+    app_bridged_device_shadow_entry *entry = get_entry(device, cluster_id, attribute_id);
+    if (!entry) {
+        return true;
+    }
+    bool changed = !is_current(entry, val);
+    // The held write is kept, it is compared with the value of the device when its window ends
+    entry->current = val;
+    entry->has_current = true;
+    if (entry->pending || !changed) {
+        m_stats.reports_suppressed++;
+        return false;
+    }
+    return true;
+}
+
+size_t app_bridged_device_shadow_t::get_entry_count(const app_bridged_device_t *device) const
+{
+    size_t count = 0;
+    for (app_bridged_device_shadow_entry *entry = device ? device->m_shadow_entries : nullptr; entry;
+            entry = entry->next) {
+        count++;
+    }
+    return count;
+}
+
+void app_bridged_device_shadow_t::discard(app_bridged_device_t *device)
+{
+    if (!device) {
+        return;
+    }
+    bool head_removed = false;
+    app_bridged_device_shadow_entry *entry = device->m_shadow_entries;
+    while (entry) {
+        app_bridged_device_shadow_entry *next = entry->next;
+        if (entry->pending) {
+            app_bridged_device_shadow_entry **position = &m_pending;
+            while (*position != entry) {
+                position = &(*position)->next_pending;
+            }
+            head_removed = head_removed || position == &m_pending;
+            *position = entry->next_pending;
+            m_pending_count--;
+        }
+        esp_matter_mem_free(entry);
+        entry = next;
+    }
+    device->m_shadow_entries = nullptr;
+    if (head_removed) {
+        schedule(esp_timer_get_time());
+    }
+}
+
+esp_err_t app_bridged_device_shadow_t::flush_due()
+{
+    int64_t now_us = esp_timer_get_time();
+    // Take the due writes out first, so that a failed one held again is not retried in the same pass
+    app_bridged_device_shadow_entry *due = nullptr;
+    app_bridged_device_shadow_entry **tail = &due;
+    while (m_pending && m_pending->deadline_us <= now_us) {
+        *tail = m_pending;
+        tail = &m_pending->next_pending;
+        m_pending = m_pending->next_pending;
+    }
+    *tail = nullptr;
+    return send_held(due, now_us);
+}
+
+esp_err_t app_bridged_device_shadow_t::flush()
+{
+    app_bridged_device_shadow_entry *held = m_pending;
+    m_pending = nullptr;
+    return send_held(held, esp_timer_get_time());
+}
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <inttypes.h>
+#include <unity.h>
+#include <esp_timer.h>
+#include <app_bridged_device.h>
+
+#include "sim_bridged_device.h"
+
+static constexpr uint16_t k_device_count = 128;
+static constexpr uint16_t k_first_endpoint_id = 2;
+static constexpr uint32_t k_lookup_count = 2000;
+
+static sim_bridged_device_t s_devices[k_device_count];
+
+// Zigbee like short addresses, spread over the 16-bit space
+static uint16_t get_short_addr(uint16_t idx)
+{
+    return (uint16_t)(idx * 40503u + 0x1234);
+}
+
+static void add_devices(app_bridged_device_index_t &index)
+{
+    for (uint16_t idx = 0; idx < k_device_count; ++idx) {
+        s_devices[idx].init(k_first_endpoint_id + idx, get_short_addr(idx));
+        TEST_ASSERT_EQUAL(ESP_OK, index.add(&s_devices[idx]));
+    }
+    TEST_ASSERT_EQUAL(k_device_count, index.get_count());
+}
+
+static uint32_t constant_hash(const void *addr_ctx)
+{
+    return 42;
+}
+
+TEST_CASE("bridged device index finds the devices by address and endpoint", "[bridge_index]")
+{
+    app_bridged_device_index_t index;
+    TEST_ASSERT_EQUAL(ESP_OK, index.set_hash_callback(sim_bridged_device_t::hash_dev_addr));
+    add_devices(index);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, index.set_hash_callback(nullptr));
+
+    for (uint16_t idx = 0; idx < k_device_count; ++idx) {
+        uint16_t short_addr = get_short_addr(idx);
+        TEST_ASSERT_EQUAL_PTR(&s_devices[idx], index.find(&short_addr));
+        TEST_ASSERT_EQUAL_PTR(&s_devices[idx], index.find((uint16_t)(k_first_endpoint_id + idx)));
+    }
+    uint16_t unknown_addr = get_short_addr(k_device_count);
+    TEST_ASSERT_NULL(index.find(&unknown_addr));
+    TEST_ASSERT_NULL(index.find((uint16_t)(k_first_endpoint_id + k_device_count)));
+
+    // Removing a device keeps the others in both chains
+    TEST_ASSERT_EQUAL(ESP_OK, index.remove(&s_devices[5]));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, index.remove(&s_devices[5]));
+    uint16_t short_addr = get_short_addr(5);
+    TEST_ASSERT_NULL(index.find(&short_addr));
+    TEST_ASSERT_NULL(index.find((uint16_t)(k_first_endpoint_id + 5)));
+    short_addr = get_short_addr(6);
+    TEST_ASSERT_EQUAL_PTR(&s_devices[6], index.find(&short_addr));
+    TEST_ASSERT_EQUAL(k_device_count - 1, index.get_count());
+}
+
+TEST_CASE("bridged device index compares the addresses in a bucket", "[bridge_index]")
+{
+    // All the addresses collide, without callback as well
+    dev_addr_hash_callback_t hash_cbs[] = { constant_hash, nullptr };
+    for (dev_addr_hash_callback_t hash_cb : hash_cbs) {
+        app_bridged_device_index_t index;
+        TEST_ASSERT_EQUAL(ESP_OK, index.set_hash_callback(hash_cb));
+        add_devices(index);
+        for (uint16_t idx = 0; idx < k_device_count; idx += 7) {
+            uint16_t short_addr = get_short_addr(idx);
+            TEST_ASSERT_EQUAL_PTR(&s_devices[idx], index.find(&short_addr));
+        }
+        TEST_ASSERT_EQUAL(ESP_OK, index.remove(&s_devices[0]));
+        uint16_t short_addr = get_short_addr(0);
+        TEST_ASSERT_NULL(index.find(&short_addr));
+    }
+}
+
+TEST_CASE("bridged device lookup cost", "[bridge_index][benchmark]")
+{
+    app_bridged_device_index_t index;
+    TEST_ASSERT_EQUAL(ESP_OK, index.set_hash_callback(sim_bridged_device_t::hash_dev_addr));
+    add_devices(index);
+
+    // The device list walk done before the index
+    app_bridged_device_t *list = nullptr;
+    for (uint16_t idx = 0; idx < k_device_count; ++idx) {
+        s_devices[idx].set_next(list);
+        list = &s_devices[idx];
+    }
+
+    // Each lookup must find the expected device, the timings are only printed
+    uint32_t found = 0;
+    int64_t start = esp_timer_get_time();
+    for (uint32_t lookup = 0; lookup < k_lookup_count; ++lookup) {
+        uint16_t short_addr = get_short_addr(lookup % k_device_count);
+        for (app_bridged_device_t *device = list; device; device = device->get_next()) {
+            if (device->check_dev_addr(&short_addr)) {
+                found += device == &s_devices[lookup % k_device_count] ? 1 : 0;
+                break;
+            }
+        }
+    }
+    int64_t list_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (uint32_t lookup = 0; lookup < k_lookup_count; ++lookup) {
+        uint16_t short_addr = get_short_addr(lookup % k_device_count);
+        found += index.find(&short_addr) == &s_devices[lookup % k_device_count] ? 1 : 0;
+    }
+    int64_t index_us = esp_timer_get_time() - start;
+
+    start = esp_timer_get_time();
+    for (uint32_t lookup = 0; lookup < k_lookup_count; ++lookup) {
+        uint16_t endpoint_id = (uint16_t)(k_first_endpoint_id + lookup % k_device_count);
+        found += index.find(endpoint_id) == &s_devices[lookup % k_device_count] ? 1 : 0;
+    }
+    int64_t endpoint_us = esp_timer_get_time() - start;
+    TEST_ASSERT_EQUAL_UINT32(3 * k_lookup_count, found);
+
+    printf("devices: %u, ns per lookup: list walk %" PRId64 ", address index %" PRId64 ", endpoint index %" PRId64 "\n",
+           k_device_count, list_us * 1000 / k_lookup_count, index_us * 1000 / k_lookup_count,
+           endpoint_us * 1000 / k_lookup_count);
+}
@@ -0,0 +1,224 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <unity.h>
+#include <esp_matter_attribute_utils.h>
+#include <app_bridged_device.h>
+
+#include "sim_bridged_device.h"
+
+static constexpr uint32_t k_cluster_id = 0x0008;
+static constexpr uint32_t k_attribute_id = 0x0000;
+// An attribute which is not bridged to the device
+static constexpr uint32_t k_unsupported_attribute_id = 0x0010;
+static constexpr uint32_t k_window_ms = 60000;
+
+static uint32_t s_frame_count;
+static esp_matter_attr_val_t s_last_frame;
+static esp_err_t s_send_err;
+
+static esp_err_t count_frame(uint16_t endpoint_id, uint32_t cluster_id, uint32_t attribute_id,
+                             esp_matter_attr_val_t *val, app_bridged_device_t *device)
+{
+    if (attribute_id == k_unsupported_attribute_id) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if (s_send_err != ESP_OK) {
+        return s_send_err;
+    }
+    s_frame_count++;
+    s_last_frame = *val;
+    return ESP_OK;
+}
+
+static void init_shadow(app_bridged_device_shadow_t &shadow, sim_bridged_device_t &device, uint32_t window_ms)
+{
+    s_frame_count = 0;
+    s_send_err = ESP_OK;
+    device.init(2, 0x1234);
+    shadow.set_send_callback(count_frame);
+    shadow.set_window(window_ms);
+}
+
+TEST_CASE("bridge shadow sends only the latest write of the window", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, k_window_ms);
+
+    // The first write is sent right away, the next ones are held until the window ends
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(10)));
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+    for (uint8_t level = 11; level <= 20; ++level) {
+        TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(level)));
+    }
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+
+    // The window has not ended yet
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush_due());
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush());
+    TEST_ASSERT_EQUAL(2, s_frame_count);
+    TEST_ASSERT_EQUAL_UINT8(20, s_last_frame.val.u8);
+    TEST_ASSERT_EQUAL(0, shadow.get_pending_count());
+
+    const app_bridged_device_shadow_stats_t &stats = shadow.get_stats();
+    TEST_ASSERT_EQUAL_UINT32(11, stats.writes);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.frames_sent);
+    TEST_ASSERT_EQUAL_UINT32(9, stats.writes_coalesced);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.send_failures);
+    shadow.discard(&device);
+}
+
+TEST_CASE("bridge shadow skips the values the device already has", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, 0);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(1)));
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(1)));
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+    TEST_ASSERT_EQUAL_UINT32(1, shadow.get_stats().writes_unchanged);
+
+    // Without window every change is sent
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(2)));
+    TEST_ASSERT_EQUAL(2, s_frame_count);
+    TEST_ASSERT_EQUAL(0, shadow.get_pending_count());
+
+    // A failed send is retried by the next write of the same value
+    s_send_err = ESP_FAIL;
+    TEST_ASSERT_EQUAL(ESP_FAIL, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(3)));
+    s_send_err = ESP_OK;
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(3)));
+    TEST_ASSERT_EQUAL(3, s_frame_count);
+    TEST_ASSERT_EQUAL_UINT32(1, shadow.get_stats().send_failures);
+    shadow.discard(&device);
+}
+
+TEST_CASE("bridge shadow holds the failed writes again", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, k_window_ms);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(10)));
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(20)));
+
+    // The held write which fails is kept for another window
+    s_send_err = ESP_FAIL;
+    TEST_ASSERT_EQUAL(ESP_FAIL, shadow.flush());
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    TEST_ASSERT_EQUAL_UINT32(1, shadow.get_stats().send_failures);
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush_due());
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+
+    // A later write replaces the value to retry
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(30)));
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    s_send_err = ESP_OK;
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush());
+    TEST_ASSERT_EQUAL(2, s_frame_count);
+    TEST_ASSERT_EQUAL_UINT8(30, s_last_frame.val.u8);
+    TEST_ASSERT_EQUAL(0, shadow.get_pending_count());
+    shadow.discard(&device);
+}
+
+TEST_CASE("bridge shadow suppresses the echoes of the device", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, k_window_ms);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(10)));
+    // The device confirms the value sent
+    TEST_ASSERT_FALSE(shadow.report(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(10)));
+
+    // A change made on the device is applied, and writing it back is not sent
+    TEST_ASSERT_TRUE(shadow.report(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(40)));
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(40)));
+    TEST_ASSERT_EQUAL(1, s_frame_count);
+
+    const app_bridged_device_shadow_stats_t &stats = shadow.get_stats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.reports);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.reports_suppressed);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.writes_unchanged);
+    shadow.discard(&device);
+}
+
+TEST_CASE("bridge shadow keeps the held write when the device reports during the window", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, k_window_ms);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(10)));
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(30)));
+
+    // A report older than the held write is not applied to Matter, the held write is still sent
+    TEST_ASSERT_FALSE(shadow.report(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(20)));
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush());
+    TEST_ASSERT_EQUAL(2, s_frame_count);
+    TEST_ASSERT_EQUAL_UINT8(30, s_last_frame.val.u8);
+
+    // The held write is not sent when the device reports the same value before the window ends
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(50)));
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    TEST_ASSERT_FALSE(shadow.report(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(50)));
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush());
+    TEST_ASSERT_EQUAL(2, s_frame_count);
+    TEST_ASSERT_EQUAL(0, shadow.get_pending_count());
+
+    const app_bridged_device_shadow_stats_t &stats = shadow.get_stats();
+    TEST_ASSERT_EQUAL_UINT32(2, stats.reports);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.reports_suppressed);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.writes_unchanged);
+    shadow.discard(&device);
+}
+
+TEST_CASE("bridge shadow keeps no state for the attributes not bridged", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    init_shadow(shadow, device, k_window_ms);
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_unsupported_attribute_id, esp_matter_uint8(1)));
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_unsupported_attribute_id, esp_matter_uint8(2)));
+    TEST_ASSERT_EQUAL(0, s_frame_count);
+    TEST_ASSERT_EQUAL(0, shadow.get_entry_count(&device));
+    TEST_ASSERT_EQUAL(0, shadow.get_pending_count());
+
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.write(&device, k_cluster_id, k_attribute_id, esp_matter_uint8(1)));
+    TEST_ASSERT_EQUAL(1, shadow.get_entry_count(&device));
+    shadow.discard(&device);
+    TEST_ASSERT_EQUAL(0, shadow.get_entry_count(&device));
+}
+
+TEST_CASE("bridge shadow drops the held writes of a removed device", "[bridge_shadow]")
+{
+    app_bridged_device_shadow_t shadow;
+    sim_bridged_device_t device;
+    sim_bridged_device_t other;
+    init_shadow(shadow, device, k_window_ms);
+    other.init(3, 0x5678);
+
+    app_bridged_device_t *bridged_devices[] = { &device, &other };
+    for (app_bridged_device_t *bridged_device : bridged_devices) {
+        TEST_ASSERT_EQUAL(ESP_OK, shadow.write(bridged_device, k_cluster_id, k_attribute_id, esp_matter_uint8(1)));
+        TEST_ASSERT_EQUAL(ESP_OK, shadow.write(bridged_device, k_cluster_id, k_attribute_id, esp_matter_uint8(2)));
+    }
+    TEST_ASSERT_EQUAL(2, shadow.get_pending_count());
+
+    shadow.discard(&device);
+    TEST_ASSERT_EQUAL(1, shadow.get_pending_count());
+    TEST_ASSERT_EQUAL(ESP_OK, shadow.flush());
+    TEST_ASSERT_EQUAL(3, s_frame_count);
+    shadow.discard(&other);
+}
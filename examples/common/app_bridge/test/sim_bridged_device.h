@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <app_bridged_device.h>
+
+// A bridged device without Matter endpoint, only its endpoint id is set
+class sim_bridged_device_t : public app_bridged_device_t {
+public:
+    void init(uint16_t endpoint_id, uint16_t short_addr)
+    {
+        m_matter_device.persistent_info.device_endpoint_id = endpoint_id;
+        m_dev = &m_matter_device;
+        m_short_addr = short_addr;
+        m_dev_addr_ctx = &m_short_addr;
+    }
+
+    esp_err_t set_dev_addr(const void *addr_ctx) override
+    {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    bool check_dev_addr(const void *addr_ctx) override
+    {
+        return addr_ctx && *(const uint16_t *)addr_ctx == m_short_addr;
+    }
+
+    static uint32_t hash_dev_addr(const void *addr_ctx)
+    {
+        return *(const uint16_t *)addr_ctx;
+    }
+
+    esp_err_t delete_dev_addr() override
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t store_dev_addr() override
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t restore_dev_addr() override
+    {
+        return ESP_OK;
+    }
+
+    esp_err_t erase_dev_addr() override
+    {
+        return ESP_OK;
+    }
+
+private:
+    esp_matter_bridge::device_t m_matter_device = {};
+    uint16_t m_short_addr = 0;
+};
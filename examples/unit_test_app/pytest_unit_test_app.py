@@ -78,3 +78,121 @@ def test_attribute_create_value_persistence(dut: QemuDut) -> None:
 @pytest.mark.esp32c3
 def test_optional_clusters(dut: QemuDut) -> None:
     run_group(dut, "optional_clusters")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_path_index(dut: QemuDut) -> None:
+    run_group(dut, "path_index")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["default", "features"], indirect=True)
+def test_nvs_write_back(dut: QemuDut) -> None:
+    run_group(dut, "nvs_write_back")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["features"], indirect=True)
+def test_nvs_packed(dut: QemuDut) -> None:
+    run_group(dut, "nvs_packed")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_provider_access(dut: QemuDut) -> None:
+    run_group(dut, "provider_access")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_arena(dut: QemuDut) -> None:
+    run_group(dut, "arena")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_update_async(dut: QemuDut) -> None:
+    run_group(dut, "update_async")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_report_policy(dut: QemuDut) -> None:
+    run_group(dut, "report_policy")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["features"], indirect=True)
+def test_trace(dut: QemuDut) -> None:
+    run_group(dut, "trace")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["features"], indirect=True)
+def test_latency(dut: QemuDut) -> None:
+    run_group(dut, "latency")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_bounds(dut: QemuDut) -> None:
+    run_group(dut, "bounds")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_template(dut: QemuDut) -> None:
+    run_group(dut, "template")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["default", "features"], indirect=True)
+def test_boot(dut: QemuDut) -> None:
+    run_group(dut, "boot")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_write_decode(dut: QemuDut) -> None:
+    run_group(dut, "write_decode")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_bridge_index(dut: QemuDut) -> None:
+    run_group(dut, "bridge_index")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+@pytest.mark.parametrize("config", ["default", "features"], indirect=True)
+def test_bridge(dut: QemuDut) -> None:
+    run_group(dut, "bridge")
+
+
+@pytest.mark.host_test
+@pytest.mark.qemu
+@pytest.mark.esp32c3
+def test_bridge_shadow(dut: QemuDut) -> None:
+    run_group(dut, "bridge_shadow")
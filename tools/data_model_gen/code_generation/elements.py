@@ -405,6 +405,10 @@ class Attribute(BaseAttribute):
 
         return f"esp_matter_attr_val({expr})"
 
+    def get_bounds_template_args(self) -> str:
+        """Get the template arguments of add_bounds<T, min, max>(), the bounds are kept in a constant table."""
+        return f"{self.get_type()}, {self.get_min_value()}, {self.get_max_value()}"
+
 
 class Command(BaseCommand):
     """Command class that inherits from BaseCommand"""
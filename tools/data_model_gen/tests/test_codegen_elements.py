@@ -185,6 +185,21 @@ class TestCodegenAttribute(unittest.TestCase):
             "esp_matter_attr_val::uint_sub_type::k_enum)",
         )
 
+    def test_get_bounds_template_args(self):
+        a = _make_attr("TargetsPerAccessControlEntry", "0x0000", type_="uint16")
+        a.converted_type = "uint16_t"
+        a.min_value = 0
+        a.max_value = 65534
+        self.assertEqual(a.get_bounds_template_args(), "uint16_t, 0, 65534")
+
+    def test_get_bounds_template_args_nullable_enum8(self):
+        a = _make_attr("StartUpOnOff", "0x0000", type_="enum8")
+        a.converted_type = "uint8_t"
+        a.is_nullable = True
+        a.min_value = 0
+        a.max_value = 2
+        self.assertEqual(a.get_bounds_template_args(), "uint8_t, 0, 2")
+
     def test_get_attr_val_expr_bitmap32(self):
         a = _make_attr("FeatureMap", "0x0000", type_="bitmap32")
         a.converted_type = "uint32_t"